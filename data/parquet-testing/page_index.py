@@ -0,0 +1,242 @@
+# Generates page_index.parquet: a file with multiple (uncompressed) pages per column chunk and a page index
+# (ColumnIndex/OffsetIndex) for every column chunk. The thrift structures are written with a minimal compact protocol
+# encoder so this script has no dependencies.
+#
+# Schema: i BIGINT (sorted, 0..9999), s VARCHAR (dictionary encoded, 'str' || (i % 100)), j INTEGER (i // 10, NULL if
+# i % 7 = 0 and for all rows of the page [2000, 3000))
+# There are two row groups of 5000 rows, each column chunk has pages of 1000 rows.
+import struct
+
+ROWS = 10000
+ROW_GROUP_SIZE = 5000
+PAGE_SIZE = 1000
+
+# thrift compact protocol types
+T_TRUE, T_FALSE, T_I32, T_I64, T_BINARY, T_LIST, T_STRUCT = 1, 2, 5, 6, 8, 9, 12
+
+
+def varint(v):
+    out = bytearray()
+    while True:
+        b = v & 0x7F
+        v >>= 7
+        if v:
+            out.append(b | 0x80)
+        else:
+            out.append(b)
+            return bytes(out)
+
+
+def zigzag(v):
+    return varint((v << 1) ^ (v >> 63))
+
+
+def encode_value(ttype, value):
+    if ttype in (T_I32, T_I64):
+        return zigzag(value)
+    if ttype == T_BINARY:
+        if isinstance(value, str):
+            value = value.encode('utf8')
+        return varint(len(value)) + value
+    if ttype == T_STRUCT:
+        return encode_struct(value)
+    if ttype == T_LIST:
+        elem_type, elements = value
+        if len(elements) < 15:
+            header = bytes([(len(elements) << 4) | elem_type])
+        else:
+            header = bytes([0xF0 | elem_type]) + varint(len(elements))
+        if elem_type == T_TRUE:
+            return header + b''.join(bytes([1 if e else 2]) for e in elements)
+        return header + b''.join(encode_value(elem_type, e) for e in elements)
+    raise Exception('unsupported type')
+
+
+def encode_struct(fields):
+    # fields: list of (field_id, type, value), sorted by field id
+    out = bytearray()
+    last = 0
+    for field_id, ttype, value in fields:
+        if value is None:
+            continue
+        if ttype == T_TRUE:
+            ttype = T_TRUE if value else T_FALSE
+        delta = field_id - last
+        assert 0 < delta <= 15
+        out.append((delta << 4) | ttype)
+        if ttype not in (T_TRUE, T_FALSE):
+            out += encode_value(ttype, value)
+        last = field_id
+    out.append(0)
+    return bytes(out)
+
+
+def rle_run(count, value, width_bytes):
+    return varint(count << 1) + value.to_bytes(width_bytes, 'little')
+
+
+def definition_levels(valid):
+    # one RLE run per value, prefixed with the length (as in data page v1)
+    data = b''.join(rle_run(1, 1 if v else 0, 1) for v in valid)
+    return struct.pack('<I', len(data)) + data
+
+
+def page_header(page_type, size, num_values, encoding):
+    fields = [(1, T_I32, page_type), (2, T_I32, size), (3, T_I32, size)]
+    if page_type == 0:
+        # DataPageHeader: definition levels are RLE (3), repetition levels are RLE (3)
+        fields.append((5, T_STRUCT, [(1, T_I32, num_values), (2, T_I32, encoding), (3, T_I32, 3), (4, T_I32, 3)]))
+    else:
+        fields.append((7, T_STRUCT, [(1, T_I32, num_values), (2, T_I32, encoding)]))
+    return encode_struct(fields)
+
+
+class Column:
+    def __init__(self, name, physical_type, converted_type, values, dictionary=None):
+        self.name = name
+        self.physical_type = physical_type
+        self.converted_type = converted_type
+        self.values = values
+        self.dictionary = dictionary
+
+    def encode_plain(self, v):
+        if self.physical_type == 1:
+            return struct.pack('<i', v)
+        if self.physical_type == 2:
+            return struct.pack('<q', v)
+        b = v.encode('utf8')
+        return struct.pack('<I', len(b)) + b
+
+    def encode_stat(self, v):
+        # statistics are plain encoded values, without the length prefix for strings
+        return v.encode('utf8') if self.physical_type == 6 else self.encode_plain(v)
+
+
+def write_file(path):
+    i_values = list(range(ROWS))
+    s_dictionary = ['str%d' % k for k in range(100)]
+    s_values = ['str%d' % (i % 100) for i in i_values]
+    j_values = [None if (i % 7 == 0 or 2000 <= i < 3000) else i // 10 for i in i_values]
+    columns = [
+        Column('i', 2, None, i_values),
+        Column('s', 6, 0, s_values, s_dictionary),
+        Column('j', 1, None, j_values),
+    ]
+
+    out = bytearray(b'PAR1')
+    row_groups = []
+    indexes = []
+    for rg_start in range(0, ROWS, ROW_GROUP_SIZE):
+        chunks = []
+        for col in columns:
+            chunk_start = len(out)
+            dictionary_offset = None
+            if col.dictionary:
+                dictionary_offset = len(out)
+                data = b''.join(col.encode_plain(v) for v in col.dictionary)
+                out += page_header(2, len(data), len(col.dictionary), 0) + data
+            data_offset = len(out)
+            page_locations = []
+            null_pages, min_values, max_values, null_counts = [], [], [], []
+            for page_start in range(rg_start, rg_start + ROW_GROUP_SIZE, PAGE_SIZE):
+                values = col.values[page_start : page_start + PAGE_SIZE]
+                valid = [v is not None for v in values]
+                data = definition_levels(valid)
+                non_null = [v for v in values if v is not None]
+                if col.dictionary:
+                    # RLE_DICTIONARY: bit width followed by one RLE run per value
+                    data += bytes([7]) + b''.join(rle_run(1, col.dictionary.index(v), 1) for v in non_null)
+                    encoding = 8
+                else:
+                    data += b''.join(col.encode_plain(v) for v in non_null)
+                    encoding = 0
+                page_offset = len(out)
+                out += page_header(0, len(data), len(values), encoding) + data
+                page_locations.append(
+                    [(1, T_I64, page_offset), (2, T_I32, len(out) - page_offset), (3, T_I64, page_start - rg_start)]
+                )
+                null_pages.append(len(non_null) == 0)
+                null_counts.append(len(values) - len(non_null))
+                min_values.append(col.encode_stat(min(non_null)) if non_null else b'')
+                max_values.append(col.encode_stat(max(non_null)) if non_null else b'')
+            chunk_values = [v for v in col.values[rg_start : rg_start + ROW_GROUP_SIZE] if v is not None]
+            chunk_size = len(out) - chunk_start
+            statistics = [
+                (3, T_I64, ROW_GROUP_SIZE - len(chunk_values)),
+                (5, T_BINARY, col.encode_stat(max(chunk_values))),
+                (6, T_BINARY, col.encode_stat(min(chunk_values))),
+            ]
+            meta_data = [
+                (1, T_I32, col.physical_type),
+                (2, T_LIST, (T_I32, [0, 3, 8] if col.dictionary else [0, 3])),
+                (3, T_LIST, (T_BINARY, [col.name])),
+                (4, T_I32, 0),
+                (5, T_I64, ROW_GROUP_SIZE),
+                (6, T_I64, chunk_size),
+                (7, T_I64, chunk_size),
+                (9, T_I64, data_offset),
+                (11, T_I64, dictionary_offset),
+                (12, T_STRUCT, statistics),
+            ]
+            column_index = [
+                (1, T_LIST, (T_TRUE, null_pages)),
+                (2, T_LIST, (T_BINARY, min_values)),
+                (3, T_LIST, (T_BINARY, max_values)),
+                (4, T_I32, 1 if col.name == 'i' else 0),
+                (5, T_LIST, (T_I64, null_counts)),
+            ]
+            offset_index = [(1, T_LIST, (T_STRUCT, page_locations))]
+            chunk = {'meta_data': meta_data, 'file_offset': chunk_start}
+            chunks.append(chunk)
+            indexes.append((chunk, encode_struct(column_index), encode_struct(offset_index)))
+        row_groups.append((chunks, rg_start))
+
+    # the column indexes and offset indexes are written after all row groups, before the footer
+    for chunk, column_index, _ in indexes:
+        chunk['column_index'] = (len(out), len(column_index))
+        out += column_index
+    for chunk, _, offset_index in indexes:
+        chunk['offset_index'] = (len(out), len(offset_index))
+        out += offset_index
+
+    encoded_row_groups = []
+    for chunks, rg_start in row_groups:
+        encoded_chunks = []
+        total_size = 0
+        for chunk in chunks:
+            total_size += dict((f[0], f[2]) for f in chunk['meta_data'])[7]
+            encoded_chunks.append(
+                [
+                    (2, T_I64, chunk['file_offset']),
+                    (3, T_STRUCT, chunk['meta_data']),
+                    (4, T_I64, chunk['offset_index'][0]),
+                    (5, T_I32, chunk['offset_index'][1]),
+                    (6, T_I64, chunk['column_index'][0]),
+                    (7, T_I32, chunk['column_index'][1]),
+                ]
+            )
+        encoded_row_groups.append(
+            [(1, T_LIST, (T_STRUCT, encoded_chunks)), (2, T_I64, total_size), (3, T_I64, ROW_GROUP_SIZE)]
+        )
+
+    schema = [[(4, T_BINARY, 'schema'), (5, T_I32, len(columns))]]
+    for col in columns:
+        schema.append(
+            [(1, T_I32, col.physical_type), (3, T_I32, 1), (4, T_BINARY, col.name), (6, T_I32, col.converted_type)]
+        )
+    footer = encode_struct(
+        [
+            (1, T_I32, 1),
+            (2, T_LIST, (T_STRUCT, schema)),
+            (3, T_I64, ROWS),
+            (4, T_LIST, (T_STRUCT, encoded_row_groups)),
+            (6, T_BINARY, 'page_index.py'),
+        ]
+    )
+    out += footer + struct.pack('<I', len(footer)) + b'PAR1'
+    with open(path, 'wb') as f:
+        f.write(out)
+
+
+if __name__ == '__main__':
+    write_file('page_index.parquet')
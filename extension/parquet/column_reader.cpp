@@ -151,6 +151,145 @@ void ColumnReader::RegisterPrefetch(ThriftFileTransport &transport, bool allow_m
 	}
 }
 
+void ColumnReader::RegisterPagePrefetch(ThriftFileTransport &transport, const vector<ParquetRowRange> &skip_ranges,
+                                        bool allow_merge) {
+	if (!CanUsePageIndex() || !LoadOffsetIndex()) {
+		RegisterPrefetch(transport, allow_merge);
+		return;
+	}
+	auto &page_locations = offset_index->page_locations;
+	// the dictionary page (if any) precedes the first data page
+	auto file_offset = FileOffset();
+	auto first_page_offset = NumericCast<idx_t>(page_locations[0].offset);
+	if (file_offset < first_page_offset) {
+		transport.RegisterPrefetch(file_offset, first_page_offset - file_offset, allow_merge);
+	}
+	// register the consecutive runs of pages that contain at least one row that is not skipped
+	idx_t range_idx = 0;
+	idx_t run_start = 0;
+	idx_t run_end = 0;
+	for (idx_t page_idx = 0; page_idx < page_locations.size(); page_idx++) {
+		auto &page = page_locations[page_idx];
+		auto page_start = NumericCast<idx_t>(page.first_row_index);
+		auto page_end = page_idx + 1 < page_locations.size()
+		                    ? NumericCast<idx_t>(page_locations[page_idx + 1].first_row_index)
+		                    : NumericCast<idx_t>(chunk->meta_data.num_values);
+		while (range_idx < skip_ranges.size() && skip_ranges[range_idx].end <= page_start) {
+			range_idx++;
+		}
+		bool skip_page = range_idx < skip_ranges.size() && skip_ranges[range_idx].start <= page_start &&
+		                 skip_ranges[range_idx].end >= page_end;
+		if (skip_page) {
+			continue;
+		}
+		auto page_offset = NumericCast<idx_t>(page.offset);
+		if (run_end != page_offset) {
+			if (run_end > run_start) {
+				transport.RegisterPrefetch(run_start, run_end - run_start, allow_merge);
+			}
+			run_start = page_offset;
+		}
+		run_end = page_offset + NumericCast<idx_t>(page.compressed_page_size);
+	}
+	if (run_end > run_start) {
+		transport.RegisterPrefetch(run_start, run_end - run_start, allow_merge);
+	}
+}
+
+bool ColumnReader::CanUsePageIndex() {
+	// the page index of nested columns is indexed by top-level rows - we only use it for flat columns
+	// the page index of encrypted files is encrypted with different keys than the pages themselves
+	return chunk && !HasRepeats() && !reader.parquet_options.encryption_config;
+}
+
+bool ColumnReader::LoadOffsetIndex() {
+	if (offset_index_loaded) {
+		return offset_index != nullptr;
+	}
+	offset_index_loaded = true;
+	if (!chunk->__isset.offset_index_offset || !chunk->__isset.offset_index_length ||
+	    chunk->offset_index_offset < 0 || chunk->offset_index_length < 0) {
+		return false;
+	}
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	auto index_offset = NumericCast<idx_t>(chunk->offset_index_offset);
+	auto index_length = NumericCast<idx_t>(chunk->offset_index_length);
+	if (index_offset + index_length > trans.GetSize()) {
+		throw InvalidInputException("Malformed parquet file: offset index is outside of the file");
+	}
+	trans.Prefetch(index_offset, index_length);
+	trans.SetLocation(index_offset);
+	auto result = make_uniq<duckdb_parquet::format::OffsetIndex>();
+	reader.Read(*result, *protocol);
+
+	// verify the page locations are consistent with the column chunk - if not we don't use them
+	auto &page_locations = result->page_locations;
+	if (page_locations.empty() || page_locations[0].first_row_index != 0) {
+		return false;
+	}
+	auto chunk_start = FileOffset();
+	auto chunk_end = chunk_start + chunk->meta_data.total_compressed_size;
+	for (idx_t page_idx = 0; page_idx < page_locations.size(); page_idx++) {
+		auto &page = page_locations[page_idx];
+		if (page.offset < 0 || page.compressed_page_size < 0 || NumericCast<idx_t>(page.offset) < chunk_start ||
+		    NumericCast<idx_t>(page.offset + page.compressed_page_size) > chunk_end) {
+			return false;
+		}
+		if (page.first_row_index >= chunk->meta_data.num_values) {
+			return false;
+		}
+		if (page_idx > 0 && page.first_row_index <= page_locations[page_idx - 1].first_row_index) {
+			return false;
+		}
+	}
+	offset_index = std::move(result);
+	return true;
+}
+
+bool ColumnReader::PrunePages(TableFilter &filter, vector<ParquetRowRange> &pruned_ranges) {
+	if (!CanUsePageIndex() || !chunk->__isset.column_index_offset || !chunk->__isset.column_index_length ||
+	    chunk->column_index_offset < 0 || chunk->column_index_length < 0) {
+		return false;
+	}
+	if (!LoadOffsetIndex()) {
+		return false;
+	}
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	auto index_offset = NumericCast<idx_t>(chunk->column_index_offset);
+	auto index_length = NumericCast<idx_t>(chunk->column_index_length);
+	if (index_offset + index_length > trans.GetSize()) {
+		throw InvalidInputException("Malformed parquet file: column index is outside of the file");
+	}
+	trans.Prefetch(index_offset, index_length);
+	trans.SetLocation(index_offset);
+	duckdb_parquet::format::ColumnIndex column_index;
+	reader.Read(column_index, *protocol);
+
+	auto &page_locations = offset_index->page_locations;
+	auto page_count = page_locations.size();
+	if (column_index.null_pages.size() != page_count || column_index.min_values.size() != page_count ||
+	    column_index.max_values.size() != page_count ||
+	    (column_index.__isset.null_counts && column_index.null_counts.size() != page_count)) {
+		return false;
+	}
+	for (idx_t page_idx = 0; page_idx < page_count; page_idx++) {
+		auto stats = ParquetStatisticsUtils::TransformPageStatistics(*this, column_index, page_idx);
+		if (!stats || filter.CheckStatistics(*stats) != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			continue;
+		}
+		ParquetRowRange range;
+		range.start = NumericCast<idx_t>(page_locations[page_idx].first_row_index);
+		range.end = page_idx + 1 < page_count ? NumericCast<idx_t>(page_locations[page_idx + 1].first_row_index)
+		                                      : NumericCast<idx_t>(chunk->meta_data.num_values);
+		if (!pruned_ranges.empty() && pruned_ranges.back().end == range.start) {
+			pruned_ranges.back().end = range.end;
+		} else {
+			pruned_ranges.push_back(range);
+		}
+	}
+	return true;
+}
+
 uint64_t ColumnReader::TotalCompressedSize() {
 	if (!chunk) {
 		return 0;
@@ -236,6 +375,9 @@ void ColumnReader::InitializeRead(idx_t row_group_idx_p, const vector<ColumnChun
 		chunk_read_offset = chunk->meta_data.dictionary_page_offset;
 	}
 	group_rows_available = chunk->meta_data.num_values;
+	pending_skips = 0;
+	offset_index.reset();
+	offset_index_loaded = false;
 }
 
 void ColumnReader::PrepareRead(parquet_filter_t &filter) {
@@ -582,9 +724,52 @@ void ColumnReader::Skip(idx_t num_values) {
 	pending_skips += num_values;
 }
 
+idx_t ColumnReader::SkipPages(idx_t num_values) {
+	if (num_values <= page_rows_available || !CanUsePageIndex() || !LoadOffsetIndex()) {
+		return num_values;
+	}
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	auto &page_locations = offset_index->page_locations;
+	auto first_page_offset = NumericCast<idx_t>(page_locations[0].offset);
+	if (chunk_read_offset < first_page_offset) {
+		// we have not read the dictionary page yet - we need to do so before seeking past it
+		trans.SetLocation(chunk_read_offset);
+		while (page_rows_available == 0 && trans.GetLocation() < first_page_offset) {
+			PrepareRead(none_filter);
+		}
+		chunk_read_offset = trans.GetLocation();
+		if (num_values <= page_rows_available) {
+			return num_values;
+		}
+	}
+	// find the last page that starts at or before the first row we are interested in
+	auto current_row = NumericCast<idx_t>(chunk->meta_data.num_values) - group_rows_available;
+	auto target_row = current_row + num_values;
+	auto entry = std::upper_bound(page_locations.begin(), page_locations.end(), target_row,
+	                              [](idx_t row, const duckdb_parquet::format::PageLocation &page) {
+		                              return row < NumericCast<idx_t>(page.first_row_index);
+	                              });
+	D_ASSERT(entry != page_locations.begin());
+	--entry;
+	auto page_start = NumericCast<idx_t>(entry->first_row_index);
+	if (page_start <= current_row) {
+		// the first row we are interested in is on the current page
+		return num_values;
+	}
+	// seek directly to the page - the pages in between are never read
+	chunk_read_offset = NumericCast<idx_t>(entry->offset);
+	trans.SetLocation(chunk_read_offset);
+	page_rows_available = 0;
+	group_rows_available -= page_start - current_row;
+	return target_row - page_start;
+}
+
 void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 	pending_skips -= num_values;
 
+	// skip over entire pages using the offset index where possible
+	num_values = SkipPages(num_values);
+
 	dummy_define.zero();
 	dummy_repeat.zero();
 
@@ -1107,6 +1292,13 @@ void StructColumnReader::RegisterPrefetch(ThriftFileTransport &transport, bool a
 	}
 }
 
+void StructColumnReader::RegisterPagePrefetch(ThriftFileTransport &transport,
+                                              const vector<ParquetRowRange> &skip_ranges, bool allow_merge) {
+	for (auto &child : child_readers) {
+		child->RegisterPagePrefetch(transport, skip_ranges, allow_merge);
+	}
+}
+
 uint64_t StructColumnReader::TotalCompressedSize() {
 	uint64_t size = 0;
 	for (auto &child : child_readers) {
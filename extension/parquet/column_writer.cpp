@@ -1,6 +1,7 @@
 #include "column_writer.hpp"
 
 #include "duckdb.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_rle_bp_decoder.hpp"
 #include "parquet_rle_bp_encoder.hpp"
 #include "parquet_writer.hpp"
@@ -485,6 +486,9 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 
 	// set up the page write info
 	state.stats_state = InitializeStatsState();
+	if (writer.HasBloomFilter(schema_idx)) {
+		state.stats_state->bloom_filter_hashes = make_uniq<unordered_set<uint64_t>>();
+	}
 	for (idx_t page_idx = 0; page_idx < state.page_info.size(); page_idx++) {
 		auto &page_info = state.page_info[page_idx];
 		if (page_info.row_count == 0) {
@@ -715,6 +719,21 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 	}
 	column_chunk.meta_data.total_compressed_size = column_writer.GetTotalWritten() - start_offset;
 	column_chunk.meta_data.total_uncompressed_size = total_uncompressed_size;
+
+	// write the bloom filter (if any) directly after the column chunk
+	if (state.stats_state->bloom_filter_hashes) {
+		auto &hashes = *state.stats_state->bloom_filter_hashes;
+		ParquetBloomFilter bloom_filter(hashes.size(), ParquetBloomFilter::DEFAULT_FALSE_POSITIVE_RATIO);
+		for (auto &hash : hashes) {
+			bloom_filter.Insert(hash);
+		}
+		auto bloom_filter_offset = column_writer.GetTotalWritten();
+		writer.Write(bloom_filter.CreateHeader());
+		writer.WriteData(bloom_filter.Data(), NumericCast<uint32_t>(bloom_filter.Size()));
+		column_chunk.meta_data.__set_bloom_filter_offset(NumericCast<int64_t>(bloom_filter_offset));
+		column_chunk.meta_data.__set_bloom_filter_length(
+		    NumericCast<int32_t>(column_writer.GetTotalWritten() - bloom_filter_offset));
+	}
 }
 
 void BasicColumnWriter::FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats) {
@@ -801,6 +820,9 @@ struct BaseParquetOperator {
 		if (GreaterThan::Operation(target_value, numeric_stats.max)) {
 			numeric_stats.max = target_value;
 		}
+		if (numeric_stats.bloom_filter_hashes) {
+			numeric_stats.bloom_filter_hashes->insert(ParquetBloomFilter::Hash<TGT>(target_value));
+		}
 	}
 };
 
@@ -1207,6 +1229,9 @@ public:
 	}
 
 	void Update(const string_t &val) {
+		if (bloom_filter_hashes) {
+			bloom_filter_hashes->insert(ParquetBloomFilter::Hash(const_data_ptr_cast(val.GetData()), val.GetSize()));
+		}
 		if (values_too_big) {
 			return;
 		}
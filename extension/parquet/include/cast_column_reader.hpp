@@ -45,6 +45,11 @@ public:
 	void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge) override {
 		child_reader->RegisterPrefetch(transport, allow_merge);
 	}
+
+	void RegisterPagePrefetch(ThriftFileTransport &transport, const vector<ParquetRowRange> &skip_ranges,
+	                          bool allow_merge) override {
+		child_reader->RegisterPagePrefetch(transport, skip_ranges, allow_merge);
+	}
 };
 
 } // namespace duckdb
@@ -22,6 +22,7 @@
 #include "duckdb/common/types/string_type.hpp"
 #include "duckdb/common/types/vector.hpp"
 #include "duckdb/common/types/vector_cache.hpp"
+#include "duckdb/planner/table_filter.hpp"
 #endif
 
 namespace duckdb {
@@ -38,6 +39,12 @@ using duckdb_parquet::format::Type;
 
 typedef std::bitset<STANDARD_VECTOR_SIZE> parquet_filter_t;
 
+//! A range of rows [start, end) within a row group
+struct ParquetRowRange {
+	idx_t start;
+	idx_t end;
+};
+
 class ColumnReader {
 public:
 	ColumnReader(ParquetReader &reader, LogicalType type_p, const SchemaElement &schema_p, idx_t file_idx_p,
@@ -67,6 +74,12 @@ public:
 
 	// register the range this reader will touch for prefetching
 	virtual void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge);
+	// register only the pages this reader will touch for prefetching, given the row ranges that will be skipped
+	virtual void RegisterPagePrefetch(ThriftFileTransport &transport, const vector<ParquetRowRange> &skip_ranges,
+	                                  bool allow_merge);
+	// use the page index of the column chunk to find the row ranges for which the filter is always false
+	// returns false if the column chunk has no (usable) page index
+	bool PrunePages(TableFilter &filter, vector<ParquetRowRange> &pruned_ranges);
 
 	virtual unique_ptr<BaseStatistics> Stats(idx_t row_group_idx_p, const vector<ColumnChunk> &columns);
 
@@ -143,8 +156,15 @@ private:
 	void PreparePageV2(PageHeader &page_hdr);
 	void DecompressInternal(CompressionCodec::type codec, const_data_ptr_t src, idx_t src_size, data_ptr_t dst,
 	                        idx_t dst_size);
+	bool CanUsePageIndex();
+	bool LoadOffsetIndex();
+	// seeks to the page that contains the row after the skipped rows, returns the amount of rows still to be skipped
+	idx_t SkipPages(idx_t num_values);
 
 	const duckdb_parquet::format::ColumnChunk *chunk = nullptr;
+	// the offset index of the column chunk (if any), loaded on first use
+	unique_ptr<duckdb_parquet::format::OffsetIndex> offset_index;
+	bool offset_index_loaded = false;
 
 	duckdb_apache::thrift::protocol::TProtocol *protocol;
 	idx_t page_rows_available;
@@ -50,6 +50,9 @@ public:
 	virtual string GetMinValue();
 	virtual string GetMaxValue();
 
+	//! The hashes of the values written to the column chunk - only collected if we write a bloom filter
+	unique_ptr<unordered_set<uint64_t>> bloom_filter_hashes;
+
 public:
 	template <class TARGET>
 	TARGET &Cast() {
@@ -0,0 +1,74 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/planner/table_filter.hpp"
+#endif
+#include "parquet_types.h"
+
+namespace duckdb {
+
+//! A split block bloom filter (SBBF) as defined by the Parquet format specification. The filter consists of blocks of
+//! 256 bits, every value sets (and checks) a single bit in each of the eight 32-bit words of one block
+class ParquetBloomFilter {
+public:
+	//! Creates an empty bloom filter sized for the given number of distinct values and false positive ratio
+	ParquetBloomFilter(idx_t num_distinct_values, double false_positive_ratio);
+	//! Creates a bloom filter from the bitset of a bloom filter stored in a Parquet file
+	explicit ParquetBloomFilter(vector<uint32_t> bitset);
+
+	//! The size of a block in bytes
+	static constexpr const idx_t BLOCK_SIZE = 32;
+	//! The minimum and maximum size of a bloom filter in bytes
+	static constexpr const idx_t MINIMUM_BLOOM_FILTER_SIZE = BLOCK_SIZE;
+	static constexpr const idx_t MAXIMUM_BLOOM_FILTER_SIZE = 128 * 1024 * 1024;
+	//! The false positive ratio of the bloom filters we write
+	static constexpr const double DEFAULT_FALSE_POSITIVE_RATIO = 0.01;
+
+public:
+	void Insert(uint64_t hash);
+	bool Check(uint64_t hash) const;
+
+	const_data_ptr_t Data() const {
+		return const_data_ptr_cast(bitset.data());
+	}
+	idx_t Size() const {
+		return bitset.size() * sizeof(uint32_t);
+	}
+
+	//! Hashes a value with XXH64 - values are hashed in their plain encoding (without the length for strings)
+	static uint64_t Hash(const_data_ptr_t data, idx_t size);
+	template <class T>
+	static uint64_t Hash(T value) {
+		return Hash(const_data_ptr_cast(&value), sizeof(T));
+	}
+
+	//! Creates the header that precedes the bitset in the file
+	duckdb_parquet::format::BloomFilterHeader CreateHeader() const;
+	//! Verifies that a bloom filter header describes a bloom filter that we can read
+	static bool IsSupported(const duckdb_parquet::format::BloomFilterHeader &header);
+
+	//! Whether or not the bloom filter of a column with the given type can be used to evaluate the filter - only
+	//! (combinations of) equality and IN filters can be evaluated
+	static bool SupportsFilter(const TableFilter &filter, const LogicalType &type,
+	                           duckdb_parquet::format::Type::type parquet_type);
+	//! Returns true if no value in the bloom filter can satisfy the filter
+	bool FilterIsAlwaysFalse(const TableFilter &filter, const LogicalType &type,
+	                         duckdb_parquet::format::Type::type parquet_type) const;
+
+private:
+	bool CheckValue(const Value &value, duckdb_parquet::format::Type::type parquet_type) const;
+
+private:
+	vector<uint32_t> bitset;
+};
+
+} // namespace duckdb
@@ -63,6 +63,11 @@ struct ParquetReaderScanState {
 
 	bool prefetch_mode = false;
 	bool current_group_prefetched = false;
+
+	//! The sorted row ranges of the current row group that were pruned using the page index
+	vector<ParquetRowRange> skip_ranges;
+	//! The next range of skip_ranges that has not been skipped yet
+	idx_t current_skip_range = 0;
 };
 
 struct ParquetColumnDefinition {
@@ -162,6 +167,11 @@ private:
 	// Group span is the distance between the min page offset and the max page offset plus the max page compressed size
 	uint64_t GetGroupSpan(ParquetReaderScanState &state);
 	void PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t out_col_idx);
+	//! Use the page index of the filtered columns to find the rows of the current row group that can be skipped
+	void PrunePages(ParquetReaderScanState &state);
+	//! Probe the bloom filter of a column chunk (if any) to find out whether the chunk can be skipped
+	bool BloomFilterIsAlwaysFalse(ParquetReaderScanState &state, ColumnReader &column_reader,
+	                              const vector<ColumnChunk> &columns, TableFilter &filter);
 	LogicalType DeriveLogicalType(const SchemaElement &s_ele);
 
 	template <typename... Args>
@@ -18,6 +18,13 @@ struct ParquetStatisticsUtils {
 
 	static unique_ptr<BaseStatistics> TransformColumnStatistics(const ColumnReader &reader,
 	                                                            const vector<ColumnChunk> &columns);
+	//! Transforms the min/max of a single page stored in the column index of a column chunk
+	static unique_ptr<BaseStatistics> TransformPageStatistics(const ColumnReader &reader,
+	                                                          const duckdb_parquet::format::ColumnIndex &column_index,
+	                                                          idx_t page_idx);
+	//! Transforms a set of (chunk or page) parquet statistics into statistics of the type of the column reader
+	static unique_ptr<BaseStatistics> TransformStatistics(const ColumnReader &reader,
+	                                                      const duckdb_parquet::format::Statistics &parquet_stats);
 
 	static Value ConvertValue(const LogicalType &type, const duckdb_parquet::format::SchemaElement &schema_ele,
 	                          const std::string &stats);
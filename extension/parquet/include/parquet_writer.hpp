@@ -15,6 +15,7 @@
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/common/serializer/buffered_file_writer.hpp"
 #include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/common/unordered_set.hpp"
 #include "duckdb/function/copy_function.hpp"
 #endif
 
@@ -65,7 +66,7 @@ public:
 	              duckdb_parquet::format::CompressionCodec::type codec, ChildFieldIDs field_ids,
 	              const vector<pair<string, string>> &kv_metadata,
 	              shared_ptr<ParquetEncryptionConfig> encryption_config, double dictionary_compression_ratio_threshold,
-	              optional_idx compression_level);
+	              optional_idx compression_level, const vector<string> &bloom_filter_columns);
 
 public:
 	void PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result);
@@ -98,6 +99,10 @@ public:
 	optional_idx CompressionLevel() const {
 		return compression_level;
 	}
+	//! Whether or not a bloom filter is written for the column with the given schema index
+	bool HasBloomFilter(idx_t schema_idx) const {
+		return bloom_filter_schema_indexes.find(schema_idx) != bloom_filter_schema_indexes.end();
+	}
 
 	static CopyTypeSupport TypeIsSupported(const LogicalType &type);
 
@@ -115,6 +120,8 @@ private:
 	shared_ptr<ParquetEncryptionConfig> encryption_config;
 	double dictionary_compression_ratio_threshold;
 	optional_idx compression_level;
+	//! The schema indexes of the columns for which we write bloom filters
+	unordered_set<idx_t> bloom_filter_schema_indexes;
 
 	unique_ptr<BufferedFileWriter> writer;
 	std::shared_ptr<duckdb_apache::thrift::protocol::TProtocol> protocol;
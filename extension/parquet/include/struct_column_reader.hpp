@@ -35,6 +35,8 @@ public:
 	idx_t GroupRowsAvailable() override;
 	uint64_t TotalCompressedSize() override;
 	void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge) override;
+	void RegisterPagePrefetch(ThriftFileTransport &transport, const vector<ParquetRowRange> &skip_ranges,
+	                          bool allow_merge) override;
 };
 
 } // namespace duckdb
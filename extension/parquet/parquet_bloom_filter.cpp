@@ -0,0 +1,246 @@
+#include "parquet_bloom_filter.hpp"
+
+#include "zstd/common/xxhash.h"
+
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
+#endif
+
+#include <cmath>
+
+namespace duckdb {
+
+using duckdb_parquet::format::BloomFilterHeader;
+using duckdb_parquet::format::Type;
+
+//! The salts used to derive the bit that is set in each word of a block, see the Parquet specification
+static constexpr const uint32_t BLOOM_FILTER_SALT[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                                        0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+static constexpr const idx_t BLOOM_FILTER_BLOCK_WORDS = 8;
+
+static idx_t OptimalBloomFilterSize(idx_t num_distinct_values, double false_positive_ratio) {
+	// the number of bits required for the given false positive ratio (see the Parquet specification)
+	auto bits = -8.0 * double(num_distinct_values) / std::log(1.0 - std::pow(false_positive_ratio, 1.0 / 8.0));
+	auto bytes = idx_t(bits / 8.0);
+	// the number of bytes is rounded up to a power of two
+	idx_t result = ParquetBloomFilter::MINIMUM_BLOOM_FILTER_SIZE;
+	while (result < bytes && result < ParquetBloomFilter::MAXIMUM_BLOOM_FILTER_SIZE) {
+		result *= 2;
+	}
+	return result;
+}
+
+ParquetBloomFilter::ParquetBloomFilter(idx_t num_distinct_values, double false_positive_ratio) {
+	auto size = OptimalBloomFilterSize(num_distinct_values, false_positive_ratio);
+	bitset.resize(size / sizeof(uint32_t), 0);
+}
+
+ParquetBloomFilter::ParquetBloomFilter(vector<uint32_t> bitset_p) : bitset(std::move(bitset_p)) {
+	D_ASSERT(!bitset.empty() && bitset.size() % BLOOM_FILTER_BLOCK_WORDS == 0);
+}
+
+static inline idx_t BloomFilterBlockIndex(uint64_t hash, idx_t num_blocks) {
+	// the upper 32 bits of the hash select the block
+	return idx_t(((hash >> 32) * num_blocks) >> 32);
+}
+
+static inline uint32_t BloomFilterMask(uint64_t hash, idx_t word_idx) {
+	// the lower 32 bits of the hash select the bit within each word of the block
+	return 1U << ((uint32_t(hash) * BLOOM_FILTER_SALT[word_idx]) >> 27);
+}
+
+void ParquetBloomFilter::Insert(uint64_t hash) {
+	auto block = bitset.data() + BloomFilterBlockIndex(hash, bitset.size() / BLOOM_FILTER_BLOCK_WORDS) *
+	                                 BLOOM_FILTER_BLOCK_WORDS;
+	for (idx_t word_idx = 0; word_idx < BLOOM_FILTER_BLOCK_WORDS; word_idx++) {
+		block[word_idx] |= BloomFilterMask(hash, word_idx);
+	}
+}
+
+bool ParquetBloomFilter::Check(uint64_t hash) const {
+	auto block = bitset.data() + BloomFilterBlockIndex(hash, bitset.size() / BLOOM_FILTER_BLOCK_WORDS) *
+	                                 BLOOM_FILTER_BLOCK_WORDS;
+	for (idx_t word_idx = 0; word_idx < BLOOM_FILTER_BLOCK_WORDS; word_idx++) {
+		if (!(block[word_idx] & BloomFilterMask(hash, word_idx))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+uint64_t ParquetBloomFilter::Hash(const_data_ptr_t data, idx_t size) {
+	return duckdb_zstd::XXH64(data, size, 0);
+}
+
+BloomFilterHeader ParquetBloomFilter::CreateHeader() const {
+	BloomFilterHeader header;
+	header.numBytes = NumericCast<int32_t>(Size());
+	header.algorithm.__set_BLOCK(duckdb_parquet::format::SplitBlockAlgorithm());
+	header.hash.__set_XXHASH(duckdb_parquet::format::XxHash());
+	header.compression.__set_UNCOMPRESSED(duckdb_parquet::format::Uncompressed());
+	return header;
+}
+
+bool ParquetBloomFilter::IsSupported(const BloomFilterHeader &header) {
+	if (!header.algorithm.__isset.BLOCK || !header.hash.__isset.XXHASH || !header.compression.__isset.UNCOMPRESSED) {
+		return false;
+	}
+	if (header.numBytes < int32_t(MINIMUM_BLOOM_FILTER_SIZE) || header.numBytes > int32_t(MAXIMUM_BLOOM_FILTER_SIZE) ||
+	    header.numBytes % BLOCK_SIZE != 0) {
+		return false;
+	}
+	return true;
+}
+
+static bool SupportsType(const LogicalType &type, Type::type parquet_type) {
+	switch (parquet_type) {
+	case Type::INT32:
+	case Type::INT64:
+		switch (type.id()) {
+		case LogicalTypeId::TINYINT:
+		case LogicalTypeId::SMALLINT:
+		case LogicalTypeId::INTEGER:
+		case LogicalTypeId::BIGINT:
+		case LogicalTypeId::UTINYINT:
+		case LogicalTypeId::USMALLINT:
+		case LogicalTypeId::UINTEGER:
+		case LogicalTypeId::UBIGINT:
+			return true;
+		case LogicalTypeId::DATE:
+			return parquet_type == Type::INT32;
+		default:
+			return false;
+		}
+	case Type::BYTE_ARRAY:
+		return type.id() == LogicalTypeId::VARCHAR || type.id() == LogicalTypeId::BLOB;
+	default:
+		return false;
+	}
+}
+
+bool ParquetBloomFilter::SupportsFilter(const TableFilter &filter, const LogicalType &type, Type::type parquet_type) {
+	if (!SupportsType(type, parquet_type)) {
+		return false;
+	}
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		return constant_filter.comparison_type == ExpressionType::COMPARE_EQUAL &&
+		       constant_filter.constant.type() == type;
+	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		return in_filter.values[0].type() == type;
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		// a conjunction can be pruned if any of its children can be pruned
+		auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : and_filter.child_filters) {
+			if (SupportsFilter(*child_filter, type, parquet_type)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		// a disjunction can only be pruned if all of its children can be pruned
+		auto &or_filter = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : or_filter.child_filters) {
+			if (!SupportsFilter(*child_filter, type, parquet_type)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+bool ParquetBloomFilter::CheckValue(const Value &value, Type::type parquet_type) const {
+	if (parquet_type == Type::BYTE_ARRAY) {
+		auto &str = StringValue::Get(value);
+		return Check(Hash(const_data_ptr_cast(str.c_str()), str.size()));
+	}
+	// integers are hashed in their physical representation - unsigned values are stored in the signed types
+	int64_t integer_value;
+	switch (value.type().id()) {
+	case LogicalTypeId::TINYINT:
+		integer_value = value.GetValueUnsafe<int8_t>();
+		break;
+	case LogicalTypeId::SMALLINT:
+		integer_value = value.GetValueUnsafe<int16_t>();
+		break;
+	case LogicalTypeId::INTEGER:
+		integer_value = value.GetValueUnsafe<int32_t>();
+		break;
+	case LogicalTypeId::BIGINT:
+		integer_value = value.GetValueUnsafe<int64_t>();
+		break;
+	case LogicalTypeId::UTINYINT:
+		integer_value = value.GetValueUnsafe<uint8_t>();
+		break;
+	case LogicalTypeId::USMALLINT:
+		integer_value = value.GetValueUnsafe<uint16_t>();
+		break;
+	case LogicalTypeId::UINTEGER:
+		integer_value = value.GetValueUnsafe<uint32_t>();
+		break;
+	case LogicalTypeId::UBIGINT:
+		integer_value = int64_t(value.GetValueUnsafe<uint64_t>());
+		break;
+	case LogicalTypeId::DATE:
+		integer_value = value.GetValueUnsafe<date_t>().days;
+		break;
+	default:
+		throw InternalException("Unsupported type for parquet bloom filter");
+	}
+	if (parquet_type == Type::INT32) {
+		return Check(Hash<int32_t>(int32_t(integer_value)));
+	}
+	return Check(Hash<int64_t>(integer_value));
+}
+
+bool ParquetBloomFilter::FilterIsAlwaysFalse(const TableFilter &filter, const LogicalType &type,
+                                             Type::type parquet_type) const {
+	if (!SupportsFilter(filter, type, parquet_type)) {
+		return false;
+	}
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+		return !CheckValue(filter.Cast<ConstantFilter>().constant, parquet_type);
+	case TableFilterType::IN_FILTER: {
+		for (auto &value : filter.Cast<InFilter>().values) {
+			if (CheckValue(value, parquet_type)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : and_filter.child_filters) {
+			if (FilterIsAlwaysFalse(*child_filter, type, parquet_type)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &or_filter = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : or_filter.child_filters) {
+			if (!FilterIsAlwaysFalse(*child_filter, type, parquet_type)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+} // namespace duckdb
@@ -26,6 +26,7 @@
 #include "duckdb/common/multi_file_reader.hpp"
 #include "duckdb/common/serializer/deserializer.hpp"
 #include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/common/types/decimal.hpp"
 #include "duckdb/function/copy_function.hpp"
 #include "duckdb/function/pragma_function.hpp"
 #include "duckdb/function/table_function.hpp"
@@ -162,6 +163,8 @@ struct ParquetWriteBindData : public TableFunctionData {
 	ChildFieldIDs field_ids;
 	//! The compression level, higher value is more
 	optional_idx compression_level;
+	//! The columns for which split block bloom filters are written
+	vector<string> bloom_filter_columns;
 };
 
 struct ParquetWriteGlobalState : public GlobalFunctionData {
@@ -365,6 +368,8 @@ public:
 		table_function.projection_pushdown = true;
 		table_function.filter_pushdown = true;
 		table_function.filter_prune = true;
+		table_function.dynamic_filter_pushdown = true;
+		table_function.in_filter_pushdown = true;
 		table_function.pushdown_complex_filter = ParquetComplexFilterPushdown;
 
 		MultiFileReader::AddParameters(table_function);
@@ -1057,6 +1062,63 @@ static void GetFieldIDs(const Value &field_ids_value, ChildFieldIDs &field_ids,
 	}
 }
 
+static bool SupportsBloomFilter(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIME_TZ:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_TZ:
+	case LogicalTypeId::TIMESTAMP_MS:
+	case LogicalTypeId::TIMESTAMP_NS:
+	case LogicalTypeId::TIMESTAMP_SEC:
+	case LogicalTypeId::VARCHAR:
+	case LogicalTypeId::BLOB:
+	case LogicalTypeId::ENUM:
+		return true;
+	case LogicalTypeId::DECIMAL:
+		// wide decimals are written as FIXED_LEN_BYTE_ARRAY
+		return DecimalType::GetWidth(type) <= Decimal::MAX_WIDTH_INT64;
+	default:
+		// floating point values have multiple representations of the same value (e.g. -0.0 and 0.0)
+		return false;
+	}
+}
+
+static void GetBloomFilterColumns(const Value &value, const vector<string> &names,
+                                  const vector<LogicalType> &sql_types, vector<string> &result) {
+	if (value.IsNull()) {
+		throw BinderException("BLOOM_FILTER_COLUMNS cannot be NULL");
+	}
+	if (value.type().id() == LogicalTypeId::LIST) {
+		for (auto &child : ListValue::GetChildren(value)) {
+			GetBloomFilterColumns(child, names, sql_types, result);
+		}
+		return;
+	}
+	auto column_name = value.ToString();
+	for (idx_t col_idx = 0; col_idx < names.size(); col_idx++) {
+		if (!StringUtil::CIEquals(names[col_idx], column_name)) {
+			continue;
+		}
+		if (!SupportsBloomFilter(sql_types[col_idx])) {
+			throw BinderException("BLOOM_FILTER_COLUMNS does not support column \"%s\" of type %s", names[col_idx],
+			                      sql_types[col_idx].ToString());
+		}
+		result.push_back(names[col_idx]);
+		return;
+	}
+	throw BinderException("Column \"%s\" in BLOOM_FILTER_COLUMNS not found", column_name);
+}
+
 unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBindInput &input,
                                           const vector<string> &names, const vector<LogicalType> &sql_types) {
 	D_ASSERT(names.size() == sql_types.size());
@@ -1064,6 +1126,13 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 	auto bind_data = make_uniq<ParquetWriteBindData>();
 	for (auto &option : input.info.options) {
 		const auto loption = StringUtil::Lower(option.first);
+		if (loption == "bloom_filter_columns") {
+			// the columns can be given either as a list or as multiple arguments
+			for (auto &value : option.second) {
+				GetBloomFilterColumns(value, names, sql_types, bind_data->bloom_filter_columns);
+			}
+			continue;
+		}
 		if (option.second.size() != 1) {
 			// All parquet write options require exactly one argument
 			throw BinderException("%s requires exactly one argument", StringUtil::Upper(loption));
@@ -1157,6 +1226,9 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 		// We always set a max row group size bytes so we don't use too much memory
 		bind_data->row_group_size_bytes = bind_data->row_group_size * ParquetWriteBindData::BYTES_PER_ROW;
 	}
+	if (!bind_data->bloom_filter_columns.empty() && bind_data->encryption_config) {
+		throw NotImplementedException("BLOOM_FILTER_COLUMNS is not supported for encrypted Parquet files");
+	}
 
 	bind_data->sql_types = sql_types;
 	bind_data->column_names = names;
@@ -1172,7 +1244,8 @@ unique_ptr<GlobalFunctionData> ParquetWriteInitializeGlobal(ClientContext &conte
 	global_state->writer = make_uniq<ParquetWriter>(
 	    fs, file_path, parquet_bind.sql_types, parquet_bind.column_names, parquet_bind.codec,
 	    parquet_bind.field_ids.Copy(), parquet_bind.kv_metadata, parquet_bind.encryption_config,
-	    parquet_bind.dictionary_compression_ratio_threshold, parquet_bind.compression_level);
+	    parquet_bind.dictionary_compression_ratio_threshold, parquet_bind.compression_level,
+	    parquet_bind.bloom_filter_columns);
 	return std::move(global_state);
 }
 
@@ -1294,6 +1367,7 @@ static void ParquetCopySerialize(Serializer &serializer, const FunctionData &bin
 	serializer.WriteProperty(108, "dictionary_compression_ratio_threshold",
 	                         bind_data.dictionary_compression_ratio_threshold);
 	serializer.WritePropertyWithDefault<optional_idx>(109, "compression_level", bind_data.compression_level);
+	serializer.WritePropertyWithDefault<vector<string>>(110, "bloom_filter_columns", bind_data.bloom_filter_columns);
 }
 
 static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserializer, CopyFunction &function) {
@@ -1310,6 +1384,7 @@ static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserialize
 	deserializer.ReadPropertyWithDefault<double>(108, "dictionary_compression_ratio_threshold",
 	                                             data->dictionary_compression_ratio_threshold, 1.0);
 	deserializer.ReadPropertyWithDefault<optional_idx>(109, "compression_level", data->compression_level);
+	deserializer.ReadPropertyWithDefault<vector<string>>(110, "bloom_filter_columns", data->bloom_filter_columns);
 	return std::move(data);
 }
 // LCOV_EXCL_STOP
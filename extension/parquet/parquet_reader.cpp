@@ -6,6 +6,7 @@
 #include "column_reader.hpp"
 #include "duckdb.hpp"
 #include "list_column_reader.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_crypto.hpp"
 #include "parquet_file_metadata_cache.hpp"
 #include "parquet_statistics.hpp"
@@ -25,6 +26,8 @@
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
@@ -653,12 +656,18 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 		// filters contain output chunk index, not file col idx!
 		auto global_id = reader_data.column_mapping[col_idx];
 		auto filter_entry = reader_data.filters->filters.find(global_id);
-		if (stats && filter_entry != reader_data.filters->filters.end()) {
+		if (filter_entry != reader_data.filters->filters.end()) {
 			bool skip_chunk = false;
 			auto &filter = *filter_entry->second;
-			auto prune_result = filter.CheckStatistics(*stats);
-			if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
-				skip_chunk = true;
+			if (stats) {
+				auto prune_result = filter.CheckStatistics(*stats);
+				if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+					skip_chunk = true;
+				}
+			}
+			if (!skip_chunk) {
+				// min/max could not prune the chunk - check the bloom filter for equality filters
+				skip_chunk = BloomFilterIsAlwaysFalse(state, *column_reader, group.columns, filter);
 			}
 			if (skip_chunk) {
 				// this effectively will skip this chunk
@@ -672,6 +681,83 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 	                                  *state.thrift_file_proto);
 }
 
+bool ParquetReader::BloomFilterIsAlwaysFalse(ParquetReaderScanState &state, ColumnReader &column_reader,
+                                             const vector<ColumnChunk> &columns, TableFilter &filter) {
+	if (parquet_options.encryption_config || column_reader.FileIdx() >= columns.size()) {
+		return false;
+	}
+	auto &chunk = columns[column_reader.FileIdx()];
+	auto &meta_data = chunk.meta_data;
+	if (!chunk.__isset.meta_data || !meta_data.__isset.bloom_filter_offset || meta_data.bloom_filter_offset < 0) {
+		return false;
+	}
+	auto &type = column_reader.Type();
+	auto parquet_type = column_reader.Schema().type;
+	if (!ParquetBloomFilter::SupportsFilter(filter, type, parquet_type)) {
+		return false;
+	}
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+	auto bloom_filter_offset = NumericCast<idx_t>(meta_data.bloom_filter_offset);
+	if (meta_data.__isset.bloom_filter_length && meta_data.bloom_filter_length > 0) {
+		auto bloom_filter_length = NumericCast<idx_t>(meta_data.bloom_filter_length);
+		if (bloom_filter_offset + bloom_filter_length > trans.GetSize()) {
+			throw InvalidInputException("Malformed parquet file: bloom filter is outside of the file");
+		}
+		trans.Prefetch(bloom_filter_offset, bloom_filter_length);
+	}
+	trans.SetLocation(bloom_filter_offset);
+	duckdb_parquet::format::BloomFilterHeader header;
+	Read(header, *state.thrift_file_proto);
+	if (!ParquetBloomFilter::IsSupported(header)) {
+		return false;
+	}
+	auto bitset_size = NumericCast<idx_t>(header.numBytes);
+	if (trans.GetLocation() + bitset_size > trans.GetSize()) {
+		throw InvalidInputException("Malformed parquet file: bloom filter is outside of the file");
+	}
+	vector<uint32_t> bitset(bitset_size / sizeof(uint32_t));
+	trans.read(reinterpret_cast<uint8_t *>(bitset.data()), NumericCast<uint32_t>(bitset_size));
+	ParquetBloomFilter bloom_filter(std::move(bitset));
+	return bloom_filter.FilterIsAlwaysFalse(filter, type, parquet_type);
+}
+
+void ParquetReader::PrunePages(ParquetReaderScanState &state) {
+	state.skip_ranges.clear();
+	state.current_skip_range = 0;
+	if (!reader_data.filters || state.group_offset != 0) {
+		return;
+	}
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+	vector<ParquetRowRange> pruned_ranges;
+	for (auto &filter_col : reader_data.filters->filters) {
+		auto filter_entry = reader_data.filter_map[filter_col.first];
+		if (filter_entry.is_constant) {
+			continue;
+		}
+		auto file_col_idx = reader_data.column_ids[filter_entry.index];
+		root_reader.GetChildReader(file_col_idx)->PrunePages(*filter_col.second, pruned_ranges);
+	}
+	if (pruned_ranges.empty()) {
+		return;
+	}
+	// the ranges of the different columns are combined: a row can be skipped if any of the filters is always false
+	std::sort(pruned_ranges.begin(), pruned_ranges.end(),
+	          [](const ParquetRowRange &a, const ParquetRowRange &b) { return a.start < b.start; });
+	for (auto &range : pruned_ranges) {
+		if (!state.skip_ranges.empty() && range.start <= state.skip_ranges.back().end) {
+			state.skip_ranges.back().end = MaxValue<idx_t>(state.skip_ranges.back().end, range.end);
+		} else {
+			state.skip_ranges.push_back(range);
+		}
+	}
+	auto &group = GetGroup(state);
+	if (state.skip_ranges[0].start == 0 && state.skip_ranges[0].end >= (idx_t)group.num_rows) {
+		// all pages can be skipped
+		state.skip_ranges.clear();
+		state.group_offset = group.num_rows;
+	}
+}
+
 idx_t ParquetReader::NumRows() {
 	return GetFileMetadata()->num_rows;
 }
@@ -829,6 +915,23 @@ static void FilterOperationSwitch(Vector &v, Value &constant, parquet_filter_t &
 	}
 }
 
+//! Applies a filter that operates on a selection vector to the rows that are set in the filter mask
+template <class FILTER>
+static void ApplySelectionFilter(parquet_filter_t &filter_mask, idx_t count, FILTER &&filter) {
+	SelectionVector sel(count);
+	idx_t sel_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (filter_mask.test(i)) {
+			sel.set_index(sel_count++, i);
+		}
+	}
+	auto result_count = filter(sel, sel_count);
+	filter_mask.reset();
+	for (idx_t i = 0; i < result_count; i++) {
+		filter_mask.set(sel.get_index(i));
+	}
+}
+
 static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter_mask, idx_t count) {
 	switch (filter.filter_type) {
 	case TableFilterType::CONJUNCTION_AND: {
@@ -883,6 +986,37 @@ static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter
 		auto &child = StructVector::GetEntries(v)[struct_filter.child_idx];
 		ApplyFilter(*child, *struct_filter.child_filter, filter_mask, count);
 	} break;
+	case TableFilterType::DYNAMIC_FILTER: {
+		auto &filter_data = *filter.Cast<DynamicFilter>().filter_data;
+		if (!filter_data.initialized || v.GetType() != filter_data.key_type) {
+			// the filter has not been computed (yet) or was computed on a different type: everything passes
+			break;
+		}
+		{
+			lock_guard<mutex> guard(filter_data.lock);
+			if (filter_data.filter) {
+				ApplyFilter(v, *filter_data.filter, filter_mask, count);
+			}
+		}
+		if (filter_data.CanProbeBloomFilter(v.GetType()) && filter_mask.any()) {
+			ApplySelectionFilter(filter_mask, count, [&](SelectionVector &sel, idx_t sel_count) {
+				return filter_data.ProbeBloomFilter(v, sel, sel_count);
+			});
+		}
+		break;
+	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		if (!filter_mask.any()) {
+			break;
+		}
+		UnifiedVectorFormat vdata;
+		v.ToUnifiedFormat(count, vdata);
+		ApplySelectionFilter(filter_mask, count, [&](SelectionVector &sel, idx_t sel_count) {
+			return in_filter.Select(vdata, sel, sel_count);
+		});
+		break;
+	}
 	default:
 		D_ASSERT(0);
 		break;
@@ -926,6 +1060,7 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 			auto &root_reader = state.root_reader->Cast<StructColumnReader>();
 			to_scan_compressed_bytes += root_reader.GetChildReader(file_col_idx)->TotalCompressedSize();
 		}
+		PrunePages(state);
 
 		auto &group = GetGroup(state);
 		if (state.prefetch_mode && state.group_offset != (idx_t)group.num_rows) {
@@ -964,7 +1099,13 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 						auto entry = reader_data.filters->filters.find(reader_data.column_mapping[col_idx]);
 						has_filter = entry != reader_data.filters->filters.end();
 					}
-					root_reader.GetChildReader(file_col_idx)->RegisterPrefetch(trans, !(lazy_fetch && !has_filter));
+					auto child_reader = root_reader.GetChildReader(file_col_idx);
+					if (state.skip_ranges.empty()) {
+						child_reader->RegisterPrefetch(trans, !(lazy_fetch && !has_filter));
+					} else {
+						// only fetch the pages that contain rows that were not pruned
+						child_reader->RegisterPagePrefetch(trans, state.skip_ranges, !(lazy_fetch && !has_filter));
+					}
 				}
 
 				trans.FinalizeRegistration();
@@ -977,7 +1118,25 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 		return true;
 	}
 
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+
 	auto this_output_chunk_rows = MinValue<idx_t>(STANDARD_VECTOR_SIZE, GetGroup(state).num_rows - state.group_offset);
+	if (state.current_skip_range < state.skip_ranges.size()) {
+		auto &skip_range = state.skip_ranges[state.current_skip_range];
+		if (state.group_offset >= skip_range.start) {
+			// the rows in this range were pruned using the page index: skip them in all columns
+			D_ASSERT(state.group_offset == skip_range.start);
+			auto skip_count = skip_range.end - state.group_offset;
+			for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+				root_reader.GetChildReader(reader_data.column_ids[col_idx])->Skip(skip_count);
+			}
+			state.group_offset = skip_range.end;
+			state.current_skip_range++;
+			return true;
+		}
+		// don't read into the next pruned range
+		this_output_chunk_rows = MinValue<idx_t>(this_output_chunk_rows, skip_range.start - state.group_offset);
+	}
 	result.SetCardinality(this_output_chunk_rows);
 
 	if (this_output_chunk_rows == 0) {
@@ -1001,8 +1160,6 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 	auto define_ptr = (uint8_t *)state.define_buf.ptr;
 	auto repeat_ptr = (uint8_t *)state.repeat_buf.ptr;
 
-	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
-
 	if (reader_data.filters) {
 		vector<bool> need_to_read(reader_data.column_ids.size(), true);
 
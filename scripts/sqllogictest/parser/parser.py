@@ -93,7 +93,7 @@ class SQLLogicParser:
             TokenType.SQLLOGIC_ONLY_IF: self.decorator_onlyif,
         }
         self.FOREACH_COLLECTIONS = {
-            "<compression>": ["none", "uncompressed", "rle", "bitpacking", "dictionary", "fsst", "alp", "alprd"],
+            "<compression>": ["none", "uncompressed", "rle", "bitpacking", "dictionary", "fsst", "alp", "alprd", "zstd"],
             "<alltypes>": ["bool", "interval", "varchar"],
             "<numeric>": ["float", "double"],
             "<integral>": ["tinyint", "smallint", "integer", "bigint", "hugeint"],
@@ -129,6 +129,7 @@
 #include "duckdb/storage/statistics/base_statistics.hpp"
 #include "duckdb/storage/table/chunk_info.hpp"
 #include "duckdb/storage/table/column_segment.hpp"
+#include "duckdb/storage/temporary_file_manager.hpp"
 #include "duckdb/verification/statement_verifier.hpp"
 
 namespace duckdb {
@@ -1042,6 +1043,8 @@ const char* EnumUtil::ToChars<ChunkInfoType>(ChunkInfoType value) {
 		return "VECTOR_INFO";
 	case ChunkInfoType::EMPTY_INFO:
 		return "EMPTY_INFO";
+	case ChunkInfoType::BITMAP_INFO:
+		return "BITMAP_INFO";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
 	}
@@ -1058,6 +1061,9 @@ ChunkInfoType EnumUtil::FromString<ChunkInfoType>(const char *value) {
 	if (StringUtil::Equals(value, "EMPTY_INFO")) {
 		return ChunkInfoType::EMPTY_INFO;
 	}
+	if (StringUtil::Equals(value, "BITMAP_INFO")) {
+		return ChunkInfoType::BITMAP_INFO;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
@@ -1195,6 +1201,8 @@ const char* EnumUtil::ToChars<CompressionType>(CompressionType value) {
 		return "COMPRESSION_ALP";
 	case CompressionType::COMPRESSION_ALPRD:
 		return "COMPRESSION_ALPRD";
+	case CompressionType::COMPRESSION_ZSTD:
+		return "COMPRESSION_ZSTD";
 	case CompressionType::COMPRESSION_COUNT:
 		return "COMPRESSION_COUNT";
 	default:
@@ -1240,6 +1248,9 @@ CompressionType EnumUtil::FromString<CompressionType>(const char *value) {
 	if (StringUtil::Equals(value, "COMPRESSION_ALPRD")) {
 		return CompressionType::COMPRESSION_ALPRD;
 	}
+	if (StringUtil::Equals(value, "COMPRESSION_ZSTD")) {
+		return CompressionType::COMPRESSION_ZSTD;
+	}
 	if (StringUtil::Equals(value, "COMPRESSION_COUNT")) {
 		return CompressionType::COMPRESSION_COUNT;
 	}
@@ -1684,6 +1695,29 @@ ErrorType EnumUtil::FromString<ErrorType>(const char *value) {
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
+template<>
+const char* EnumUtil::ToChars<EvictionQueueType>(EvictionQueueType value) {
+	switch(value) {
+	case EvictionQueueType::PROBATIONARY:
+		return "PROBATIONARY";
+	case EvictionQueueType::FREQUENT:
+		return "FREQUENT";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
+	}
+}
+
+template<>
+EvictionQueueType EnumUtil::FromString<EvictionQueueType>(const char *value) {
+	if (StringUtil::Equals(value, "PROBATIONARY")) {
+		return EvictionQueueType::PROBATIONARY;
+	}
+	if (StringUtil::Equals(value, "FREQUENT")) {
+		return EvictionQueueType::FREQUENT;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
 template<>
 const char* EnumUtil::ToChars<ExceptionFormatValueType>(ExceptionFormatValueType value) {
 	switch(value) {
@@ -4835,6 +4869,8 @@ const char* EnumUtil::ToChars<PhysicalOperatorType>(PhysicalOperatorType value)
 		return "STREAMING_SAMPLE";
 	case PhysicalOperatorType::STREAMING_WINDOW:
 		return "STREAMING_WINDOW";
+	case PhysicalOperatorType::ORDERED_STREAMING_WINDOW:
+		return "ORDERED_STREAMING_WINDOW";
 	case PhysicalOperatorType::PIVOT:
 		return "PIVOT";
 	case PhysicalOperatorType::COPY_DATABASE:
@@ -5014,6 +5050,9 @@ PhysicalOperatorType EnumUtil::FromString<PhysicalOperatorType>(const char *valu
 	if (StringUtil::Equals(value, "STREAMING_WINDOW")) {
 		return PhysicalOperatorType::STREAMING_WINDOW;
 	}
+	if (StringUtil::Equals(value, "ORDERED_STREAMING_WINDOW")) {
+		return PhysicalOperatorType::ORDERED_STREAMING_WINDOW;
+	}
 	if (StringUtil::Equals(value, "PIVOT")) {
 		return PhysicalOperatorType::PIVOT;
 	}
@@ -6782,6 +6821,10 @@ const char* EnumUtil::ToChars<TableFilterType>(TableFilterType value) {
 		return "CONJUNCTION_AND";
 	case TableFilterType::STRUCT_EXTRACT:
 		return "STRUCT_EXTRACT";
+	case TableFilterType::DYNAMIC_FILTER:
+		return "DYNAMIC_FILTER";
+	case TableFilterType::IN_FILTER:
+		return "IN_FILTER";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
 	}
@@ -6807,6 +6850,12 @@ TableFilterType EnumUtil::FromString<TableFilterType>(const char *value) {
 	if (StringUtil::Equals(value, "STRUCT_EXTRACT")) {
 		return TableFilterType::STRUCT_EXTRACT;
 	}
+	if (StringUtil::Equals(value, "DYNAMIC_FILTER")) {
+		return TableFilterType::DYNAMIC_FILTER;
+	}
+	if (StringUtil::Equals(value, "IN_FILTER")) {
+		return TableFilterType::IN_FILTER;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
@@ -6972,6 +7021,64 @@ TaskExecutionResult EnumUtil::FromString<TaskExecutionResult>(const char *value)
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
+template<>
+const char* EnumUtil::ToChars<TemporaryBufferSize>(TemporaryBufferSize value) {
+	switch(value) {
+	case TemporaryBufferSize::INVALID:
+		return "INVALID";
+	case TemporaryBufferSize::S32K:
+		return "S32K";
+	case TemporaryBufferSize::S64K:
+		return "S64K";
+	case TemporaryBufferSize::S96K:
+		return "S96K";
+	case TemporaryBufferSize::S128K:
+		return "S128K";
+	case TemporaryBufferSize::S160K:
+		return "S160K";
+	case TemporaryBufferSize::S192K:
+		return "S192K";
+	case TemporaryBufferSize::S224K:
+		return "S224K";
+	case TemporaryBufferSize::DEFAULT:
+		return "DEFAULT";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
+	}
+}
+
+template<>
+TemporaryBufferSize EnumUtil::FromString<TemporaryBufferSize>(const char *value) {
+	if (StringUtil::Equals(value, "INVALID")) {
+		return TemporaryBufferSize::INVALID;
+	}
+	if (StringUtil::Equals(value, "S32K")) {
+		return TemporaryBufferSize::S32K;
+	}
+	if (StringUtil::Equals(value, "S64K")) {
+		return TemporaryBufferSize::S64K;
+	}
+	if (StringUtil::Equals(value, "S96K")) {
+		return TemporaryBufferSize::S96K;
+	}
+	if (StringUtil::Equals(value, "S128K")) {
+		return TemporaryBufferSize::S128K;
+	}
+	if (StringUtil::Equals(value, "S160K")) {
+		return TemporaryBufferSize::S160K;
+	}
+	if (StringUtil::Equals(value, "S192K")) {
+		return TemporaryBufferSize::S192K;
+	}
+	if (StringUtil::Equals(value, "S224K")) {
+		return TemporaryBufferSize::S224K;
+	}
+	if (StringUtil::Equals(value, "DEFAULT")) {
+		return TemporaryBufferSize::DEFAULT;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
 template<>
 const char* EnumUtil::ToChars<TimestampCastResult>(TimestampCastResult value) {
 	switch(value) {
@@ -33,6 +33,8 @@ string PhysicalOperatorToString(PhysicalOperatorType type) {
 		return "WINDOW";
 	case PhysicalOperatorType::STREAMING_WINDOW:
 		return "STREAMING_WINDOW";
+	case PhysicalOperatorType::ORDERED_STREAMING_WINDOW:
+		return "ORDERED_STREAMING_WINDOW";
 	case PhysicalOperatorType::UNNEST:
 		return "UNNEST";
 	case PhysicalOperatorType::UNGROUPED_AGGREGATE:
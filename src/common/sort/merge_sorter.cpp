@@ -9,15 +9,24 @@ MergeSorter::MergeSorter(GlobalSortState &state, BufferManager &buffer_manager)
 }
 
 void MergeSorter::PerformInMergeRound() {
+	const bool k_way = state.merge_fan_in > 2;
 	while (true) {
 		{
 			lock_guard<mutex> pair_guard(state.lock);
 			if (state.pair_idx == state.num_pairs) {
 				break;
 			}
-			GetNextPartition();
+			if (k_way) {
+				GetNextKWayPartition();
+			} else {
+				GetNextPartition();
+			}
+		}
+		if (k_way) {
+			MergeKWayPartition();
+		} else {
+			MergePartition();
 		}
-		MergePartition();
 	}
 }
 
@@ -141,6 +150,12 @@ int MergeSorter::CompareUsingGlobalIndex(SBScanState &l, SBScanState &r, const i
 	if (r_idx < state.r_start) {
 		return 1;
 	}
+	return CompareAtGlobalIndex(l, r, l_idx, r_idx);
+}
+
+int MergeSorter::CompareAtGlobalIndex(SBScanState &l, SBScanState &r, const idx_t l_idx, const idx_t r_idx) {
+	D_ASSERT(l_idx < l.sb->Count());
+	D_ASSERT(r_idx < r.sb->Count());
 
 	l.sb->GlobalToLocalIndex(l_idx, l.block_idx, l.entry_idx);
 	r.sb->GlobalToLocalIndex(r_idx, r.block_idx, r.entry_idx);
@@ -660,4 +675,285 @@ void MergeSorter::FlushBlobs(const RowLayout &layout, const idx_t &source_count,
 	D_ASSERT(target_heap_block.byte_offset <= target_heap_block.capacity);
 }
 
+void MergeSorter::GetNextKWayPartition() {
+	// Create result block
+	state.sorted_blocks_temp[state.pair_idx].push_back(make_uniq<SortedBlock>(buffer_manager, state));
+	result = state.sorted_blocks_temp[state.pair_idx].back().get();
+	// Determine which blocks must be merged
+	const idx_t group_start = state.pair_idx * state.merge_fan_in;
+	const idx_t group_end = MinValue(group_start + state.merge_fan_in, state.sorted_blocks.size());
+	const idx_t k = group_end - group_start;
+	D_ASSERT(k >= 2);
+	vector<idx_t> counts;
+	idx_t remaining = 0;
+	for (idx_t run_idx = 0; run_idx < k; run_idx++) {
+		counts.push_back(state.sorted_blocks[group_start + run_idx]->Count());
+		remaining += counts[run_idx] - state.run_starts[run_idx];
+	}
+	// Compute the work that this thread must do using Merge Path
+	vector<idx_t> ends;
+	if (remaining > state.block_capacity) {
+		vector<unique_ptr<SBScanState>> readers;
+		for (idx_t run_idx = 0; run_idx < k; run_idx++) {
+			readers.push_back(make_uniq<SBScanState>(buffer_manager, state));
+			readers.back()->sb = state.sorted_blocks[group_start + run_idx].get();
+		}
+		GetKWayIntersection(readers, counts, state.block_capacity, ends);
+	} else {
+		ends = counts;
+	}
+	// Create slices of the data that this thread must merge
+	runs.clear();
+	run_inputs.clear();
+	bool group_done = true;
+	for (idx_t run_idx = 0; run_idx < k; run_idx++) {
+		D_ASSERT(ends[run_idx] >= state.run_starts[run_idx] && ends[run_idx] <= counts[run_idx]);
+		auto run = make_uniq<SBScanState>(buffer_manager, state);
+		run->SetIndices(0, 0);
+		run_inputs.push_back(state.sorted_blocks[group_start + run_idx]->CreateSlice(state.run_starts[run_idx],
+		                                                                             ends[run_idx], run->entry_idx));
+		run->sb = run_inputs.back().get();
+		runs.push_back(std::move(run));
+		state.run_starts[run_idx] = ends[run_idx];
+		group_done = group_done && ends[run_idx] == counts[run_idx];
+	}
+	// Update global state
+	if (group_done) {
+		// Delete references to previous group
+		for (idx_t block_idx = group_start; block_idx < group_end; block_idx++) {
+			state.sorted_blocks[block_idx] = nullptr;
+		}
+		// Advance group
+		state.pair_idx++;
+		std::fill(state.run_starts.begin(), state.run_starts.end(), 0);
+	}
+}
+
+void MergeSorter::GetKWayIntersection(vector<unique_ptr<SBScanState>> &readers, const vector<idx_t> &counts,
+                                      const idx_t count, vector<idx_t> &ends) {
+	// The rows of the runs are ordered by value, ties are broken by the index of the run.
+	// The partition consists of the first 'count' rows in this order, we narrow down the bounds [lo, hi] of the
+	// partition end in every run until the bounds meet, using a row of one of the runs as a pivot in every iteration
+	const idx_t k = readers.size();
+	const auto &starts = state.run_starts;
+	vector<idx_t> lo(k);
+	vector<idx_t> hi(k);
+	vector<idx_t> positions(k);
+	for (idx_t run_idx = 0; run_idx < k; run_idx++) {
+		lo[run_idx] = starts[run_idx];
+		hi[run_idx] = MinValue(counts[run_idx], starts[run_idx] + count);
+	}
+	while (true) {
+		// Pick the middle of the largest search range as the pivot
+		idx_t pivot_run = 0;
+		for (idx_t run_idx = 1; run_idx < k; run_idx++) {
+			if (hi[run_idx] - lo[run_idx] > hi[pivot_run] - lo[pivot_run]) {
+				pivot_run = run_idx;
+			}
+		}
+		if (hi[pivot_run] == lo[pivot_run]) {
+			// The bounds have met in every run
+			break;
+		}
+		const idx_t pivot_idx = (lo[pivot_run] + hi[pivot_run]) / 2;
+		// Count the rows that come before the pivot in every run using binary search
+		idx_t before_pivot = 0;
+		for (idx_t run_idx = 0; run_idx < k; run_idx++) {
+			if (run_idx == pivot_run) {
+				positions[run_idx] = pivot_idx;
+			} else {
+				idx_t left = lo[run_idx];
+				idx_t right = hi[run_idx];
+				while (left < right) {
+					const idx_t middle = (left + right) / 2;
+					const int comp_res =
+					    CompareAtGlobalIndex(*readers[run_idx], *readers[pivot_run], middle, pivot_idx);
+					if (comp_res < 0 || (comp_res == 0 && run_idx < pivot_run)) {
+						left = middle + 1;
+					} else {
+						right = middle;
+					}
+				}
+				positions[run_idx] = left;
+			}
+			before_pivot += positions[run_idx] - starts[run_idx];
+		}
+		if (before_pivot == count) {
+			// The pivot is the first row after the partition
+			lo = positions;
+			break;
+		} else if (before_pivot < count) {
+			// The pivot and the rows before it belong to the partition
+			lo = positions;
+			lo[pivot_run]++;
+		} else {
+			// The pivot and the rows after it do not belong to the partition
+			hi = positions;
+		}
+	}
+	ends = lo;
+#ifdef DEBUG
+	idx_t partition_count = 0;
+	for (idx_t run_idx = 0; run_idx < k; run_idx++) {
+		partition_count += ends[run_idx] - starts[run_idx];
+	}
+	D_ASSERT(partition_count == count);
+#endif
+}
+
+void MergeSorter::MergeKWayPartition() {
+	// Set up the write block
+	// Each merge task produces a SortedBlock with exactly state.block_capacity rows or less
+	result->InitializeWrite();
+	const idx_t k = runs.size();
+	// Position the runs on their first row
+	run_radix_ptrs.assign(k, nullptr);
+	idx_t count = 0;
+	for (idx_t run_idx = 0; run_idx < k; run_idx++) {
+		count += runs[run_idx]->Remaining();
+		AdvanceRun(run_idx);
+	}
+	D_ASSERT(count <= state.block_capacity);
+	// Initialize the loser tree: every node starts out with a virtual run that is smaller than all rows
+	loser_tree.assign(k, k);
+	for (idx_t run_idx = k; run_idx > 0; run_idx--) {
+		AdjustLoserTree(run_idx - 1);
+	}
+	// Result blocks to write to
+	auto &result_radix_block = *result->radix_sorting_data.back();
+	auto result_radix_handle = buffer_manager.Pin(result_radix_block.block);
+	data_ptr_t result_radix_ptr = result_radix_handle.Ptr();
+	data_ptr_t result_blob_ptr = nullptr;
+	BufferHandle result_blob_handle;
+	BufferHandle result_blob_heap_handle;
+	if (!sort_layout.all_constant) {
+		result_blob_handle = buffer_manager.Pin(result->blob_sorting_data->data_blocks.back()->block);
+		result_blob_ptr = result_blob_handle.Ptr();
+		if (!sort_layout.blob_layout.AllConstant() && state.external) {
+			result_blob_heap_handle = buffer_manager.Pin(result->blob_sorting_data->heap_blocks.back()->block);
+		}
+	}
+	auto result_payload_handle = buffer_manager.Pin(result->payload_data->data_blocks.back()->block);
+	data_ptr_t result_payload_ptr = result_payload_handle.Ptr();
+	BufferHandle result_payload_heap_handle;
+	if (!state.payload_layout.AllConstant() && state.external) {
+		result_payload_heap_handle = buffer_manager.Pin(result->payload_data->heap_blocks.back()->block);
+	}
+	// Merge loop: copy the row of the winner, then replay its matches
+	for (idx_t i = 0; i < count; i++) {
+		const idx_t winner = loser_tree[0];
+		D_ASSERT(winner < k);
+		auto &run = *runs[winner];
+		FastMemcpy(result_radix_ptr, run_radix_ptrs[winner], sort_layout.entry_size);
+		result_radix_ptr += sort_layout.entry_size;
+		result_radix_block.count++;
+		if (!sort_layout.all_constant) {
+			AppendRow(run, *run.sb->blob_sorting_data, *result->blob_sorting_data, result_blob_ptr,
+			          result_blob_heap_handle);
+		}
+		run.PinData(*run.sb->payload_data);
+		AppendRow(run, *run.sb->payload_data, *result->payload_data, result_payload_ptr, result_payload_heap_handle);
+		run.entry_idx++;
+		AdvanceRun(winner);
+		AdjustLoserTree(winner);
+	}
+	D_ASSERT(result->Count() == count);
+}
+
+bool MergeSorter::KWayRunIsSmaller(const idx_t l, const idx_t r) {
+	const idx_t k = runs.size();
+	// The virtual run 'k' is smaller than everything
+	if (l == k || r == k) {
+		return l == k && r != k;
+	}
+	// Exhausted runs are larger than everything
+	const bool l_done = runs[l]->block_idx == runs[l]->sb->radix_sorting_data.size();
+	const bool r_done = runs[r]->block_idx == runs[r]->sb->radix_sorting_data.size();
+	if (l_done || r_done) {
+		return !l_done;
+	}
+	int comp_res;
+	if (sort_layout.all_constant) {
+		comp_res = FastMemcmp(run_radix_ptrs[l], run_radix_ptrs[r], sort_layout.comparison_size);
+	} else {
+		comp_res = Comparators::CompareTuple(*runs[l], *runs[r], run_radix_ptrs[l], run_radix_ptrs[r], sort_layout,
+		                                     state.external);
+	}
+	// Ties are broken by the index of the run so that the result matches the partitioning
+	return comp_res < 0 || (comp_res == 0 && l < r);
+}
+
+void MergeSorter::AdjustLoserTree(idx_t run_idx) {
+	const idx_t k = runs.size();
+	for (idx_t node = (run_idx + k) / 2; node > 0; node /= 2) {
+		if (KWayRunIsSmaller(loser_tree[node], run_idx)) {
+			// The run stored in the node wins this match and moves up, the current run is stored as the loser
+			std::swap(loser_tree[node], run_idx);
+		}
+	}
+	loser_tree[0] = run_idx;
+}
+
+void MergeSorter::AdvanceRun(const idx_t run_idx) {
+	auto &run = *runs[run_idx];
+	auto &sb = *run.sb;
+	// Move to the next block (if needed)
+	while (run.block_idx < sb.radix_sorting_data.size() &&
+	       run.entry_idx == sb.radix_sorting_data[run.block_idx]->count) {
+		// Delete references to the block that was merged
+		sb.radix_sorting_data[run.block_idx]->block = nullptr;
+		if (!sort_layout.all_constant) {
+			sb.blob_sorting_data->data_blocks[run.block_idx]->block = nullptr;
+			if (!sort_layout.blob_layout.AllConstant() && state.external) {
+				sb.blob_sorting_data->heap_blocks[run.block_idx]->block = nullptr;
+			}
+		}
+		sb.payload_data->data_blocks[run.block_idx]->block = nullptr;
+		if (!state.payload_layout.AllConstant() && state.external) {
+			sb.payload_data->heap_blocks[run.block_idx]->block = nullptr;
+		}
+		// Advance block
+		run.block_idx++;
+		run.entry_idx = 0;
+	}
+	if (run.block_idx == sb.radix_sorting_data.size()) {
+		// Exhausted
+		return;
+	}
+	// Pin the data needed for comparisons
+	run.PinRadix(run.block_idx);
+	run_radix_ptrs[run_idx] = run.RadixPtr();
+	if (!sort_layout.all_constant) {
+		run.PinData(*sb.blob_sorting_data);
+	}
+}
+
+void MergeSorter::AppendRow(SBScanState &source, SortedData &source_data, SortedData &result_data,
+                            data_ptr_t &result_data_ptr, BufferHandle &result_heap_handle) {
+	const auto &layout = result_data.layout;
+	const idx_t row_width = layout.GetRowWidth();
+	auto &result_data_block = *result_data.data_blocks.back();
+	D_ASSERT(result_data_block.count < result_data_block.capacity);
+	FastMemcpy(result_data_ptr, source.DataPtr(source_data), row_width);
+	if (!layout.AllConstant() && state.external) {
+		// Copy the heap entry too, and store its offset in the result heap in the row
+		auto &result_heap_block = *result_data.heap_blocks.back();
+		const auto source_heap_ptr = source.HeapPtr(source_data);
+		const idx_t entry_size = Load<uint32_t>(source_heap_ptr);
+		D_ASSERT(entry_size >= sizeof(uint32_t));
+		// Reallocate result heap block size (if needed)
+		if (result_heap_block.byte_offset + entry_size > result_heap_block.capacity) {
+			idx_t new_capacity = MaxValue(result_heap_block.byte_offset + entry_size, result_heap_block.capacity * 2);
+			buffer_manager.ReAllocate(result_heap_block.block, new_capacity);
+			result_heap_block.capacity = new_capacity;
+		}
+		Store<idx_t>(result_heap_block.byte_offset, result_data_ptr + layout.GetHeapOffset());
+		memcpy(result_heap_handle.Ptr() + result_heap_block.byte_offset, source_heap_ptr, entry_size);
+		result_heap_block.byte_offset += entry_size;
+		result_heap_block.count++;
+	}
+	result_data_ptr += row_width;
+	result_data_block.count++;
+}
+
 } // namespace duckdb
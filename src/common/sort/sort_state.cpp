@@ -363,7 +363,7 @@ void LocalSortState::ReOrder(GlobalSortState &gstate, bool reorder_heap) {
 GlobalSortState::GlobalSortState(BufferManager &buffer_manager, const vector<BoundOrderByNode> &orders,
                                  RowLayout &payload_layout)
     : buffer_manager(buffer_manager), sort_layout(SortLayout(orders)), payload_layout(payload_layout),
-      block_capacity(0), external(false) {
+      block_capacity(0), external(false), merge_fan_in(2) {
 }
 
 void GlobalSortState::AddLocalState(LocalSortState &local_sort_state) {
@@ -434,22 +434,46 @@ void GlobalSortState::InitializeMergeRound() {
 	// If we reverse this list, the blocks that were merged last will be merged first in the next round
 	// These are still in memory, therefore this reduces the amount of read/write to disk!
 	std::reverse(sorted_blocks.begin(), sorted_blocks.end());
-	// Uneven number of blocks - keep one on the side
-	if (sorted_blocks.size() % 2 == 1) {
+	merge_fan_in = ComputeMergeFanIn();
+	// A single block would be left over in the last group - keep it on the side
+	if (sorted_blocks.size() % merge_fan_in == 1) {
 		odd_one_out = std::move(sorted_blocks.back());
 		sorted_blocks.pop_back();
 	}
 	// Init merge path path indices
 	pair_idx = 0;
-	num_pairs = sorted_blocks.size() / 2;
+	num_pairs = (sorted_blocks.size() + merge_fan_in - 1) / merge_fan_in;
 	l_start = 0;
 	r_start = 0;
+	run_starts.assign(merge_fan_in, 0);
 	// Allocate room for merge results
 	for (idx_t p_idx = 0; p_idx < num_pairs; p_idx++) {
 		sorted_blocks_temp.emplace_back();
 	}
 }
 
+idx_t GlobalSortState::ComputeMergeFanIn() const {
+	if (!external || sorted_blocks.size() <= 2) {
+		// In-memory sorts merge pairwise
+		return 2;
+	}
+	// Merging a block keeps (at most) one of its blocks of radix, blob and payload data pinned
+	idx_t max_block_size = 1;
+	for (auto &sb : sorted_blocks) {
+		max_block_size = MaxValue(max_block_size, sb->SizeInBytes() / sb->radix_sorting_data.size());
+	}
+	// Use at most half of the memory for the blocks that are merged at once
+	idx_t fan_in = buffer_manager.GetQueryMaxMemory() / 2 / max_block_size;
+	fan_in = MinValue(fan_in, SortConstants::MAX_MERGE_FAN_IN);
+	fan_in = MinValue(fan_in, sorted_blocks.size());
+	if (fan_in <= 2) {
+		return 2;
+	}
+	// Balance the number of blocks across the groups that are merged in this round
+	const idx_t num_groups = (sorted_blocks.size() + fan_in - 1) / fan_in;
+	return MaxValue<idx_t>((sorted_blocks.size() + num_groups - 1) / num_groups, 2);
+}
+
 void GlobalSortState::CompleteMergeRound(bool keep_radix_data) {
 	sorted_blocks.clear();
 	for (auto &sorted_block_vector : sorted_blocks_temp) {
@@ -69,8 +69,14 @@ struct AverageSetOperation {
 	static void AddValues(STATE &state, idx_t count) {
 		state.count += count;
 	}
+	template <class STATE>
+	static void RemoveValues(STATE &state, idx_t count) {
+		state.count -= count;
+	}
 };
 
+using IntegerAverageRemoveOperation = BaseSumRemoveOperation<AverageSetOperation>;
+
 template <class T>
 static T GetAverageDivident(uint64_t count, optional_ptr<FunctionData> bind_data) {
 	T divident = T(count);
@@ -142,16 +148,24 @@ struct KahanAverageOperation : public BaseSumOperation<AverageSetOperation, Kaha
 AggregateFunction GetAverageAggregate(PhysicalType type) {
 	switch (type) {
 	case PhysicalType::INT16: {
-		return AggregateFunction::UnaryAggregate<AvgState<int64_t>, int16_t, double, IntegerAverageOperation>(
+		auto function = AggregateFunction::UnaryAggregate<AvgState<int64_t>, int16_t, double, IntegerAverageOperation>(
 		    LogicalType::SMALLINT, LogicalType::DOUBLE);
+		function.remove = AggregateFunction::UnaryUpdate<AvgState<int64_t>, int16_t, IntegerAverageRemoveOperation>;
+		return function;
 	}
 	case PhysicalType::INT32: {
-		return AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, int32_t, double, IntegerAverageOperationHugeint>(
-		    LogicalType::INTEGER, LogicalType::DOUBLE);
+		auto function =
+		    AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, int32_t, double, IntegerAverageOperationHugeint>(
+		        LogicalType::INTEGER, LogicalType::DOUBLE);
+		function.remove = AggregateFunction::UnaryUpdate<AvgState<hugeint_t>, int32_t, IntegerAverageRemoveOperation>;
+		return function;
 	}
 	case PhysicalType::INT64: {
-		return AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, int64_t, double, IntegerAverageOperationHugeint>(
-		    LogicalType::BIGINT, LogicalType::DOUBLE);
+		auto function =
+		    AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, int64_t, double, IntegerAverageOperationHugeint>(
+		        LogicalType::BIGINT, LogicalType::DOUBLE);
+		function.remove = AggregateFunction::UnaryUpdate<AvgState<hugeint_t>, int64_t, IntegerAverageRemoveOperation>;
+		return function;
 	}
 	case PhysicalType::INT128: {
 		return AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, hugeint_t, double, HugeintAverageOperation>(
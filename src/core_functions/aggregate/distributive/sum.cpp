@@ -19,8 +19,13 @@ struct SumSetOperation {
 	static void AddValues(STATE &state, idx_t count) {
 		state.isset = true;
 	}
+	template <class STATE>
+	static void RemoveValues(STATE &state, idx_t count) {
+	}
 };
 
+using IntegerSumRemoveOperation = BaseSumRemoveOperation<SumSetOperation>;
+
 struct IntegerSumOperation : public BaseSumOperation<SumSetOperation, RegularAdd> {
 	template <class T, class STATE>
 	static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data) {
@@ -88,6 +93,7 @@ AggregateFunction GetSumAggregateNoOverflow(PhysicalType type) {
 	case PhysicalType::INT32: {
 		auto function = AggregateFunction::UnaryAggregate<SumState<int64_t>, int32_t, hugeint_t, IntegerSumOperation>(
 		    LogicalType::INTEGER, LogicalType::HUGEINT);
+		function.remove = AggregateFunction::UnaryUpdate<SumState<int64_t>, int32_t, IntegerSumRemoveOperation>;
 		function.name = "sum_no_overflow";
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		function.bind = SumNoOverflowBind;
@@ -98,6 +104,7 @@ AggregateFunction GetSumAggregateNoOverflow(PhysicalType type) {
 	case PhysicalType::INT64: {
 		auto function = AggregateFunction::UnaryAggregate<SumState<int64_t>, int64_t, hugeint_t, IntegerSumOperation>(
 		    LogicalType::BIGINT, LogicalType::HUGEINT);
+		function.remove = AggregateFunction::UnaryUpdate<SumState<int64_t>, int64_t, IntegerSumRemoveOperation>;
 		function.name = "sum_no_overflow";
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		function.bind = SumNoOverflowBind;
@@ -158,6 +165,7 @@ AggregateFunction GetSumAggregate(PhysicalType type) {
 	case PhysicalType::INT16: {
 		auto function = AggregateFunction::UnaryAggregate<SumState<int64_t>, int16_t, hugeint_t, IntegerSumOperation>(
 		    LogicalType::SMALLINT, LogicalType::HUGEINT);
+		function.remove = AggregateFunction::UnaryUpdate<SumState<int64_t>, int16_t, IntegerSumRemoveOperation>;
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		return function;
 	}
@@ -167,6 +175,7 @@ AggregateFunction GetSumAggregate(PhysicalType type) {
 		    AggregateFunction::UnaryAggregate<SumState<hugeint_t>, int32_t, hugeint_t, SumToHugeintOperation>(
 		        LogicalType::INTEGER, LogicalType::HUGEINT);
 		function.statistics = SumPropagateStats;
+		function.remove = AggregateFunction::UnaryUpdate<SumState<hugeint_t>, int32_t, IntegerSumRemoveOperation>;
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		return function;
 	}
@@ -175,6 +184,7 @@ AggregateFunction GetSumAggregate(PhysicalType type) {
 		    AggregateFunction::UnaryAggregate<SumState<hugeint_t>, int64_t, hugeint_t, SumToHugeintOperation>(
 		        LogicalType::BIGINT, LogicalType::HUGEINT);
 		function.statistics = SumPropagateStats;
+		function.remove = AggregateFunction::UnaryUpdate<SumState<hugeint_t>, int64_t, IntegerSumRemoveOperation>;
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		return function;
 	}
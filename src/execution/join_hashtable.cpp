@@ -1,10 +1,12 @@
 #include "duckdb/execution/join_hashtable.hpp"
 
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/prefetch.hpp"
 #include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/common/types/column/column_data_collection_segment.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 
 namespace duckdb {
@@ -86,32 +88,47 @@ void JoinHashTable::Merge(JoinHashTable &other) {
 	sink_collection->Combine(*other.sink_collection);
 }
 
-void JoinHashTable::ApplyBitmask(Vector &hashes, idx_t count) {
-	if (hashes.GetVectorType() == VectorType::CONSTANT_VECTOR) {
-		D_ASSERT(!ConstantVector::IsNull(hashes));
-		auto indices = ConstantVector::GetData<hash_t>(hashes);
-		*indices = *indices & bitmask;
-	} else {
-		hashes.Flatten(count);
-		auto indices = FlatVector::GetData<hash_t>(hashes);
-		for (idx_t i = 0; i < count; i++) {
-			indices[i] &= bitmask;
-		}
-	}
-}
-
-void JoinHashTable::ApplyBitmask(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers) {
+void JoinHashTable::GetRowPointers(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers) {
 	UnifiedVectorFormat hdata;
 	hashes.ToUnifiedFormat(count, hdata);
 
 	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
-	auto result_data = FlatVector::GetData<data_ptr_t *>(pointers);
-	auto main_ht = reinterpret_cast<data_ptr_t *>(hash_map.get());
+	auto result_data = FlatVector::GetData<data_ptr_t>(pointers);
+	if (prefetch) {
+		// issue the loads of all entries before resolving any of them, so the cache misses overlap
+		for (idx_t i = 0; i < count; i++) {
+			auto hindex = hdata.sel->get_index(sel.get_index(i));
+			DUCKDB_PREFETCH(entries + (hash_data[hindex] & bitmask));
+		}
+	}
 	for (idx_t i = 0; i < count; i++) {
 		auto rindex = sel.get_index(i);
 		auto hindex = hdata.sel->get_index(rindex);
 		auto hash = hash_data[hindex];
-		result_data[rindex] = main_ht + (hash & bitmask);
+		auto salt = ht_entry_t::ExtractSalt(hash);
+
+		// linear probing until we find an empty entry, or an entry with the same salt
+		data_ptr_t row_pointer = nullptr;
+		for (idx_t entry_idx = hash & bitmask;; entry_idx = (entry_idx + 1) & bitmask) {
+			const auto &entry = entries[entry_idx];
+			if (!entry.IsOccupied()) {
+				break;
+			}
+			if (entry.GetSalt() == salt) {
+				row_pointer = entry.GetPointer();
+				break;
+			}
+		}
+		result_data[rindex] = row_pointer;
+	}
+	if (prefetch) {
+		// the keys of the rows are compared next
+		for (idx_t i = 0; i < count; i++) {
+			auto row_pointer = result_data[sel.get_index(i)];
+			if (row_pointer) {
+				DUCKDB_PREFETCH(row_pointer);
+			}
+		}
 	}
 }
 
@@ -244,42 +261,57 @@ idx_t JoinHashTable::PrepareKeys(DataChunk &keys, vector<TupleDataVectorFormat>
 }
 
 template <bool PARALLEL>
-static inline void InsertHashesLoop(atomic<data_ptr_t> pointers[], const hash_t indices[], const idx_t count,
-                                    const data_ptr_t key_locations[], const idx_t pointer_offset) {
+static inline void InsertHashesLoop(atomic<ht_entry_t> entries[], const hash_t hashes[], const idx_t count,
+                                    const data_ptr_t key_locations[], const idx_t pointer_offset,
+                                    const uint64_t bitmask) {
 	for (idx_t i = 0; i < count; i++) {
-		const auto index = indices[i];
-		if (PARALLEL) {
-			data_ptr_t head;
-			do {
-				head = pointers[index];
-				Store<data_ptr_t>(head, key_locations[i] + pointer_offset);
-			} while (!std::atomic_compare_exchange_weak(&pointers[index], &head, key_locations[i]));
-		} else {
-			// set prev in current key to the value (NOTE: this will be nullptr if there is none)
-			Store<data_ptr_t>(pointers[index], key_locations[i] + pointer_offset);
-
-			// set pointer to current tuple
-			pointers[index] = key_locations[i];
+		const auto hash = hashes[i];
+		const auto salt = ht_entry_t::ExtractSalt(hash);
+		const ht_entry_t desired(hash, key_locations[i]);
+
+		// linear probing until we find an empty entry, or an entry with the same salt
+		idx_t entry_idx = hash & bitmask;
+		while (true) {
+			auto &atomic_entry = entries[entry_idx];
+			auto entry = atomic_entry.load(std::memory_order_relaxed);
+			if (entry.IsOccupied() && entry.GetSalt() != salt) {
+				entry_idx = (entry_idx + 1) & bitmask;
+				continue;
+			}
+			// set prev in current key to the head of the chain (NOTE: this will be nullptr if there is none)
+			Store<data_ptr_t>(entry.GetPointerOrNull(), key_locations[i] + pointer_offset);
+			if (PARALLEL) {
+				// another thread may have claimed the entry in the meantime: if so, look at it again
+				if (atomic_entry.compare_exchange_weak(entry, desired, std::memory_order_release,
+				                                       std::memory_order_relaxed)) {
+					break;
+				}
+			} else {
+				// set the head of the chain to the current tuple
+				atomic_entry.store(desired, std::memory_order_relaxed);
+				break;
+			}
 		}
 	}
 }
 
 void JoinHashTable::InsertHashes(Vector &hashes, idx_t count, data_ptr_t key_locations[], bool parallel) {
 	D_ASSERT(hashes.GetType().id() == LogicalType::HASH);
-
-	// use bitmask to get position in array
-	ApplyBitmask(hashes, count);
-
 	hashes.Flatten(count);
 	D_ASSERT(hashes.GetVectorType() == VectorType::FLAT_VECTOR);
 
-	auto pointers = reinterpret_cast<atomic<data_ptr_t> *>(hash_map.get());
-	auto indices = FlatVector::GetData<hash_t>(hashes);
+	auto atomic_entries = reinterpret_cast<atomic<ht_entry_t> *>(entries);
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
+	if (prefetch) {
+		for (idx_t i = 0; i < count; i++) {
+			DUCKDB_PREFETCH(entries + (hash_data[i] & bitmask));
+		}
+	}
 
 	if (parallel) {
-		InsertHashesLoop<true>(pointers, indices, count, key_locations, pointer_offset);
+		InsertHashesLoop<true>(atomic_entries, hash_data, count, key_locations, pointer_offset, bitmask);
 	} else {
-		InsertHashesLoop<false>(pointers, indices, count, key_locations, pointer_offset);
+		InsertHashesLoop<false>(atomic_entries, hash_data, count, key_locations, pointer_offset, bitmask);
 	}
 }
 
@@ -289,21 +321,23 @@ void JoinHashTable::InitializePointerTable() {
 
 	if (hash_map.get()) {
 		// There is already a hash map
-		auto current_capacity = hash_map.GetSize() / sizeof(data_ptr_t);
+		auto current_capacity = hash_map.GetSize() / sizeof(ht_entry_t);
 		if (capacity != current_capacity) {
 			// Different size, re-allocate
-			hash_map = buffer_manager.GetBufferAllocator().Allocate(capacity * sizeof(data_ptr_t));
+			hash_map = buffer_manager.GetBufferAllocator().Allocate(capacity * sizeof(ht_entry_t));
 		}
 	} else {
 		// Allocate a hash map
-		hash_map = buffer_manager.GetBufferAllocator().Allocate(capacity * sizeof(data_ptr_t));
+		hash_map = buffer_manager.GetBufferAllocator().Allocate(capacity * sizeof(ht_entry_t));
 	}
-	D_ASSERT(hash_map.GetSize() == capacity * sizeof(data_ptr_t));
+	D_ASSERT(hash_map.GetSize() == capacity * sizeof(ht_entry_t));
+	entries = reinterpret_cast<ht_entry_t *>(hash_map.get());
 
-	// initialize HT with all-zero entries
-	std::fill_n(reinterpret_cast<data_ptr_t *>(hash_map.get()), capacity, nullptr);
+	// initialize HT with all-zero (empty) entries
+	std::fill_n(entries, capacity, ht_entry_t(0));
 
 	bitmask = capacity - 1;
+	prefetch = hash_map.GetSize() + data_collection->SizeInBytes() > LAST_LEVEL_CACHE_SIZE;
 }
 
 void JoinHashTable::Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool parallel) {
@@ -321,6 +355,9 @@ void JoinHashTable::Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool para
 		for (idx_t i = 0; i < count; i++) {
 			hash_data[i] = Load<hash_t>(row_locations[i] + pointer_offset);
 		}
+		if (bloom_filter) {
+			bloom_filter->Insert(hash_data, count);
+		}
 		InsertHashes(hashes, count, row_locations, parallel);
 	} while (iterator.Next());
 }
@@ -353,14 +390,14 @@ unique_ptr<ScanStructure> JoinHashTable::Probe(DataChunk &keys, TupleDataChunkSt
 	}
 
 	if (precomputed_hashes) {
-		ApplyBitmask(*precomputed_hashes, *current_sel, ss->count, ss->pointers);
+		GetRowPointers(*precomputed_hashes, *current_sel, ss->count, ss->pointers);
 	} else {
 		// hash all the keys
 		Vector hashes(LogicalType::HASH);
 		Hash(keys, *current_sel, ss->count, hashes);
 
 		// now initialize the pointers of the scan structure based on the hashes
-		ApplyBitmask(hashes, *current_sel, ss->count, ss->pointers);
+		GetRowPointers(hashes, *current_sel, ss->count, ss->pointers);
 	}
 
 	// create the selection vector linking to only non-empty entries
@@ -460,6 +497,12 @@ void ScanStructure::AdvancePointers(const SelectionVector &sel, idx_t sel_count)
 		}
 	}
 	this->count = new_count;
+	if (ht.prefetch) {
+		// the keys of the next rows in the chains are compared next
+		for (idx_t i = 0; i < new_count; i++) {
+			DUCKDB_PREFETCH(ptrs[this->sel_vector.get_index(i)]);
+		}
+	}
 }
 
 void ScanStructure::InitializeSelectionVector(const SelectionVector *&current_sel) {
@@ -468,7 +511,6 @@ void ScanStructure::InitializeSelectionVector(const SelectionVector *&current_se
 	auto cnt = count;
 	for (idx_t i = 0; i < cnt; i++) {
 		const auto idx = current_sel->get_index(i);
-		ptrs[idx] = Load<data_ptr_t>(ptrs[idx]);
 		if (ptrs[idx]) {
 			sel_vector.set_index(non_empty_count++, idx);
 		}
@@ -1055,7 +1097,7 @@ unique_ptr<ScanStructure> JoinHashTable::ProbeAndSpill(DataChunk &keys, TupleDat
 	}
 
 	// now initialize the pointers of the scan structure based on the hashes
-	ApplyBitmask(hashes, *current_sel, ss->count, ss->pointers);
+	GetRowPointers(hashes, *current_sel, ss->count, ss->pointers);
 
 	// create the selection vector linking to only non-empty entries
 	ss->InitializeSelectionVector(current_sel);
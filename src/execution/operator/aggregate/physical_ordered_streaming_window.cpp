@@ -0,0 +1,738 @@
+#include "duckdb/execution/operator/aggregate/physical_ordered_streaming_window.hpp"
+
+#include "duckdb/common/deque.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/function/aggregate_function.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+
+namespace duckdb {
+
+//! Evaluates a LEAD/LAG or frame offset, which has to be the same for every row
+static bool GetConstantOffset(ClientContext &context, const unique_ptr<Expression> &expr, int64_t &offset) {
+	if (!expr || !expr->IsFoldable()) {
+		return false;
+	}
+	auto value = ExpressionExecutor::EvaluateScalar(context, *expr);
+	if (value.IsNull() || !value.type().IsIntegral()) {
+		return false;
+	}
+	offset = value.GetValue<int64_t>();
+	const auto limit = NumericCast<int64_t>(PhysicalOrderedStreamingWindow::MAXIMUM_OFFSET);
+	return offset >= -limit && offset <= limit;
+}
+
+//! The distance from the current row to the row that LEAD/LAG read
+static bool GetLeadLagDelta(ClientContext &context, const BoundWindowExpression &wexpr, int64_t &delta) {
+	int64_t offset = 1;
+	if (wexpr.offset_expr && !GetConstantOffset(context, wexpr.offset_expr, offset)) {
+		return false;
+	}
+	delta = (wexpr.type == ExpressionType::WINDOW_LEAD) ? offset : -offset;
+	return true;
+}
+
+//! The distance from the current row to a ROWS frame boundary
+static bool GetFrameOffset(ClientContext &context, WindowBoundary boundary, const unique_ptr<Expression> &expr,
+                           int64_t &offset) {
+	switch (boundary) {
+	case WindowBoundary::CURRENT_ROW_ROWS:
+		offset = 0;
+		return true;
+	case WindowBoundary::EXPR_PRECEDING_ROWS:
+		if (!GetConstantOffset(context, expr, offset) || offset < 0) {
+			return false;
+		}
+		offset = -offset;
+		return true;
+	case WindowBoundary::EXPR_FOLLOWING_ROWS:
+		return GetConstantOffset(context, expr, offset) && offset >= 0;
+	default:
+		return false;
+	}
+}
+
+//! A frame whose rows are known once a bounded number of rows around the current row has arrived
+struct StreamingFrame {
+	//! The frame starts at the beginning of the partition
+	bool unbounded_begin = false;
+	//! The frame ends with the peer group of the current row
+	bool peer_end = false;
+	//! Otherwise the frame is [row + begin, row + end]
+	int64_t begin = 0;
+	int64_t end = 0;
+};
+
+static bool GetStreamingFrame(ClientContext &context, const BoundWindowExpression &wexpr, StreamingFrame &frame) {
+	if (wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING) {
+		frame.unbounded_begin = true;
+	} else if (!GetFrameOffset(context, wexpr.start, wexpr.start_expr, frame.begin)) {
+		return false;
+	}
+	if (wexpr.end == WindowBoundary::CURRENT_ROW_RANGE) {
+		frame.peer_end = true;
+	} else if (!GetFrameOffset(context, wexpr.end, wexpr.end_expr, frame.end)) {
+		return false;
+	}
+	return true;
+}
+
+bool PhysicalOrderedStreamingWindow::IsStreamingFunction(ClientContext &context, BoundWindowExpression &wexpr) {
+	if (wexpr.ignore_nulls || wexpr.exclude_clause != WindowExcludeMode::NO_OTHER) {
+		return false;
+	}
+	int64_t delta;
+	StreamingFrame frame;
+	switch (wexpr.type) {
+	case ExpressionType::WINDOW_ROW_NUMBER:
+	case ExpressionType::WINDOW_RANK:
+	case ExpressionType::WINDOW_RANK_DENSE:
+		return true;
+	case ExpressionType::WINDOW_LEAD:
+	case ExpressionType::WINDOW_LAG:
+		return GetLeadLagDelta(context, wexpr, delta) && (!wexpr.default_expr || wexpr.default_expr->IsFoldable());
+	case ExpressionType::WINDOW_FIRST_VALUE:
+		// the first row of the partition can be arbitrarily far behind
+		return GetStreamingFrame(context, wexpr, frame) && !frame.unbounded_begin;
+	case ExpressionType::WINDOW_LAST_VALUE:
+		return GetStreamingFrame(context, wexpr, frame);
+	case ExpressionType::WINDOW_AGGREGATE:
+		if (!wexpr.aggregate) {
+			return false;
+		}
+		// filtered and distinct aggregates need the full frame, they are left to the sorting window
+		if (wexpr.filter_expr || wexpr.distinct) {
+			return false;
+		}
+		// a frame that ends with the peer group is only cheap to maintain as a running aggregate
+		return GetStreamingFrame(context, wexpr, frame) && (frame.unbounded_begin || !frame.peer_end);
+	default:
+		return false;
+	}
+}
+
+bool PhysicalOrderedStreamingWindow::IsOrderedBy(PhysicalOperator &plan, const BoundWindowExpression &wexpr) {
+	if (wexpr.partitions.empty() && wexpr.orders.empty()) {
+		return false;
+	}
+	// the keys have to be columns of the input
+	vector<idx_t> columns;
+	for (auto &partition : wexpr.partitions) {
+		if (partition->type != ExpressionType::BOUND_REF) {
+			return false;
+		}
+		columns.push_back(partition->Cast<BoundReferenceExpression>().index);
+	}
+	for (auto &order : wexpr.orders) {
+		if (order.expression->type != ExpressionType::BOUND_REF) {
+			return false;
+		}
+		columns.push_back(order.expression->Cast<BoundReferenceExpression>().index);
+	}
+	auto sorted_columns = plan.GetOutputOrder();
+	if (sorted_columns.size() < columns.size()) {
+		return false;
+	}
+
+	// the partitions only need to be contiguous, so any order and direction of the partition keys will do
+	const auto partition_count = wexpr.partitions.size();
+	const vector<idx_t> partitions(columns.begin(), columns.begin() + NumericCast<int64_t>(partition_count));
+	vector<idx_t> sorted_partitions;
+	for (idx_t i = 0; i < partition_count; i++) {
+		sorted_partitions.push_back(sorted_columns[i].column_index);
+	}
+	for (idx_t i = 0; i < partition_count; i++) {
+		if (std::find(partitions.begin(), partitions.end(), sorted_partitions[i]) == partitions.end() ||
+		    std::find(sorted_partitions.begin(), sorted_partitions.end(), partitions[i]) == sorted_partitions.end()) {
+			return false;
+		}
+	}
+	// the orders have to match exactly
+	for (idx_t i = partition_count; i < columns.size(); i++) {
+		auto &sorted_column = sorted_columns[i];
+		auto &window_order = wexpr.orders[i - partition_count];
+		if (sorted_column.column_index != columns[i] || sorted_column.type != window_order.type ||
+		    sorted_column.null_order != window_order.null_order) {
+			return false;
+		}
+	}
+	return true;
+}
+
+PhysicalOrderedStreamingWindow::PhysicalOrderedStreamingWindow(vector<LogicalType> types,
+                                                               vector<unique_ptr<Expression>> select_list_p,
+                                                               idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::ORDERED_STREAMING_WINDOW, std::move(types), estimated_cardinality),
+      select_list(std::move(select_list_p)), order_idx(0) {
+	for (idx_t expr_idx = 0; expr_idx < select_list.size(); expr_idx++) {
+		auto &wexpr = select_list[expr_idx]->Cast<BoundWindowExpression>();
+		if (wexpr.orders.size() > select_list[order_idx]->Cast<BoundWindowExpression>().orders.size()) {
+			order_idx = expr_idx;
+		}
+	}
+}
+
+//! The state of a single window function
+class OrderedWindowFunction {
+public:
+	OrderedWindowFunction(ClientContext &context, BoundWindowExpression &wexpr, idx_t partition_count,
+	                      idx_t argument_idx)
+	    : wexpr(wexpr), peer_count(partition_count + wexpr.orders.size()), argument_idx(argument_idx), delta(0),
+	      dense_rank(0), statep(LogicalType::POINTER), statef(LogicalType::POINTER),
+	      state_partition(DConstants::INVALID_INDEX), state_end(0) {
+		switch (wexpr.type) {
+		case ExpressionType::WINDOW_LEAD:
+		case ExpressionType::WINDOW_LAG:
+			GetLeadLagDelta(context, wexpr, delta);
+			if (wexpr.default_expr) {
+				default_value = ExpressionExecutor::EvaluateScalar(context, *wexpr.default_expr);
+			}
+			break;
+		case ExpressionType::WINDOW_FIRST_VALUE:
+		case ExpressionType::WINDOW_LAST_VALUE:
+			GetStreamingFrame(context, wexpr, frame);
+			break;
+		case ExpressionType::WINDOW_AGGREGATE: {
+			GetStreamingFrame(context, wexpr, frame);
+			auto &aggregate = *wexpr.aggregate;
+			state.resize(aggregate.state_size());
+			statep.Reference(Value::POINTER(CastPointerToValue(state.data())));
+			statef.Reference(Value::POINTER(CastPointerToValue(state.data())));
+			statef.SetVectorType(VectorType::FLAT_VECTOR); // Prevent conversion of results to constants
+			for (auto &child : wexpr.children) {
+				leaves.emplace_back(child->return_type, nullptr);
+			}
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	//! The number of rows after the current row that have to be known
+	idx_t Lookahead() const {
+		switch (wexpr.type) {
+		case ExpressionType::WINDOW_LEAD:
+		case ExpressionType::WINDOW_LAG:
+			return NumericCast<idx_t>(MaxValue<int64_t>(delta, 0));
+		case ExpressionType::WINDOW_FIRST_VALUE:
+		case ExpressionType::WINDOW_LAST_VALUE:
+		case ExpressionType::WINDOW_AGGREGATE:
+			return NumericCast<idx_t>(MaxValue<int64_t>(MaxValue(frame.begin, frame.end), 0));
+		default:
+			return 0;
+		}
+	}
+
+	//! The number of rows before the current row that have to be kept
+	idx_t History() const {
+		switch (wexpr.type) {
+		case ExpressionType::WINDOW_LEAD:
+		case ExpressionType::WINDOW_LAG:
+			return NumericCast<idx_t>(MaxValue<int64_t>(-delta, 0));
+		case ExpressionType::WINDOW_FIRST_VALUE:
+			return NumericCast<idx_t>(MaxValue<int64_t>(-frame.begin, 0));
+		case ExpressionType::WINDOW_LAST_VALUE:
+			return frame.peer_end ? 0 : NumericCast<idx_t>(MaxValue<int64_t>(-frame.end, 0));
+		case ExpressionType::WINDOW_AGGREGATE:
+			if (frame.unbounded_begin) {
+				// the running aggregate has already seen everything up to the previous frame end
+				return frame.peer_end ? 0 : NumericCast<idx_t>(MaxValue<int64_t>(-frame.end, 0));
+			}
+			return NumericCast<idx_t>(MaxValue<int64_t>(-frame.begin, 0));
+		default:
+			return 0;
+		}
+	}
+
+	//! Computes the frame [begin, end) of a row
+	void GetFrame(idx_t row_idx, idx_t partition_begin, idx_t partition_end, idx_t peer_end, idx_t &begin,
+	              idx_t &end) const {
+		const auto row = NumericCast<int64_t>(row_idx);
+		const auto lower = NumericCast<int64_t>(partition_begin);
+		const auto upper = NumericCast<int64_t>(partition_end);
+		const auto frame_begin = frame.unbounded_begin ? lower : row + frame.begin;
+		const auto frame_end = frame.peer_end ? NumericCast<int64_t>(peer_end) : row + frame.end + 1;
+		begin = NumericCast<idx_t>(MinValue(MaxValue(frame_begin, lower), upper));
+		end = NumericCast<idx_t>(MinValue(MaxValue(frame_end, NumericCast<int64_t>(begin)), upper));
+	}
+
+	void InitializeState() {
+		wexpr.aggregate->initialize(state.data());
+	}
+
+	void DestroyState(ArenaAllocator &allocator) {
+		auto &aggregate = *wexpr.aggregate;
+		if (aggregate.destructor) {
+			AggregateInputData aggr_input_data(wexpr.bind_info.get(), allocator);
+			aggregate.destructor(statef, aggr_input_data, 1);
+		}
+	}
+
+	//! Adds the buffered rows [begin, end) to the aggregate state
+	void UpdateState(DataChunk &buffer, ArenaAllocator &allocator, idx_t begin, idx_t end) {
+		auto &aggregate = *wexpr.aggregate;
+		AggregateInputData aggr_input_data(wexpr.bind_info.get(), allocator);
+		while (begin < end) {
+			const auto count = MinValue<idx_t>(end - begin, STANDARD_VECTOR_SIZE);
+			for (idx_t i = 0; i < leaves.size(); i++) {
+				leaves[i].Slice(buffer.data[argument_idx + i], begin, begin + count);
+			}
+			if (aggregate.simple_update) {
+				aggregate.simple_update(leaves.data(), aggr_input_data, leaves.size(), state.data(), count);
+			} else {
+				aggregate.update(leaves.data(), aggr_input_data, leaves.size(), statep, count);
+			}
+			begin += count;
+		}
+	}
+
+	void FinalizeState(ArenaAllocator &allocator, Vector &result, idx_t result_idx) {
+		AggregateInputData aggr_input_data(wexpr.bind_info.get(), allocator);
+		wexpr.aggregate->finalize(statef, aggr_input_data, result, 1, result_idx);
+	}
+
+public:
+	BoundWindowExpression &wexpr;
+	//! The number of keys (partitions and orders) that peers share
+	const idx_t peer_count;
+	//! The first argument column in the buffer
+	const idx_t argument_idx;
+
+	//! The row that LEAD/LAG read, relative to the current row
+	int64_t delta;
+	//! The LEAD/LAG default (NULL if there is none)
+	Value default_value;
+	//! The frame of FIRST_VALUE, LAST_VALUE and aggregates
+	StreamingFrame frame;
+
+	//! The (absolute) first rows of the peer groups that have not been emitted completely
+	deque<idx_t> peer_starts;
+	//! The DENSE_RANK of the last emitted row
+	int64_t dense_rank;
+
+	//! The aggregate state
+	vector<data_t> state;
+	Vector statep;
+	Vector statef;
+	//! The aggregate arguments
+	vector<Vector> leaves;
+	//! The running aggregate covers [state_partition, state_end)
+	idx_t state_partition;
+	idx_t state_end;
+};
+
+class OrderedStreamingWindowState : public OperatorState {
+public:
+	OrderedStreamingWindowState(ClientContext &context, const PhysicalOrderedStreamingWindow &op)
+	    : appended(false), key_executor(context), argument_executor(context), allocator(Allocator::Get(context)),
+	      row_count(0), buffer_begin(0), output_row(0), lookahead(0), history(0),
+	      running_allocator(Allocator::DefaultAllocator()), frame_allocator(Allocator::DefaultAllocator()) {
+
+		// the partitions and orders of the function with the longest ORDER BY define the boundaries
+		auto &over_expr = op.select_list[op.order_idx]->Cast<BoundWindowExpression>();
+		partition_count = over_expr.partitions.size();
+		for (auto &partition : over_expr.partitions) {
+			key_executor.AddExpression(*partition);
+		}
+		for (auto &order : over_expr.orders) {
+			key_executor.AddExpression(*order.expression);
+		}
+		vector<LogicalType> key_types;
+		for (auto &expr : key_executor.expressions) {
+			key_types.push_back(expr->return_type);
+		}
+		keys.Initialize(allocator, key_types);
+		first_change.resize(STANDARD_VECTOR_SIZE);
+		compare_sel.Initialize(STANDARD_VECTOR_SIZE);
+		changed_sel.Initialize(STANDARD_VECTOR_SIZE);
+		source_sel.Initialize(STANDARD_VECTOR_SIZE);
+		default_sel.Initialize(STANDARD_VECTOR_SIZE);
+		for (idx_t i = 1; i < STANDARD_VECTOR_SIZE; i++) {
+			compare_sel.set_index(i - 1, i);
+		}
+
+		// the buffer holds the input columns followed by the arguments of the functions
+		const auto input_width = op.children[0]->types.size();
+		auto buffer_types = op.children[0]->types;
+		vector<LogicalType> argument_types;
+		for (auto &expr : op.select_list) {
+			auto &wexpr = expr->Cast<BoundWindowExpression>();
+			auto argument_idx = input_width + argument_types.size();
+			functions.push_back(make_uniq<OrderedWindowFunction>(context, wexpr, partition_count, argument_idx));
+			auto &function = *functions.back();
+			lookahead = MaxValue(lookahead, function.Lookahead());
+			history = MaxValue(history, function.History());
+			if (wexpr.type == ExpressionType::WINDOW_RANK || wexpr.type == ExpressionType::WINDOW_RANK_DENSE ||
+			    function.frame.peer_end) {
+				track_peers = true;
+			}
+
+			idx_t argument_count = 0;
+			switch (wexpr.type) {
+			case ExpressionType::WINDOW_LEAD:
+			case ExpressionType::WINDOW_LAG:
+			case ExpressionType::WINDOW_FIRST_VALUE:
+			case ExpressionType::WINDOW_LAST_VALUE:
+				argument_count = 1;
+				break;
+			case ExpressionType::WINDOW_AGGREGATE:
+				argument_count = wexpr.children.size();
+				break;
+			default:
+				break;
+			}
+			for (idx_t i = 0; i < argument_count; i++) {
+				argument_executor.AddExpression(*wexpr.children[i]);
+				argument_types.push_back(wexpr.children[i]->return_type);
+			}
+		}
+		if (!argument_types.empty()) {
+			arguments.Initialize(allocator, argument_types);
+		}
+		buffer_types.insert(buffer_types.end(), argument_types.begin(), argument_types.end());
+		buffer.Initialize(allocator, buffer_types);
+		combined.InitializeEmpty(buffer_types);
+	}
+
+	~OrderedStreamingWindowState() override {
+		for (auto &function : functions) {
+			if (function->state_partition != DConstants::INVALID_INDEX) {
+				function->DestroyState(running_allocator);
+			}
+		}
+	}
+
+	//! Adds a sorted chunk to the buffer and records where the partitions and peer groups start
+	void Append(DataChunk &input);
+	//! Emits the buffered rows whose results are known, returns whether there are more
+	bool Emit(const PhysicalOrderedStreamingWindow &op, DataChunk &chunk, bool final);
+
+private:
+	//! Removes the rows that no function can reach anymore from the buffer
+	void Compact();
+
+public:
+	//! Whether the current input chunk has been added to the buffer
+	bool appended;
+
+private:
+	//! The functions
+	vector<unique_ptr<OrderedWindowFunction>> functions;
+	//! Whether any function needs the peer groups
+	bool track_peers = false;
+
+	//! The partition and order keys
+	ExpressionExecutor key_executor;
+	DataChunk keys;
+	idx_t partition_count;
+	//! The keys of the last row of the previous chunk
+	vector<Value> last_keys;
+	//! For each row of the chunk, the first key that differs from the previous row
+	vector<idx_t> first_change;
+	SelectionVector compare_sel;
+	SelectionVector changed_sel;
+
+	//! The function arguments
+	ExpressionExecutor argument_executor;
+	DataChunk arguments;
+	//! The buffered rows that LEAD/LAG, FIRST_VALUE and LAST_VALUE read, and the rows that get the default
+	SelectionVector source_sel;
+	SelectionVector default_sel;
+
+	//! The buffered rows [buffer_begin, row_count)
+	Allocator &allocator;
+	DataChunk buffer;
+	DataChunk combined;
+	idx_t row_count;
+	idx_t buffer_begin;
+	//! The next row to emit
+	idx_t output_row;
+	//! The (absolute) first rows of the partitions that have not been emitted completely
+	deque<idx_t> partition_starts;
+	//! How far the functions look ahead of and behind the current row
+	idx_t lookahead;
+	idx_t history;
+
+	//! The allocator of the running aggregates
+	ArenaAllocator running_allocator;
+	//! The allocator of the aggregates that are computed per row
+	ArenaAllocator frame_allocator;
+};
+
+void OrderedStreamingWindowState::Append(DataChunk &input) {
+	const auto count = input.size();
+	if (count == 0) {
+		return;
+	}
+
+	// find the first key that differs from the previous row
+	keys.Reset();
+	key_executor.Execute(input, keys);
+	const auto key_count = keys.ColumnCount();
+	std::fill_n(first_change.begin(), count, key_count);
+	for (idx_t col_idx = key_count; col_idx-- > 0;) {
+		auto &key = keys.data[col_idx];
+		if (count > 1) {
+			// compare row i + 1 with row i, and report the changes as row i + 1
+			Vector next(key, compare_sel, count - 1);
+			const auto changed =
+			    VectorOperations::DistinctFrom(next, key, &compare_sel, count - 1, &changed_sel, nullptr);
+			for (idx_t i = 0; i < changed; i++) {
+				first_change[changed_sel.get_index(i)] = col_idx;
+			}
+		}
+		if (!last_keys.empty() && !Value::NotDistinctFrom(key.GetValue(0), last_keys[col_idx])) {
+			first_change[0] = col_idx;
+		}
+	}
+	if (last_keys.empty()) {
+		// the first row starts everything
+		first_change[0] = 0;
+	}
+	last_keys.clear();
+	for (idx_t col_idx = 0; col_idx < key_count; col_idx++) {
+		last_keys.push_back(keys.data[col_idx].GetValue(count - 1));
+	}
+
+	// record the boundaries
+	for (idx_t i = 0; i < count; i++) {
+		const auto row_idx = row_count + i;
+		if (row_idx == 0 || first_change[i] < partition_count) {
+			partition_starts.push_back(row_idx);
+		}
+		if (!track_peers) {
+			continue;
+		}
+		for (auto &function : functions) {
+			if (row_idx == 0 || first_change[i] < function->peer_count) {
+				function->peer_starts.push_back(row_idx);
+			}
+		}
+	}
+
+	// buffer the input and the arguments
+	if (arguments.ColumnCount()) {
+		arguments.Reset();
+		argument_executor.Execute(input, arguments);
+	}
+	for (idx_t col_idx = 0; col_idx < input.ColumnCount(); col_idx++) {
+		combined.data[col_idx].Reference(input.data[col_idx]);
+	}
+	for (idx_t col_idx = 0; col_idx < arguments.ColumnCount(); col_idx++) {
+		combined.data[input.ColumnCount() + col_idx].Reference(arguments.data[col_idx]);
+	}
+	combined.SetCardinality(count);
+	buffer.Append(combined, true);
+	row_count += count;
+}
+
+bool OrderedStreamingWindowState::Emit(const PhysicalOrderedStreamingWindow &op, DataChunk &chunk, bool final) {
+	// a row is ready once everything that its functions read has arrived
+	auto ready_end = row_count;
+	if (!final) {
+		ready_end = row_count > lookahead ? row_count - lookahead : 0;
+		for (auto &function : functions) {
+			if (function->frame.peer_end && !function->peer_starts.empty()) {
+				ready_end = MinValue(ready_end, function->peer_starts.back());
+			}
+		}
+		// the partitions that have ended are complete
+		if (!partition_starts.empty()) {
+			ready_end = MaxValue(ready_end, partition_starts.back());
+		}
+	}
+	if (ready_end <= output_row) {
+		return false;
+	}
+	const auto count = MinValue<idx_t>(ready_end - output_row, STANDARD_VECTOR_SIZE);
+
+	// the partitions of the rows
+	idx_t partition_begin[STANDARD_VECTOR_SIZE];
+	idx_t partition_end[STANDARD_VECTOR_SIZE];
+	for (idx_t i = 0; i < count; i++) {
+		const auto row_idx = output_row + i;
+		while (partition_starts.size() > 1 && partition_starts[1] <= row_idx) {
+			partition_starts.pop_front();
+		}
+		partition_begin[i] = partition_starts.front();
+		partition_end[i] = partition_starts.size() > 1 ? partition_starts[1] : row_count;
+	}
+
+	// the input columns
+	const auto offset = output_row - buffer_begin;
+	const auto input_width = op.children[0]->types.size();
+	for (idx_t col_idx = 0; col_idx < input_width; col_idx++) {
+		VectorOperations::Copy(buffer.data[col_idx], chunk.data[col_idx], offset + count, offset, 0);
+	}
+
+	// the window functions
+	for (idx_t expr_idx = 0; expr_idx < functions.size(); expr_idx++) {
+		auto &function = *functions[expr_idx];
+		auto &wexpr = function.wexpr;
+		auto &result = chunk.data[input_width + expr_idx];
+		idx_t default_count = 0;
+		for (idx_t i = 0; i < count; i++) {
+			const auto row_idx = output_row + i;
+			const auto pb = partition_begin[i];
+			const auto pe = partition_end[i];
+			idx_t peer_begin = row_idx;
+			idx_t peer_end = row_idx + 1;
+			if (track_peers) {
+				auto &peer_starts = function.peer_starts;
+				while (peer_starts.size() > 1 && peer_starts[1] <= row_idx) {
+					peer_starts.pop_front();
+				}
+				peer_begin = peer_starts.front();
+				peer_end = peer_starts.size() > 1 ? peer_starts[1] : row_count;
+				if (peer_begin == row_idx) {
+					function.dense_rank = (peer_begin == pb) ? 1 : function.dense_rank + 1;
+				}
+			}
+
+			idx_t frame_begin, frame_end;
+			switch (wexpr.type) {
+			case ExpressionType::WINDOW_ROW_NUMBER:
+				FlatVector::GetData<int64_t>(result)[i] = NumericCast<int64_t>(row_idx - pb + 1);
+				break;
+			case ExpressionType::WINDOW_RANK:
+				FlatVector::GetData<int64_t>(result)[i] = NumericCast<int64_t>(peer_begin - pb + 1);
+				break;
+			case ExpressionType::WINDOW_RANK_DENSE:
+				FlatVector::GetData<int64_t>(result)[i] = function.dense_rank;
+				break;
+			case ExpressionType::WINDOW_LEAD:
+			case ExpressionType::WINDOW_LAG: {
+				const auto source = NumericCast<int64_t>(row_idx) + function.delta;
+				if (source >= NumericCast<int64_t>(pb) && source < NumericCast<int64_t>(pe)) {
+					source_sel.set_index(i, NumericCast<idx_t>(source) - buffer_begin);
+				} else {
+					source_sel.set_index(i, offset + i);
+					default_sel.set_index(default_count++, i);
+				}
+				break;
+			}
+			case ExpressionType::WINDOW_FIRST_VALUE:
+			case ExpressionType::WINDOW_LAST_VALUE:
+				function.GetFrame(row_idx, pb, pe, peer_end, frame_begin, frame_end);
+				if (frame_begin < frame_end) {
+					const auto source =
+					    (wexpr.type == ExpressionType::WINDOW_FIRST_VALUE) ? frame_begin : frame_end - 1;
+					source_sel.set_index(i, source - buffer_begin);
+				} else {
+					source_sel.set_index(i, offset + i);
+					default_sel.set_index(default_count++, i);
+				}
+				break;
+			case ExpressionType::WINDOW_AGGREGATE:
+				function.GetFrame(row_idx, pb, pe, peer_end, frame_begin, frame_end);
+				if (function.frame.unbounded_begin) {
+					// keep a running aggregate per partition
+					if (function.state_partition != pb) {
+						if (function.state_partition != DConstants::INVALID_INDEX) {
+							function.DestroyState(running_allocator);
+						}
+						function.InitializeState();
+						function.state_partition = pb;
+						function.state_end = pb;
+					}
+					if (frame_end > function.state_end) {
+						function.UpdateState(buffer, running_allocator, function.state_end - buffer_begin,
+						                     frame_end - buffer_begin);
+						function.state_end = frame_end;
+					}
+					function.FinalizeState(running_allocator, result, i);
+				} else {
+					function.InitializeState();
+					function.UpdateState(buffer, frame_allocator, frame_begin - buffer_begin, frame_end - buffer_begin);
+					function.FinalizeState(frame_allocator, result, i);
+					function.DestroyState(frame_allocator);
+				}
+				break;
+			default:
+				throw NotImplementedException("%s for OrderedStreamingWindow",
+				                              ExpressionTypeToString(wexpr.GetExpressionType()));
+			}
+		}
+
+		switch (wexpr.type) {
+		case ExpressionType::WINDOW_LEAD:
+		case ExpressionType::WINDOW_LAG:
+		case ExpressionType::WINDOW_FIRST_VALUE:
+		case ExpressionType::WINDOW_LAST_VALUE: {
+			VectorOperations::Copy(buffer.data[function.argument_idx], result, source_sel, count, 0, 0);
+			// the rows that read outside of the partition (or have an empty frame)
+			for (idx_t i = 0; i < default_count; i++) {
+				result.SetValue(default_sel.get_index(i), function.default_value);
+			}
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	chunk.SetCardinality(count);
+	output_row += count;
+	frame_allocator.Reset();
+	Compact();
+	return ready_end > output_row;
+}
+
+void OrderedStreamingWindowState::Compact() {
+	// only compact if it removes at least as many rows as it copies
+	const auto keep_begin = output_row > history ? output_row - history : 0;
+	const auto drop_count = keep_begin > buffer_begin ? keep_begin - buffer_begin : 0;
+	const auto keep_count = buffer.size() - drop_count;
+	if (drop_count < STANDARD_VECTOR_SIZE || drop_count < keep_count) {
+		return;
+	}
+	DataChunk compacted;
+	compacted.Initialize(allocator, buffer.GetTypes(), MaxValue<idx_t>(keep_count, STANDARD_VECTOR_SIZE));
+	buffer.Copy(compacted, drop_count);
+	buffer.Destroy();
+	buffer.Move(compacted);
+	buffer_begin = keep_begin;
+}
+
+unique_ptr<OperatorState> PhysicalOrderedStreamingWindow::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<OrderedStreamingWindowState>(context.client, *this);
+}
+
+OperatorResultType PhysicalOrderedStreamingWindow::Execute(ExecutionContext &context, DataChunk &input,
+                                                           DataChunk &chunk, GlobalOperatorState &gstate,
+                                                           OperatorState &state_p) const {
+	auto &state = state_p.Cast<OrderedStreamingWindowState>();
+	if (!state.appended) {
+		state.Append(input);
+		state.appended = true;
+	}
+	if (state.Emit(*this, chunk, false)) {
+		return OperatorResultType::HAVE_MORE_OUTPUT;
+	}
+	state.appended = false;
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+OperatorFinalizeResultType PhysicalOrderedStreamingWindow::FinalExecute(ExecutionContext &context, DataChunk &chunk,
+                                                                        GlobalOperatorState &gstate,
+                                                                        OperatorState &state_p) const {
+	auto &state = state_p.Cast<OrderedStreamingWindowState>();
+	if (state.Emit(*this, chunk, true)) {
+		return OperatorFinalizeResultType::HAVE_MORE_OUTPUT;
+	}
+	return OperatorFinalizeResultType::FINISHED;
+}
+
+string PhysicalOrderedStreamingWindow::ParamsToString() const {
+	string result;
+	for (idx_t i = 0; i < select_list.size(); i++) {
+		if (i > 0) {
+			result += "\n";
+		}
+		result += select_list[i]->GetName();
+	}
+	return result;
+}
+
+} // namespace duckdb
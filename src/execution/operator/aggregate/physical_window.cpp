@@ -260,14 +260,22 @@ public:
 	using Executors = vector<ExecutorPtr>;
 	using OrderMasks = PartitionGlobalHashGroup::OrderMasks;
 
+	using ScannerPtr = unique_ptr<RowDataCollectionScanner>;
+
 	WindowPartitionSourceState(ClientContext &context, WindowGlobalSourceState &gsource)
-	    : context(context), op(gsource.gsink.op), gsource(gsource), read_block_idx(0), unscanned(0) {
+	    : context(context), op(gsource.gsink.op), gsource(gsource), parallel_sink(false), sink_block_idx(0), sunk(0),
+	      finalized(false), read_block_idx(0), unscanned(0) {
 		layout.Initialize(gsource.gsink.global_partition->payload_types);
 	}
 
-	unique_ptr<RowDataCollectionScanner> GetScanner() const;
+	ScannerPtr GetScanner() const;
 	void MaterializeSortedData();
 	void BuildPartition(WindowGlobalSinkState &gstate, const idx_t hash_bin);
+	//! Claim the next block to sink into the executors
+	bool NextSinkBlock(idx_t &block_idx);
+	//! Sink the claimed block (and any unclaimed ones) into the executors.
+	//! The thread that sinks the last block finalizes the executors and returns a scanner for the first block.
+	ScannerPtr SinkBlocks(idx_t block_idx);
 
 	ClientContext &context;
 	const PhysicalWindow &op;
@@ -290,6 +298,15 @@ public:
 	//! The bin number
 	idx_t hash_bin;
 
+	//! Whether the blocks can be sunk into the executors by several threads
+	bool parallel_sink;
+	//! The next block to sink.
+	atomic<idx_t> sink_block_idx;
+	//! The number of blocks that have been sunk.
+	atomic<idx_t> sunk;
+	//! Whether the executors are ready to be evaluated.
+	atomic<bool> finalized;
+
 	//! The next block to read.
 	mutable atomic<idx_t> read_block_idx;
 	//! The number of remaining unscanned blocks.
@@ -335,7 +352,11 @@ void WindowPartitionSourceState::MaterializeSortedData() {
 	                              [&](idx_t c, const unique_ptr<RowDataBlock> &b) { return c + b->count; });
 }
 
-unique_ptr<RowDataCollectionScanner> WindowPartitionSourceState::GetScanner() const {
+WindowPartitionSourceState::ScannerPtr WindowPartitionSourceState::GetScanner() const {
+	//	We can't scan until the executors have seen all the data
+	if (!finalized) {
+		return nullptr;
+	}
 	auto &gsink = *gsource.gsink.global_partition;
 	if ((gsink.rows && !hash_bin) || hash_bin < gsink.hash_groups.size()) {
 		const auto block_idx = read_block_idx++;
@@ -418,35 +439,82 @@ void WindowPartitionSourceState::BuildPartition(WindowGlobalSinkState &gstate, c
 		executors.emplace_back(std::move(wexec));
 	}
 
-	//	First pass over the input without flushing
+	//	Small partitions are not worth splitting, and some executors need to see the data in order.
+	parallel_sink = rows->blocks.size() > 1;
+	for (auto &wexec : executors) {
+		parallel_sink = parallel_sink && wexec->SupportsParallelSink();
+	}
+
+	//	Start the block countdown
+	unscanned = rows->blocks.size();
+}
+
+bool WindowPartitionSourceState::NextSinkBlock(idx_t &block_idx) {
+	if (!rows || sink_block_idx >= rows->blocks.size()) {
+		return false;
+	}
+	block_idx = sink_block_idx++;
+	return block_idx < rows->blocks.size();
+}
+
+WindowPartitionSourceState::ScannerPtr WindowPartitionSourceState::SinkBlocks(idx_t block_idx) {
+	auto &gpart = *gsource.gsink.global_partition;
+
 	DataChunk input_chunk;
 	input_chunk.Initialize(gpart.allocator, gpart.payload_types);
-	auto scanner = make_uniq<RowDataCollectionScanner>(*rows, *heap, layout, external, false);
-	idx_t input_idx = 0;
+
+	vector<unique_ptr<WindowExecutorSinkState>> sink_states;
+	for (auto &wexec : executors) {
+		sink_states.emplace_back(wexec->GetSinkState());
+	}
+
+	//	First pass over the input without flushing
+	const auto block_count = rows->blocks.size();
 	while (true) {
-		input_chunk.Reset();
-		scanner->Scan(input_chunk);
-		if (input_chunk.size() == 0) {
-			break;
+		RowDataCollectionScanner scanner(*rows, *heap, layout, external, block_idx, false);
+		while (true) {
+			const auto input_idx = scanner.Scanned();
+			input_chunk.Reset();
+			scanner.Scan(input_chunk);
+			if (input_chunk.size() == 0) {
+				break;
+			}
+
+			for (idx_t expr_idx = 0; expr_idx < executors.size(); ++expr_idx) {
+				executors[expr_idx]->Sink(*sink_states[expr_idx], input_chunk, input_idx, rows->count);
+			}
 		}
 
-		//	TODO: Parallelization opportunity
-		for (auto &wexec : executors) {
-			wexec->Sink(input_chunk, input_idx, scanner->Count());
+		//	Claim the next block before reporting this one,
+		//	so the partition can't be finalized (and then released) while we are still using it.
+		idx_t next_block_idx;
+		const auto more = NextSinkBlock(next_block_idx);
+		const auto sunk_count = ++sunk;
+		if (more) {
+			block_idx = next_block_idx;
+			continue;
+		}
+		if (sunk_count < block_count) {
+			//	Someone else will finish the partition
+			return nullptr;
 		}
-		input_idx += input_chunk.size();
+		break;
 	}
 
+	//	All the data is in, so we can finalize
 	//	TODO: Parallelization opportunity
 	for (auto &wexec : executors) {
 		wexec->Finalize();
 	}
 
 	// External scanning assumes all blocks are swizzled.
-	scanner->ReSwizzle();
+	RowDataCollectionScanner(*rows, *heap, layout, external, false).ReSwizzle();
 
-	//	Start the block countdown
-	unscanned = rows->blocks.size();
+	//	Claim the first block to scan before anyone else can see the partition is ready
+	const auto first_block_idx = read_block_idx++;
+	--gsource.tasks_remaining;
+	finalized = true;
+	return make_uniq<RowDataCollectionScanner>(*rows, *heap, layout, external, first_block_idx, true);
 }
 
 // Per-thread scan state
@@ -495,16 +563,31 @@ WindowLocalSourceState::WindowLocalSourceState(WindowGlobalSourceState &gsource)
 }
 
 WindowGlobalSourceState::Task WindowGlobalSourceState::CreateTask(idx_t hash_bin) {
-	//	Build outside the lock so no one tries to steal before we are done.
 	auto partition_source = make_uniq<WindowPartitionSourceState>(context, *this);
 	partition_source->BuildPartition(gsink, hash_bin);
-	Task result(partition_source.get(), partition_source->GetScanner());
 
 	//	Is there any data to scan?
-	if (result.second) {
+	idx_t block_idx;
+	if (!partition_source->NextSinkBlock(block_idx)) {
+		return Task();
+	}
+
+	//	Publish the partition so other threads can help sink it,
+	//	otherwise sink it outside the lock so no one tries to steal before we are done.
+	auto &source = *partition_source;
+	if (source.parallel_sink) {
 		lock_guard<mutex> built_guard(built_lock);
 		built[hash_bin] = std::move(partition_source);
+	}
 
+	Task result(&source, source.SinkBlocks(block_idx));
+	if (partition_source) {
+		lock_guard<mutex> built_guard(built_lock);
+		built[hash_bin] = std::move(partition_source);
+	}
+
+	//	If another thread finished the build, it will hand out the blocks.
+	if (result.second) {
 		return result;
 	}
 
@@ -513,12 +596,25 @@ WindowGlobalSourceState::Task WindowGlobalSourceState::CreateTask(idx_t hash_bin
 
 WindowGlobalSourceState::Task WindowGlobalSourceState::StealWork() {
 	for (idx_t hash_bin = 0; hash_bin < built.size(); ++hash_bin) {
-		lock_guard<mutex> built_guard(built_lock);
+		unique_lock<mutex> built_guard(built_lock);
 		auto &partition_source = built[hash_bin];
 		if (!partition_source) {
 			continue;
 		}
 
+		//	Help sink partitions that are still being built.
+		//	The claimed block keeps the partition alive after we release the lock.
+		idx_t block_idx;
+		if (partition_source->NextSinkBlock(block_idx)) {
+			auto &source = *partition_source;
+			built_guard.unlock();
+			Task result(&source, source.SinkBlocks(block_idx));
+			if (result.second) {
+				return result;
+			}
+			continue;
+		}
+
 		Task result(partition_source.get(), partition_source->GetScanner());
 
 		//	Is there any data to scan?
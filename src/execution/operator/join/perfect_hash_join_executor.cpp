@@ -17,125 +17,198 @@ bool PerfectHashJoinExecutor::CanDoPerfectHashJoin() {
 //===--------------------------------------------------------------------===//
 // Build
 //===--------------------------------------------------------------------===//
-bool PerfectHashJoinExecutor::BuildPerfectHashTable(LogicalType &key_type) {
-	// First, allocate memory for each build column
+bool PerfectHashJoinExecutor::BuildPerfectHashTable() {
 	auto build_size = perfect_join_statistics.build_range + 1;
-	for (const auto &type : join.rhs_output_types) {
-		perfect_hash_table.emplace_back(type, build_size);
+	if (build_size > MAX_DENSE_BUILD_SIZE && build_size > ht.Count() * MAX_BUILD_SPARSITY) {
+		// the build side is too sparse to justify allocating the whole range
+		return false;
 	}
 
-	// and for duplicate_checking
-	bitmap_build_idx = make_unsafe_uniq_array<bool>(build_size);
-	memset(bitmap_build_idx.get(), 0, sizeof(bool) * build_size); // set false
-
-	// Now fill columns with build data
+	// The first key varies fastest in the packed index
+	D_ASSERT(perfect_join_statistics.key_ranges.size() == ht.equality_types.size());
+	idx_t multiplier = 1;
+	for (auto &key_range : perfect_join_statistics.key_ranges) {
+		key_multipliers.push_back(multiplier);
+		multiplier *= key_range + 1;
+	}
+	D_ASSERT(multiplier == build_size);
 
-	return FullScanHashTable(key_type);
+	// Now fill the perfect hash table with the build data
+	return FullScanHashTable();
 }
 
-bool PerfectHashJoinExecutor::FullScanHashTable(LogicalType &key_type) {
+bool PerfectHashJoinExecutor::FullScanHashTable() {
 	auto &data_collection = ht.GetDataCollection();
 
 	// TODO: In a parallel finalize: One should exclusively lock and each thread should do one part of the code below.
 	Vector tuples_addresses(LogicalType::POINTER, ht.Count()); // allocate space for all the tuples
 
-	idx_t key_count = 0;
+	idx_t tuple_count = 0;
 	if (data_collection.ChunkCount() > 0) {
 		JoinHTScanState join_ht_state(data_collection, 0, data_collection.ChunkCount(),
 		                              TupleDataPinProperties::KEEP_EVERYTHING_PINNED);
 
 		// Go through all the blocks and fill the keys addresses
-		key_count = ht.FillWithHTOffsets(join_ht_state, tuples_addresses);
+		tuple_count = ht.FillWithHTOffsets(join_ht_state, tuples_addresses);
+	}
+	if (tuple_count > NumericLimits<uint32_t>::Maximum()) {
+		return false;
 	}
 
 	// Scan the build keys in the hash table
-	Vector build_vector(key_type, key_count);
-	RowOperations::FullScanColumn(ht.layout, tuples_addresses, build_vector, key_count, 0);
+	vector<Vector> build_keys;
+	for (idx_t key_idx = 0; key_idx < ht.equality_types.size(); key_idx++) {
+		build_keys.emplace_back(ht.equality_types[key_idx], tuple_count);
+		RowOperations::FullScanColumn(ht.layout, tuples_addresses, build_keys.back(), tuple_count, key_idx);
+	}
 
-	// Now fill the selection vector using the build keys and create a sequential vector
-	// TODO: add check for fast pass when probe is part of build domain
-	SelectionVector sel_build(key_count + 1);
-	SelectionVector sel_tuples(key_count + 1);
-	bool success = FillSelectionVectorSwitchBuild(build_vector, sel_build, sel_tuples, key_count);
+	// Compute the index of every tuple in the perfect hash table
+	SelectionVector sel_tuples(tuple_count + 1);
+	idx_t sel_count = tuple_count;
+	auto key_indices = make_unsafe_uniq_array<idx_t>(tuple_count + 1);
+	ComputeKeyIndices(build_keys, tuple_count, sel_tuples, sel_count, key_indices.get());
 
-	// early out
-	if (!success) {
-		return false;
+	// Count the tuples of every key
+	const auto build_size = perfect_join_statistics.build_range + 1;
+	bitmap_build_idx = make_unsafe_uniq_array<bool>(build_size);
+	memset(bitmap_build_idx.get(), 0, sizeof(bool) * build_size); // set false
+	unique_keys = 0;
+	for (idx_t i = 0; i < sel_count; i++) {
+		auto idx = key_indices[sel_tuples.get_index(i)];
+		if (bitmap_build_idx[idx]) {
+			has_duplicates = true;
+		} else {
+			bitmap_build_idx[idx] = true;
+			unique_keys++;
+		}
 	}
-	if (unique_keys == perfect_join_statistics.build_range + 1 && !ht.has_null) {
+	if (unique_keys == build_size && !has_duplicates && !ht.has_null) {
 		perfect_join_statistics.is_build_dense = true;
 	}
-	key_count = unique_keys; // do not consider keys out of the range
 
-	// Full scan the remaining build columns and fill the perfect hash table
-	const auto build_size = perfect_join_statistics.build_range + 1;
+	// Determine where every tuple goes in the perfect hash table
+	SelectionVector sel_build(sel_count + 1);
+	idx_t table_size;
+	if (!has_duplicates) {
+		// every tuple is stored at the index of its key
+		for (idx_t i = 0; i < sel_count; i++) {
+			sel_build.set_index(i, key_indices[sel_tuples.get_index(i)]);
+		}
+		table_size = build_size;
+	} else {
+		// the tuples are stored sorted by their key, the prefix sum of the key counts points to them
+		bitmap_build_idx.reset();
+		key_offsets = make_unsafe_uniq_array<uint32_t>(build_size + 1);
+		memset(key_offsets.get(), 0, sizeof(uint32_t) * (build_size + 1));
+		for (idx_t i = 0; i < sel_count; i++) {
+			key_offsets[key_indices[sel_tuples.get_index(i)]]++;
+		}
+		uint32_t offset = 0;
+		for (idx_t idx = 0; idx < build_size; idx++) {
+			auto key_tuple_count = key_offsets[idx];
+			key_offsets[idx] = offset;
+			offset += key_tuple_count;
+		}
+		key_offsets[build_size] = offset;
+		// place every tuple, moving the offset of its key forward
+		for (idx_t i = 0; i < sel_count; i++) {
+			auto idx = key_indices[sel_tuples.get_index(i)];
+			sel_build.set_index(i, key_offsets[idx]++);
+		}
+		// the offsets have moved to the start of the next key: move them back
+		for (idx_t idx = build_size; idx > 0; idx--) {
+			key_offsets[idx] = key_offsets[idx - 1];
+		}
+		key_offsets[0] = 0;
+		table_size = sel_count;
+	}
+
+	// Full scan the build columns and fill the perfect hash table
 	for (idx_t i = 0; i < join.rhs_output_types.size(); i++) {
-		auto &vector = perfect_hash_table[i];
+		perfect_hash_table.emplace_back(join.rhs_output_types[i], MaxValue<idx_t>(table_size, 1));
+		auto &vector = perfect_hash_table.back();
 		const auto output_col_idx = ht.output_columns[i];
 		D_ASSERT(vector.GetType() == ht.layout.GetTypes()[output_col_idx]);
-		if (build_size > STANDARD_VECTOR_SIZE) {
+		if (table_size > STANDARD_VECTOR_SIZE) {
 			auto &col_mask = FlatVector::Validity(vector);
-			col_mask.Initialize(build_size);
+			col_mask.Initialize(table_size);
 		}
-		data_collection.Gather(tuples_addresses, sel_tuples, key_count, output_col_idx, vector, sel_build, nullptr);
+		data_collection.Gather(tuples_addresses, sel_tuples, sel_count, output_col_idx, vector, sel_build, nullptr);
 	}
 
 	return true;
 }
 
-bool PerfectHashJoinExecutor::FillSelectionVectorSwitchBuild(Vector &source, SelectionVector &sel_vec,
-                                                             SelectionVector &seq_sel_vec, idx_t count) {
-	switch (source.GetType().InternalType()) {
-	case PhysicalType::INT8:
-		return TemplatedFillSelectionVectorBuild<int8_t>(source, sel_vec, seq_sel_vec, count);
-	case PhysicalType::INT16:
-		return TemplatedFillSelectionVectorBuild<int16_t>(source, sel_vec, seq_sel_vec, count);
-	case PhysicalType::INT32:
-		return TemplatedFillSelectionVectorBuild<int32_t>(source, sel_vec, seq_sel_vec, count);
-	case PhysicalType::INT64:
-		return TemplatedFillSelectionVectorBuild<int64_t>(source, sel_vec, seq_sel_vec, count);
-	case PhysicalType::UINT8:
-		return TemplatedFillSelectionVectorBuild<uint8_t>(source, sel_vec, seq_sel_vec, count);
-	case PhysicalType::UINT16:
-		return TemplatedFillSelectionVectorBuild<uint16_t>(source, sel_vec, seq_sel_vec, count);
-	case PhysicalType::UINT32:
-		return TemplatedFillSelectionVectorBuild<uint32_t>(source, sel_vec, seq_sel_vec, count);
-	case PhysicalType::UINT64:
-		return TemplatedFillSelectionVectorBuild<uint64_t>(source, sel_vec, seq_sel_vec, count);
-	default:
-		throw NotImplementedException("Type not supported for perfect hash join");
+void PerfectHashJoinExecutor::ComputeKeyIndices(vector<Vector> &keys, idx_t count, SelectionVector &sel,
+                                                idx_t &sel_count, idx_t indices[]) {
+	for (idx_t i = 0; i < count; i++) {
+		sel.set_index(i, i);
+		indices[i] = 0;
+	}
+	sel_count = count;
+	for (idx_t key_idx = 0; key_idx < keys.size(); key_idx++) {
+		auto &source = keys[key_idx];
+		auto multiplier = key_multipliers[key_idx];
+		switch (source.GetType().InternalType()) {
+		case PhysicalType::INT8:
+			TemplatedComputeKeyIndices<int8_t>(source, count, key_idx, multiplier, sel, sel_count, indices);
+			break;
+		case PhysicalType::INT16:
+			TemplatedComputeKeyIndices<int16_t>(source, count, key_idx, multiplier, sel, sel_count, indices);
+			break;
+		case PhysicalType::INT32:
+			TemplatedComputeKeyIndices<int32_t>(source, count, key_idx, multiplier, sel, sel_count, indices);
+			break;
+		case PhysicalType::INT64:
+			TemplatedComputeKeyIndices<int64_t>(source, count, key_idx, multiplier, sel, sel_count, indices);
+			break;
+		case PhysicalType::UINT8:
+			TemplatedComputeKeyIndices<uint8_t>(source, count, key_idx, multiplier, sel, sel_count, indices);
+			break;
+		case PhysicalType::UINT16:
+			TemplatedComputeKeyIndices<uint16_t>(source, count, key_idx, multiplier, sel, sel_count, indices);
+			break;
+		case PhysicalType::UINT32:
+			TemplatedComputeKeyIndices<uint32_t>(source, count, key_idx, multiplier, sel, sel_count, indices);
+			break;
+		case PhysicalType::UINT64:
+			TemplatedComputeKeyIndices<uint64_t>(source, count, key_idx, multiplier, sel, sel_count, indices);
+			break;
+		default:
+			throw NotImplementedException("Type not supported for perfect hash join");
+		}
 	}
 }
 
 template <typename T>
-bool PerfectHashJoinExecutor::TemplatedFillSelectionVectorBuild(Vector &source, SelectionVector &sel_vec,
-                                                                SelectionVector &seq_sel_vec, idx_t count) {
-	if (perfect_join_statistics.build_min.IsNull() || perfect_join_statistics.build_max.IsNull()) {
-		return false;
-	}
-	auto min_value = perfect_join_statistics.build_min.GetValueUnsafe<T>();
-	auto max_value = perfect_join_statistics.build_max.GetValueUnsafe<T>();
+void PerfectHashJoinExecutor::TemplatedComputeKeyIndices(Vector &source, idx_t count, idx_t key_idx,
+                                                         idx_t multiplier, SelectionVector &sel, idx_t &sel_count,
+                                                         idx_t indices[]) {
+	auto min_value = perfect_join_statistics.build_min[key_idx].GetValueUnsafe<T>();
+	auto max_value = perfect_join_statistics.build_max[key_idx].GetValueUnsafe<T>();
+
 	UnifiedVectorFormat vector_data;
 	source.ToUnifiedFormat(count, vector_data);
-	auto data = reinterpret_cast<T *>(vector_data.data);
-	// generate the selection vector
-	for (idx_t i = 0, sel_idx = 0; i < count; ++i) {
-		auto data_idx = vector_data.sel->get_index(i);
+	auto data = UnifiedVectorFormat::GetData<T>(vector_data);
+	auto &validity_mask = vector_data.validity;
+
+	// keep the rows for which the key is valid and in the range
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < sel_count; i++) {
+		auto row_idx = sel.get_index(i);
+		auto data_idx = vector_data.sel->get_index(row_idx);
+		if (!validity_mask.RowIsValid(data_idx)) {
+			continue;
+		}
 		auto input_value = data[data_idx];
-		// add index to selection vector if value in the range
-		if (min_value <= input_value && input_value <= max_value) {
-			auto idx = (idx_t)(input_value - min_value); // subtract min value to get the idx position
-			sel_vec.set_index(sel_idx, idx);
-			if (bitmap_build_idx[idx]) {
-				return false;
-			} else {
-				bitmap_build_idx[idx] = true;
-				unique_keys++;
-			}
-			seq_sel_vec.set_index(sel_idx++, i);
+		if (input_value < min_value || input_value > max_value) {
+			continue;
 		}
+		// subtract min value to get the idx position
+		indices[row_idx] += static_cast<idx_t>(input_value - min_value) * multiplier;
+		sel.set_index(result_count++, row_idx);
 	}
-	return true;
+	sel_count = result_count;
 }
 
 //===--------------------------------------------------------------------===//
@@ -150,14 +223,24 @@ public:
 		}
 		build_sel_vec.Initialize(STANDARD_VECTOR_SIZE);
 		probe_sel_vec.Initialize(STANDARD_VECTOR_SIZE);
-		seq_sel_vec.Initialize(STANDARD_VECTOR_SIZE);
+		found_sel_vec.Initialize(STANDARD_VECTOR_SIZE);
 	}
 
 	DataChunk join_keys;
 	ExpressionExecutor probe_executor;
 	SelectionVector build_sel_vec;
 	SelectionVector probe_sel_vec;
-	SelectionVector seq_sel_vec;
+	//! The rows of the input whose keys are in the range of the build side
+	SelectionVector found_sel_vec;
+	idx_t found_count = 0;
+	//! The index of every row of the input into the perfect hash table
+	idx_t key_indices[STANDARD_VECTOR_SIZE];
+
+	//! Whether the current input has more matches than fit in one output chunk
+	bool has_remaining = false;
+	//! The position in found_sel_vec, and in the matches of that row, from which to continue emitting matches
+	idx_t found_position = 0;
+	idx_t match_position = 0;
 };
 
 unique_ptr<OperatorState> PerfectHashJoinExecutor::GetOperatorState(ExecutionContext &context) {
@@ -168,20 +251,38 @@ unique_ptr<OperatorState> PerfectHashJoinExecutor::GetOperatorState(ExecutionCon
 OperatorResultType PerfectHashJoinExecutor::ProbePerfectHashTable(ExecutionContext &context, DataChunk &input,
                                                                   DataChunk &result, OperatorState &state_p) {
 	auto &state = state_p.Cast<PerfectHashJoinState>();
+	if (!state.has_remaining) {
+		// fetch the join keys from the chunk
+		state.join_keys.Reset();
+		state.probe_executor.Execute(input, state.join_keys);
+		// select the rows with keys in the min-max range, and compute their index
+		ComputeKeyIndices(state.join_keys.data, state.join_keys.size(), state.found_sel_vec, state.found_count,
+		                  state.key_indices);
+		state.found_position = 0;
+		state.match_position = 0;
+	}
+	if (has_duplicates) {
+		return ProbeDuplicates(input, result, state);
+	}
+	return ProbeUnique(input, result, state);
+}
+
+OperatorResultType PerfectHashJoinExecutor::ProbeUnique(DataChunk &input, DataChunk &result,
+                                                        PerfectHashJoinState &state) {
 	// keeps track of how many probe keys have a match
 	idx_t probe_sel_count = 0;
-
-	// fetch the join keys from the chunk
-	state.join_keys.Reset();
-	state.probe_executor.Execute(input, state.join_keys);
-	// select the keys that are in the min-max range
-	auto &keys_vec = state.join_keys.data[0];
-	auto keys_count = state.join_keys.size();
-	// todo: add check for fast pass when probe is part of build domain
-	FillSelectionVectorSwitchProbe(keys_vec, state.build_sel_vec, state.probe_sel_vec, keys_count, probe_sel_count);
+	for (idx_t i = 0; i < state.found_count; i++) {
+		auto row_idx = state.found_sel_vec.get_index(i);
+		auto idx = state.key_indices[row_idx];
+		// check for matches in the build
+		if (bitmap_build_idx[idx]) {
+			state.build_sel_vec.set_index(probe_sel_count, idx);
+			state.probe_sel_vec.set_index(probe_sel_count++, row_idx);
+		}
+	}
 
 	// If build is dense and probe is in build's domain, just reference probe
-	if (perfect_join_statistics.is_build_dense && keys_count == probe_sel_count) {
+	if (perfect_join_statistics.is_build_dense && input.size() == probe_sel_count) {
 		result.Reference(input);
 	} else {
 		// otherwise, filter it out the values that do not match
@@ -198,87 +299,38 @@ OperatorResultType PerfectHashJoinExecutor::ProbePerfectHashTable(ExecutionConte
 	return OperatorResultType::NEED_MORE_INPUT;
 }
 
-void PerfectHashJoinExecutor::FillSelectionVectorSwitchProbe(Vector &source, SelectionVector &build_sel_vec,
-                                                             SelectionVector &probe_sel_vec, idx_t count,
-                                                             idx_t &probe_sel_count) {
-	switch (source.GetType().InternalType()) {
-	case PhysicalType::INT8:
-		TemplatedFillSelectionVectorProbe<int8_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::INT16:
-		TemplatedFillSelectionVectorProbe<int16_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::INT32:
-		TemplatedFillSelectionVectorProbe<int32_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::INT64:
-		TemplatedFillSelectionVectorProbe<int64_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::UINT8:
-		TemplatedFillSelectionVectorProbe<uint8_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::UINT16:
-		TemplatedFillSelectionVectorProbe<uint16_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::UINT32:
-		TemplatedFillSelectionVectorProbe<uint32_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::UINT64:
-		TemplatedFillSelectionVectorProbe<uint64_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	default:
-		throw NotImplementedException("Type not supported");
-	}
-}
-
-template <typename T>
-void PerfectHashJoinExecutor::TemplatedFillSelectionVectorProbe(Vector &source, SelectionVector &build_sel_vec,
-                                                                SelectionVector &probe_sel_vec, idx_t count,
-                                                                idx_t &probe_sel_count) {
-	auto min_value = perfect_join_statistics.build_min.GetValueUnsafe<T>();
-	auto max_value = perfect_join_statistics.build_max.GetValueUnsafe<T>();
-
-	UnifiedVectorFormat vector_data;
-	source.ToUnifiedFormat(count, vector_data);
-	auto data = reinterpret_cast<T *>(vector_data.data);
-	auto validity_mask = &vector_data.validity;
-	// build selection vector for non-dense build
-	if (validity_mask->AllValid()) {
-		for (idx_t i = 0, sel_idx = 0; i < count; ++i) {
-			// retrieve value from vector
-			auto data_idx = vector_data.sel->get_index(i);
-			auto input_value = data[data_idx];
-			// add index to selection vector if value in the range
-			if (min_value <= input_value && input_value <= max_value) {
-				auto idx = (idx_t)(input_value - min_value); // subtract min value to get the idx position
-				                                             // check for matches in the build
-				if (bitmap_build_idx[idx]) {
-					build_sel_vec.set_index(sel_idx, idx);
-					probe_sel_vec.set_index(sel_idx++, i);
-					probe_sel_count++;
-				}
-			}
+OperatorResultType PerfectHashJoinExecutor::ProbeDuplicates(DataChunk &input, DataChunk &result,
+                                                            PerfectHashJoinState &state) {
+	// emit (probe row, build tuple) pairs until the output chunk is full
+	idx_t result_count = 0;
+	while (state.found_position < state.found_count && result_count < STANDARD_VECTOR_SIZE) {
+		auto row_idx = state.found_sel_vec.get_index(state.found_position);
+		auto idx = state.key_indices[row_idx];
+		const idx_t match_begin = key_offsets[idx] + state.match_position;
+		const idx_t match_end = key_offsets[idx + 1];
+		const auto emit_count = MinValue<idx_t>(match_end - match_begin, STANDARD_VECTOR_SIZE - result_count);
+		for (idx_t i = 0; i < emit_count; i++) {
+			state.build_sel_vec.set_index(result_count, match_begin + i);
+			state.probe_sel_vec.set_index(result_count++, row_idx);
 		}
-	} else {
-		for (idx_t i = 0, sel_idx = 0; i < count; ++i) {
-			// retrieve value from vector
-			auto data_idx = vector_data.sel->get_index(i);
-			if (!validity_mask->RowIsValid(data_idx)) {
-				continue;
-			}
-			auto input_value = data[data_idx];
-			// add index to selection vector if value in the range
-			if (min_value <= input_value && input_value <= max_value) {
-				auto idx = (idx_t)(input_value - min_value); // subtract min value to get the idx position
-				                                             // check for matches in the build
-				if (bitmap_build_idx[idx]) {
-					build_sel_vec.set_index(sel_idx, idx);
-					probe_sel_vec.set_index(sel_idx++, i);
-					probe_sel_count++;
-				}
-			}
+		if (match_begin + emit_count < match_end) {
+			// the output is full: continue with the remaining matches of this row next time
+			state.match_position += emit_count;
+			break;
 		}
+		state.found_position++;
+		state.match_position = 0;
+	}
+	state.has_remaining = state.found_position < state.found_count;
+
+	result.Slice(input, state.probe_sel_vec, result_count, 0);
+	for (idx_t i = 0; i < join.rhs_output_types.size(); i++) {
+		auto &result_vector = result.data[input.ColumnCount() + i];
+		D_ASSERT(result_vector.GetType() == ht.layout.GetTypes()[ht.output_columns[i]]);
+		result_vector.Reference(perfect_hash_table[i]);
+		result_vector.Slice(state.build_sel_vec, result_count);
 	}
+	return state.has_remaining ? OperatorResultType::HAVE_MORE_OUTPUT : OperatorResultType::NEED_MORE_INPUT;
 }
 
 } // namespace duckdb
@@ -13,6 +13,9 @@
 #include "duckdb/parallel/executor_task.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/storage/temporary_memory_manager.hpp"
@@ -87,8 +90,8 @@ PhysicalHashJoin::PhysicalHashJoin(LogicalOperator &op, unique_ptr<PhysicalOpera
 //===--------------------------------------------------------------------===//
 class HashJoinGlobalSinkState : public GlobalSinkState {
 public:
-	HashJoinGlobalSinkState(const PhysicalHashJoin &op, ClientContext &context_p)
-	    : context(context_p), num_threads(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads())),
+	HashJoinGlobalSinkState(const PhysicalHashJoin &op_p, ClientContext &context_p)
+	    : op(op_p), context(context_p), num_threads(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads())),
 	      temporary_memory_update_count(0),
 	      temporary_memory_state(TemporaryMemoryManager::Get(context).Register(context)), finalized(false),
 	      scanned_data(false) {
@@ -103,12 +106,26 @@ public:
 		probe_types.insert(probe_types.end(), op.condition_types.begin(), op.condition_types.end());
 		probe_types.insert(probe_types.end(), payload_types.begin(), payload_types.end());
 		probe_types.emplace_back(LogicalType::HASH);
+
+		// for join filter pushdown
+		for (auto &column : op.filter_pushdown) {
+			column.filter_data->Reset();
+			filter_pushdown_stats.push_back(InitializeFilterPushdownStats(op, column));
+		}
 	}
 
 	void ScheduleFinalize(Pipeline &pipeline, Event &event);
 	void InitializeProbeSpill();
+	//! Initializes the bloom filter for join filter pushdown (if any), which is built while finalizing the HT
+	void InitializeBloomFilter();
+	//! Computes the filters on the join keys and pushes them into the table scans on the probe side
+	void PushJoinFilters();
+
+	static unique_ptr<BaseStatistics> InitializeFilterPushdownStats(const PhysicalHashJoin &op,
+	                                                                const JoinFilterPushdownColumn &column);
 
 public:
+	const PhysicalHashJoin &op;
 	ClientContext &context;
 
 	const idx_t num_threads;
@@ -136,6 +153,13 @@ public:
 
 	//! Whether or not we have started scanning data using GetData
 	atomic<bool> scanned_data;
+
+	//! Min/max of the join keys for join filter pushdown (nullptr if the type does not support min/max pushdown)
+	vector<unique_ptr<BaseStatistics>> filter_pushdown_stats;
+	//! Bloom filter on the hashes of the join keys for join filter pushdown (if any)
+	unique_ptr<HashBloomFilter> bloom_filter;
+	//! Whether or not the join filters have been pushed into the probe side
+	bool pushed_join_filters = false;
 };
 
 class HashJoinLocalSinkState : public LocalSinkState {
@@ -155,6 +179,10 @@ public:
 
 		hash_table = op.InitializeHashTable(context);
 		hash_table->GetSinkCollection().InitializeAppendState(append_state);
+
+		for (auto &column : op.filter_pushdown) {
+			filter_pushdown_stats.push_back(HashJoinGlobalSinkState::InitializeFilterPushdownStats(op, column));
+		}
 	}
 
 public:
@@ -168,6 +196,9 @@ public:
 	//! Thread-local HT
 	unique_ptr<JoinHashTable> hash_table;
 
+	//! Thread-local min/max of the join keys for join filter pushdown
+	vector<unique_ptr<BaseStatistics>> filter_pushdown_stats;
+
 	//! For updating the temporary memory state
 	idx_t chunk_count;
 	static constexpr const idx_t CHUNK_COUNT_UPDATE_INTERVAL = 60;
@@ -232,6 +263,74 @@ unique_ptr<LocalSinkState> PhysicalHashJoin::GetLocalSinkState(ExecutionContext
 	return make_uniq<HashJoinLocalSinkState>(*this, context.client);
 }
 
+unique_ptr<BaseStatistics>
+HashJoinGlobalSinkState::InitializeFilterPushdownStats(const PhysicalHashJoin &op,
+                                                       const JoinFilterPushdownColumn &column) {
+	auto &type = op.condition_types[column.condition_idx];
+	switch (type.InternalType()) {
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+		return NumericStats::CreateEmpty(type).ToUnique();
+	default:
+		// no min/max pushdown for this type
+		return nullptr;
+	}
+}
+
+template <class T>
+static void TemplatedUpdateFilterPushdownStats(BaseStatistics &stats, Vector &keys, idx_t count) {
+	UnifiedVectorFormat vdata;
+	keys.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (vdata.validity.RowIsValid(idx)) {
+			NumericStats::Update<T>(stats, data[idx]);
+		}
+	}
+}
+
+static void UpdateFilterPushdownStats(BaseStatistics &stats, Vector &keys, idx_t count) {
+	switch (keys.GetType().InternalType()) {
+	case PhysicalType::UINT8:
+		return TemplatedUpdateFilterPushdownStats<uint8_t>(stats, keys, count);
+	case PhysicalType::UINT16:
+		return TemplatedUpdateFilterPushdownStats<uint16_t>(stats, keys, count);
+	case PhysicalType::UINT32:
+		return TemplatedUpdateFilterPushdownStats<uint32_t>(stats, keys, count);
+	case PhysicalType::UINT64:
+		return TemplatedUpdateFilterPushdownStats<uint64_t>(stats, keys, count);
+	case PhysicalType::UINT128:
+		return TemplatedUpdateFilterPushdownStats<uhugeint_t>(stats, keys, count);
+	case PhysicalType::INT8:
+		return TemplatedUpdateFilterPushdownStats<int8_t>(stats, keys, count);
+	case PhysicalType::INT16:
+		return TemplatedUpdateFilterPushdownStats<int16_t>(stats, keys, count);
+	case PhysicalType::INT32:
+		return TemplatedUpdateFilterPushdownStats<int32_t>(stats, keys, count);
+	case PhysicalType::INT64:
+		return TemplatedUpdateFilterPushdownStats<int64_t>(stats, keys, count);
+	case PhysicalType::INT128:
+		return TemplatedUpdateFilterPushdownStats<hugeint_t>(stats, keys, count);
+	case PhysicalType::FLOAT:
+		return TemplatedUpdateFilterPushdownStats<float>(stats, keys, count);
+	case PhysicalType::DOUBLE:
+		return TemplatedUpdateFilterPushdownStats<double>(stats, keys, count);
+	default:
+		throw InternalException("Unsupported type for join filter pushdown");
+	}
+}
+
 SinkResultType PhysicalHashJoin::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
 	auto &lstate = input.local_state.Cast<HashJoinLocalSinkState>();
 
@@ -239,6 +338,15 @@ SinkResultType PhysicalHashJoin::Sink(ExecutionContext &context, DataChunk &chun
 	lstate.join_keys.Reset();
 	lstate.join_key_executor.Execute(chunk, lstate.join_keys);
 
+	// keep track of the min/max of the join keys for join filter pushdown
+	for (idx_t filter_idx = 0; filter_idx < filter_pushdown.size(); filter_idx++) {
+		auto &stats = lstate.filter_pushdown_stats[filter_idx];
+		if (stats) {
+			auto &keys = lstate.join_keys.data[filter_pushdown[filter_idx].condition_idx];
+			UpdateFilterPushdownStats(*stats, keys, lstate.join_keys.size());
+		}
+	}
+
 	// build the HT
 	auto &ht = *lstate.hash_table;
 	if (payload_types.empty()) {
@@ -274,6 +382,12 @@ SinkCombineResultType PhysicalHashJoin::Combine(ExecutionContext &context, Opera
 		lstate.hash_table->GetSinkCollection().FlushAppendState(lstate.append_state);
 		lock_guard<mutex> local_ht_lock(gstate.lock);
 		gstate.local_hash_tables.push_back(std::move(lstate.hash_table));
+		for (idx_t filter_idx = 0; filter_idx < lstate.filter_pushdown_stats.size(); filter_idx++) {
+			auto &stats = lstate.filter_pushdown_stats[filter_idx];
+			if (stats) {
+				gstate.filter_pushdown_stats[filter_idx]->Merge(*stats);
+			}
+		}
 	}
 	auto &client_profiler = QueryProfiler::Get(context.client);
 	context.thread.profiler.Flush(*this, lstate.join_key_executor, "join_key_executor", 1);
@@ -348,6 +462,7 @@ public:
 	void FinishEvent() override {
 		sink.hash_table->GetDataCollection().VerifyEverythingPinned();
 		sink.hash_table->finalized = true;
+		sink.PushJoinFilters();
 	}
 
 	static constexpr const idx_t PARALLEL_CONSTRUCT_THRESHOLD = 1048576;
@@ -363,6 +478,49 @@ void HashJoinGlobalSinkState::ScheduleFinalize(Pipeline &pipeline, Event &event)
 	event.InsertEvent(std::move(new_event));
 }
 
+void HashJoinGlobalSinkState::InitializeBloomFilter() {
+	if (external || op.conditions.size() != 1 || op.filter_pushdown.empty()) {
+		// the stored hashes are only the hashes of the join key if there is a single join condition
+		return;
+	}
+	const auto count = hash_table->Count();
+	if (count == 0 || count * HashBloomFilter::BITS_PER_HASH / 2 > HashBloomFilter::MAXIMUM_SIZE * 8) {
+		// too many keys to get a selective bloom filter within the size limit
+		return;
+	}
+	bloom_filter = make_uniq<HashBloomFilter>(count);
+	hash_table->bloom_filter = bloom_filter.get();
+}
+
+void HashJoinGlobalSinkState::PushJoinFilters() {
+	if (pushed_join_filters) {
+		return;
+	}
+	pushed_join_filters = true;
+	hash_table->bloom_filter = nullptr;
+	for (idx_t filter_idx = 0; filter_idx < op.filter_pushdown.size(); filter_idx++) {
+		auto &column = op.filter_pushdown[filter_idx];
+		unique_ptr<TableFilter> min_max_filter;
+		auto &stats = filter_pushdown_stats[filter_idx];
+		if (stats && NumericStats::HasMinMax(*stats)) {
+			auto min = NumericStats::Min(*stats);
+			auto max = NumericStats::Max(*stats);
+			if (min == max) {
+				min_max_filter = make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, std::move(min));
+			} else if (min < max) {
+				auto and_filter = make_uniq<ConjunctionAndFilter>();
+				and_filter->child_filters.push_back(
+				    make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, std::move(min)));
+				and_filter->child_filters.push_back(
+				    make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO, std::move(max)));
+				min_max_filter = std::move(and_filter);
+			}
+			// otherwise no (non-NULL) keys were added: the stats are still empty
+		}
+		column.filter_data->Initialize(std::move(min_max_filter), std::move(bloom_filter));
+	}
+}
+
 void HashJoinGlobalSinkState::InitializeProbeSpill() {
 	lock_guard<mutex> guard(lock);
 	if (!probe_spill) {
@@ -486,6 +644,8 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 			sink.hash_table->PrepareExternalFinalize(sink.temporary_memory_state->GetReservation());
 			sink.ScheduleFinalize(pipeline, event);
 		}
+		// the min/max of the join keys covers all partitions, so we can push it already
+		sink.PushJoinFilters();
 		sink.finalized = true;
 		return SinkFinalizeType::READY;
 	} else {
@@ -500,15 +660,18 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	// check for possible perfect hash table
 	auto use_perfect_hash = sink.perfect_join_executor->CanDoPerfectHashJoin();
 	if (use_perfect_hash) {
-		D_ASSERT(ht.equality_types.size() == 1);
-		auto key_type = ht.equality_types[0];
-		use_perfect_hash = sink.perfect_join_executor->BuildPerfectHashTable(key_type);
+		use_perfect_hash = sink.perfect_join_executor->BuildPerfectHashTable();
 	}
 	// In case of a large build side or duplicates, use regular hash join
 	if (!use_perfect_hash) {
 		sink.perfect_join_executor.reset();
+		sink.InitializeBloomFilter();
 		sink.ScheduleFinalize(pipeline, event);
 	}
+	if (use_perfect_hash || ht.Count() == 0) {
+		// no finalize event was scheduled: push the join filters right away
+		sink.PushJoinFilters();
+	}
 	sink.finalized = true;
 	if (ht.Count() == 0 && EmptyResultIfRHSIsEmpty()) {
 		return SinkFinalizeType::NO_OUTPUT_POSSIBLE;
@@ -1093,8 +1256,10 @@ string PhysicalHashJoin::ParamsToString() const {
 	result += "\n[INFOSEPARATOR]\n";
 	if (perfect_join_statistics.is_build_small) {
 		// perfect hash join
-		result += "Build Min: " + perfect_join_statistics.build_min.ToString() + "\n";
-		result += "Build Max: " + perfect_join_statistics.build_max.ToString() + "\n";
+		for (idx_t key_idx = 0; key_idx < perfect_join_statistics.build_min.size(); key_idx++) {
+			result += "Build Min: " + perfect_join_statistics.build_min[key_idx].ToString() + "\n";
+			result += "Build Max: " + perfect_join_statistics.build_max[key_idx].ToString() + "\n";
+		}
 		result += "\n[INFOSEPARATOR]\n";
 	}
 	result += StringUtil::Format("EC: %llu\n", estimated_cardinality);
@@ -5,6 +5,7 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parallel/base_pipeline_event.hpp"
 #include "duckdb/parallel/executor_task.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/common/shared_ptr.hpp"
 
@@ -279,4 +280,21 @@ string PhysicalOrder::ParamsToString() const {
 	return result;
 }
 
+vector<SortedColumn> PhysicalOrder::GetOutputOrder() const {
+	// the order holds up to the first key that is not a column of the output
+	vector<SortedColumn> result;
+	for (auto &order : orders) {
+		if (order.expression->type != ExpressionType::BOUND_REF) {
+			break;
+		}
+		auto index = order.expression->Cast<BoundReferenceExpression>().index;
+		auto entry = std::find(projections.begin(), projections.end(), index);
+		if (entry == projections.end()) {
+			break;
+		}
+		result.emplace_back(NumericCast<idx_t>(entry - projections.begin()), order.type, order.null_order);
+	}
+	return result;
+}
+
 } // namespace duckdb
@@ -6,6 +6,11 @@
 #include "duckdb/common/value_operations/value_operations.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/storage/data_table.hpp"
 
 namespace duckdb {
@@ -84,7 +89,8 @@ public:
 public:
 	void Sink(DataChunk &input);
 	void Combine(TopNHeap &other);
-	void Reduce();
+	//! Reduces the heap to limit + offset rows if it has grown large enough - returns whether or not it did
+	bool Reduce();
 	void Finalize();
 
 	void ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_chunk);
@@ -275,11 +281,11 @@ void TopNHeap::Finalize() {
 	sort_state.Finalize();
 }
 
-void TopNHeap::Reduce() {
+bool TopNHeap::Reduce() {
 	idx_t min_sort_threshold = MaxValue<idx_t>(STANDARD_VECTOR_SIZE * 5ULL, 2ULL * (limit + offset));
 	if (sort_state.count < min_sort_threshold) {
 		// only reduce when we pass two times the limit + offset, or 5 vectors (whichever comes first)
-		return;
+		return false;
 	}
 	sort_state.Finalize();
 	TopNSortState new_state(*this);
@@ -306,6 +312,7 @@ void TopNHeap::Reduce() {
 	}
 
 	sort_state.Move(new_state);
+	return true;
 }
 
 void TopNHeap::ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_chunk) {
@@ -407,6 +414,37 @@ public:
 
 	mutex lock;
 	TopNHeap heap;
+
+	//! The boundary that the dynamic filter was last set to (if any)
+	mutex boundary_lock;
+	Value boundary;
+
+public:
+	//! Tightens the dynamic filter on the first order column to the boundary of a (local) heap, if it is tighter
+	void UpdateDynamicFilter(const BoundOrderByNode &order, DynamicFilterData &filter_data, const Value &new_boundary) {
+		if (new_boundary.IsNull()) {
+			// a NULL boundary cannot be expressed as a comparison
+			return;
+		}
+		lock_guard<mutex> guard(boundary_lock);
+		bool ascending = order.type == OrderType::ASCENDING;
+		if (!boundary.IsNull() && (ascending ? !(new_boundary < boundary) : !(new_boundary > boundary))) {
+			return;
+		}
+		boundary = new_boundary;
+		// rows that are tied with the boundary on the first column can still make it into the result
+		auto comparison =
+		    ascending ? ExpressionType::COMPARE_LESSTHANOREQUALTO : ExpressionType::COMPARE_GREATERTHANOREQUALTO;
+		unique_ptr<TableFilter> filter = make_uniq<ConstantFilter>(comparison, boundary);
+		if (order.null_order == OrderByNullType::NULLS_FIRST) {
+			// NULL values sort before the boundary
+			auto or_filter = make_uniq<ConjunctionOrFilter>();
+			or_filter->child_filters.push_back(std::move(filter));
+			or_filter->child_filters.push_back(make_uniq<IsNullFilter>());
+			filter = std::move(or_filter);
+		}
+		filter_data.Update(std::move(filter));
+	}
 };
 
 class TopNLocalState : public LocalSinkState {
@@ -424,6 +462,9 @@ unique_ptr<LocalSinkState> PhysicalTopN::GetLocalSinkState(ExecutionContext &con
 }
 
 unique_ptr<GlobalSinkState> PhysicalTopN::GetGlobalSinkState(ClientContext &context) const {
+	if (dynamic_filter) {
+		dynamic_filter->Reset();
+	}
 	return make_uniq<TopNGlobalState>(context, types, orders, limit, offset);
 }
 
@@ -434,7 +475,11 @@ SinkResultType PhysicalTopN::Sink(ExecutionContext &context, DataChunk &chunk, O
 	// append to the local sink state
 	auto &sink = input.local_state.Cast<TopNLocalState>();
 	sink.heap.Sink(chunk);
-	sink.heap.Reduce();
+	if (sink.heap.Reduce() && dynamic_filter) {
+		// the boundary of the heap moved: publish it to the table scan so it can skip rows that cannot qualify
+		auto &gstate = input.global_state.Cast<TopNGlobalState>();
+		gstate.UpdateDynamicFilter(orders[0], *dynamic_filter, sink.heap.boundary_values.GetValue(0, 0));
+	}
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
@@ -508,4 +553,16 @@ string PhysicalTopN::ParamsToString() const {
 	return result;
 }
 
+vector<SortedColumn> PhysicalTopN::GetOutputOrder() const {
+	vector<SortedColumn> result;
+	for (auto &order : orders) {
+		if (order.expression->type != ExpressionType::BOUND_REF) {
+			break;
+		}
+		auto index = order.expression->Cast<BoundReferenceExpression>().index;
+		result.emplace_back(index, order.type, order.null_order);
+	}
+	return result;
+}
+
 } // namespace duckdb
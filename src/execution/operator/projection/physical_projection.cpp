@@ -2,6 +2,8 @@
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/function/scalar/compressed_materialization_functions.hpp"
 
 namespace duckdb {
 
@@ -77,4 +79,39 @@ string PhysicalProjection::ParamsToString() const {
 	return extra_info;
 }
 
+//! The input column that the expression passes through, either as-is or (de)compressed
+static optional_idx GetOrderPreservingColumn(const Expression &expr) {
+	if (expr.type == ExpressionType::BOUND_REF) {
+		return expr.Cast<BoundReferenceExpression>().index;
+	}
+	if (expr.type != ExpressionType::BOUND_FUNCTION) {
+		return optional_idx();
+	}
+	auto &func = expr.Cast<BoundFunctionExpression>();
+	if (func.children.empty() || !CompressedMaterializationFunctions::PreservesOrder(func.function)) {
+		return optional_idx();
+	}
+	return GetOrderPreservingColumn(*func.children[0]);
+}
+
+vector<SortedColumn> PhysicalProjection::GetOutputOrder() const {
+	// the order holds up to the first sorted column that is projected out
+	vector<SortedColumn> result;
+	for (auto &sorted_column : children[0]->GetOutputOrder()) {
+		optional_idx column_index;
+		for (idx_t i = 0; i < select_list.size(); i++) {
+			auto input_column = GetOrderPreservingColumn(*select_list[i]);
+			if (input_column.IsValid() && input_column.GetIndex() == sorted_column.column_index) {
+				column_index = i;
+				break;
+			}
+		}
+		if (!column_index.IsValid()) {
+			break;
+		}
+		result.emplace_back(column_index.GetIndex(), sorted_column.type, sorted_column.null_order);
+	}
+	return result;
+}
+
 } // namespace duckdb
@@ -129,16 +129,25 @@ string PhysicalTableScan::ParamsToString() const {
 		}
 	}
 	if (function.filter_pushdown && table_filters) {
-		result += "\n[INFOSEPARATOR]\n";
-		result += "Filters: ";
+		string filters;
 		for (auto &f : table_filters->filters) {
 			auto &column_index = f.first;
 			auto &filter = f.second;
 			if (column_index < names.size()) {
-				result += filter->ToString(names[column_ids[column_index]]);
-				result += "\n";
+				auto filter_str = filter->ToString(names[column_ids[column_index]]);
+				if (filter_str.empty()) {
+					// dynamic filters that have not been computed (yet) are not shown
+					continue;
+				}
+				filters += filter_str;
+				filters += "\n";
 			}
 		}
+		if (!filters.empty()) {
+			result += "\n[INFOSEPARATOR]\n";
+			result += "Filters: ";
+			result += filters;
+		}
 	}
 	if (!extra_info.file_filters.empty()) {
 		result += "\n[INFOSEPARATOR]\n";
@@ -149,6 +158,22 @@ string PhysicalTableScan::ParamsToString() const {
 	return result;
 }
 
+vector<SortedColumn> PhysicalTableScan::GetOutputOrder() const {
+	vector<SortedColumn> result;
+	if (!function.row_id_order) {
+		return result;
+	}
+	// the rows are emitted in the order of their row ids
+	for (idx_t i = 0; i < types.size(); i++) {
+		auto column_id = column_ids[projection_ids.empty() ? i : projection_ids[i]];
+		if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+			result.emplace_back(i, OrderType::ASCENDING, OrderByNullType::NULLS_LAST);
+			break;
+		}
+	}
+	return result;
+}
+
 bool PhysicalTableScan::Equals(const PhysicalOperator &other_p) const {
 	if (type != other_p.type) {
 		return false;
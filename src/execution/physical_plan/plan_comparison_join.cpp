@@ -4,6 +4,7 @@
 #include "duckdb/execution/operator/join/physical_iejoin.hpp"
 #include "duckdb/execution/operator/join/physical_nested_loop_join.hpp"
 #include "duckdb/execution/operator/join/physical_piecewise_merge_join.hpp"
+#include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/function/table/table_scan.hpp"
@@ -14,6 +15,7 @@
 #include "duckdb/execution/operator/join/physical_blockwise_nl_join.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
 
 namespace duckdb {
@@ -47,12 +49,8 @@ void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &joi
 	if (op.join_type != JoinType::INNER) {
 		return;
 	}
-	// with one condition
-	if (op.conditions.size() != 1) {
-		return;
-	}
-	// with propagated statistics
-	if (op.join_stats.empty()) {
+	// with propagated statistics for every condition
+	if (op.join_stats.empty() || op.join_stats.size() != op.conditions.size() * 2) {
 		return;
 	}
 	for (auto &type : op.children[1]->types) {
@@ -81,44 +79,128 @@ void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &joi
 		}
 	}
 
-	// and when the build range is smaller than the threshold
-	auto &stats_build = *op.join_stats[1].get(); // rhs stats
-	if (!NumericStats::HasMinMax(stats_build)) {
-		return;
+	// and when the product of the build ranges is smaller than the threshold
+	idx_t build_size = 1;
+	bool is_probe_in_domain = true;
+	for (idx_t cond_idx = 0; cond_idx < op.conditions.size(); cond_idx++) {
+		auto &stats_probe = *op.join_stats[cond_idx * 2].get();     // lhs stats
+		auto &stats_build = *op.join_stats[cond_idx * 2 + 1].get(); // rhs stats
+		if (!NumericStats::HasMinMax(stats_build) || !NumericStats::HasMinMax(stats_probe)) {
+			return;
+		}
+		int64_t min_value, max_value;
+		if (!ExtractNumericValue(NumericStats::Min(stats_build), min_value) ||
+		    !ExtractNumericValue(NumericStats::Max(stats_build), max_value)) {
+			return;
+		}
+		int64_t key_range;
+		if (!TrySubtractOperator::Operation(max_value, min_value, key_range)) {
+			return;
+		}
+		if (NumericCast<idx_t>(key_range) >= PerfectHashJoinExecutor::MAX_BUILD_SIZE) {
+			return;
+		}
+		// the key ranges are multiplied, this cannot overflow as every range is below the threshold
+		build_size *= NumericCast<idx_t>(key_range) + 1;
+		if (build_size > PerfectHashJoinExecutor::MAX_BUILD_SIZE) {
+			return;
+		}
+
+		join_state.probe_min.push_back(NumericStats::Min(stats_probe));
+		join_state.probe_max.push_back(NumericStats::Max(stats_probe));
+		join_state.build_min.push_back(NumericStats::Min(stats_build));
+		join_state.build_max.push_back(NumericStats::Max(stats_build));
+		join_state.key_ranges.push_back(NumericCast<idx_t>(key_range));
+		if (NumericStats::Min(stats_build) > NumericStats::Min(stats_probe) ||
+		    NumericStats::Max(stats_probe) > NumericStats::Max(stats_build)) {
+			is_probe_in_domain = false;
+		}
 	}
-	int64_t min_value, max_value;
-	if (!ExtractNumericValue(NumericStats::Min(stats_build), min_value) ||
-	    !ExtractNumericValue(NumericStats::Max(stats_build), max_value)) {
-		return;
+	join_state.estimated_cardinality = op.estimated_cardinality;
+	join_state.build_range = build_size - 1;
+	join_state.is_probe_in_domain = is_probe_in_domain;
+	join_state.is_build_small = true;
+}
+
+//! Finds the table scan that produces column "column_idx" of "op" (if any), only looking through operators that do not
+//! modify the column, and for which removing rows that cannot find a join partner does not change the result
+static optional_ptr<PhysicalTableScan> FindProbeTableScan(PhysicalOperator &op, idx_t &column_idx) {
+	switch (op.type) {
+	case PhysicalOperatorType::TABLE_SCAN:
+		return &op.Cast<PhysicalTableScan>();
+	case PhysicalOperatorType::FILTER:
+		return FindProbeTableScan(*op.children[0], column_idx);
+	case PhysicalOperatorType::PROJECTION: {
+		auto &expr = *op.Cast<PhysicalProjection>().select_list[column_idx];
+		if (expr.type != ExpressionType::BOUND_REF) {
+			return nullptr;
+		}
+		column_idx = expr.Cast<BoundReferenceExpression>().index;
+		return FindProbeTableScan(*op.children[0], column_idx);
 	}
-	int64_t build_range;
-	if (!TrySubtractOperator::Operation(max_value, min_value, build_range)) {
-		return;
+	case PhysicalOperatorType::HASH_JOIN: {
+		// the probe-side columns come first in the output of a hash join
+		auto &join = op.Cast<PhysicalHashJoin>();
+		switch (join.join_type) {
+		case JoinType::INNER:
+		case JoinType::LEFT:
+		case JoinType::SEMI:
+		case JoinType::ANTI:
+		case JoinType::MARK:
+		case JoinType::SINGLE:
+			break;
+		default:
+			// for RIGHT/OUTER joins, removing probe-side rows changes which build-side rows are found
+			return nullptr;
+		}
+		if (column_idx >= join.children[0]->types.size()) {
+			return nullptr;
+		}
+		return FindProbeTableScan(*op.children[0], column_idx);
 	}
-
-	// Fill join_stats for invisible join
-	auto &stats_probe = *op.join_stats[0].get(); // lhs stats
-	if (!NumericStats::HasMinMax(stats_probe)) {
-		return;
+	default:
+		return nullptr;
 	}
+}
 
-	// The max size our build must have to run the perfect HJ
-	const idx_t MAX_BUILD_SIZE = 1000000;
-	join_state.probe_min = NumericStats::Min(stats_probe);
-	join_state.probe_max = NumericStats::Max(stats_probe);
-	join_state.build_min = NumericStats::Min(stats_build);
-	join_state.build_max = NumericStats::Max(stats_build);
-	join_state.estimated_cardinality = op.estimated_cardinality;
-	join_state.build_range = NumericCast<idx_t>(build_range);
-	if (join_state.build_range > MAX_BUILD_SIZE) {
+//! Pushes dynamic filters on the equality conditions of the hash join into table scans on the probe side,
+//! which are computed from the build side (min/max, bloom filter) once it has been materialized
+static void PlanJoinFilterPushdown(PhysicalHashJoin &join) {
+	switch (join.join_type) {
+	case JoinType::INNER:
+	case JoinType::SEMI:
+	case JoinType::RIGHT:
+	case JoinType::RIGHT_SEMI:
+		break;
+	default:
+		// probe-side rows without a join partner are (or affect) the result
 		return;
 	}
-	if (NumericStats::Min(stats_build) <= NumericStats::Min(stats_probe) &&
-	    NumericStats::Max(stats_probe) <= NumericStats::Max(stats_build)) {
-		join_state.is_probe_in_domain = true;
+	for (idx_t cond_idx = 0; cond_idx < join.conditions.size(); cond_idx++) {
+		auto &cond = join.conditions[cond_idx];
+		if (cond.comparison != ExpressionType::COMPARE_EQUAL || cond.left->type != ExpressionType::BOUND_REF) {
+			continue;
+		}
+		idx_t column_idx = cond.left->Cast<BoundReferenceExpression>().index;
+		auto scan = FindProbeTableScan(*join.children[0], column_idx);
+		if (!scan || !scan->function.dynamic_filter_pushdown) {
+			continue;
+		}
+		auto &key_type = cond.left->return_type;
+		if (scan->types[column_idx] != key_type) {
+			continue;
+		}
+		auto scan_column_idx = scan->projection_ids.empty() ? column_idx : scan->projection_ids[column_idx];
+		if (scan->column_ids[scan_column_idx] == COLUMN_IDENTIFIER_ROW_ID) {
+			continue;
+		}
+		auto filter_data = make_shared_ptr<DynamicFilterData>(key_type);
+		if (!scan->table_filters) {
+			scan->table_filters = make_uniq<TableFilterSet>();
+		}
+		scan->table_filters->PushFilter(scan_column_idx, make_uniq<DynamicFilter>(filter_data));
+		join.filter_pushdown.push_back(JoinFilterPushdownColumn {cond_idx, std::move(filter_data)});
 	}
-	join_state.is_build_small = true;
-	return;
 }
 
 static void RewriteJoinCondition(Expression &expr, idx_t offset) {
@@ -196,6 +278,7 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 		plan = make_uniq<PhysicalHashJoin>(op, std::move(left), std::move(right), std::move(op.conditions),
 		                                   op.join_type, op.left_projection_map, op.right_projection_map,
 		                                   std::move(op.mark_types), op.estimated_cardinality, perfect_join_stats);
+		PlanJoinFilterPushdown(plan->Cast<PhysicalHashJoin>());
 
 	} else {
 		static constexpr const idx_t NESTED_LOOP_JOIN_THRESHOLD = 5;
@@ -1,9 +1,29 @@
 #include "duckdb/execution/operator/order/physical_order.hpp"
+#include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/operator/logical_order.hpp"
 
 namespace duckdb {
 
+//! Whether the output of "plan" is already sorted by "orders"
+static bool IsSortedBy(PhysicalOperator &plan, const vector<BoundOrderByNode> &orders) {
+	auto sorted_columns = plan.GetOutputOrder();
+	if (sorted_columns.size() < orders.size()) {
+		return false;
+	}
+	for (idx_t i = 0; i < orders.size(); i++) {
+		auto &order = orders[i];
+		auto &sorted_column = sorted_columns[i];
+		if (order.expression->type != ExpressionType::BOUND_REF ||
+		    order.expression->Cast<BoundReferenceExpression>().index != sorted_column.column_index ||
+		    order.type != sorted_column.type || order.null_order != sorted_column.null_order) {
+			return false;
+		}
+	}
+	return true;
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalOrder &op) {
 	D_ASSERT(op.children.size() == 1);
 
@@ -17,6 +37,26 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalOrder &op)
 		} else {
 			projections = std::move(op.projections);
 		}
+
+		// skip the sort if the input is already sorted (and stays that way)
+		if (PreserveInsertionOrder(*plan) && IsSortedBy(*plan, op.orders)) {
+			bool identity = projections.size() == plan->types.size();
+			for (idx_t i = 0; identity && i < projections.size(); i++) {
+				identity = projections[i] == i;
+			}
+			if (identity) {
+				return plan;
+			}
+			vector<unique_ptr<Expression>> select_list;
+			for (auto &projection : projections) {
+				select_list.push_back(make_uniq<BoundReferenceExpression>(plan->types[projection], projection));
+			}
+			auto projection =
+			    make_uniq<PhysicalProjection>(op.types, std::move(select_list), op.estimated_cardinality);
+			projection->children.push_back(std::move(plan));
+			return std::move(projection);
+		}
+
 		auto order =
 		    make_uniq<PhysicalOrder>(op.types, std::move(op.orders), std::move(projections), op.estimated_cardinality);
 		order->children.push_back(std::move(plan));
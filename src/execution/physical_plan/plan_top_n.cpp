@@ -1,17 +1,211 @@
 #include "duckdb/execution/operator/order/physical_top_n.hpp"
+#include "duckdb/execution/operator/projection/physical_projection.hpp"
+#include "duckdb/execution/operator/projection/physical_tableinout_function.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/planner/operator/logical_top_n.hpp"
 
 namespace duckdb {
 
+//! Finds the table scan that produces column "column_idx" of "op" (if any), only looking through filters and
+//! projections that pass the column through unmodified
+static optional_ptr<PhysicalTableScan> FindTopNTableScan(PhysicalOperator &op, idx_t &column_idx) {
+	switch (op.type) {
+	case PhysicalOperatorType::TABLE_SCAN:
+		return &op.Cast<PhysicalTableScan>();
+	case PhysicalOperatorType::FILTER:
+		return FindTopNTableScan(*op.children[0], column_idx);
+	case PhysicalOperatorType::PROJECTION: {
+		auto &expr = *op.Cast<PhysicalProjection>().select_list[column_idx];
+		if (expr.type != ExpressionType::BOUND_REF) {
+			return nullptr;
+		}
+		column_idx = expr.Cast<BoundReferenceExpression>().index;
+		return FindTopNTableScan(*op.children[0], column_idx);
+	}
+	default:
+		return nullptr;
+	}
+}
+
+//! Pushes a dynamic filter on the first order column into the table scan, which is set to the boundary of the heap
+//! while the Top-N is running - this allows the scan to skip row groups that cannot make it into the result
+static void PlanTopNFilterPushdown(PhysicalTopN &top_n) {
+	auto &order_expr = *top_n.orders[0].expression;
+	if (order_expr.type != ExpressionType::BOUND_REF) {
+		return;
+	}
+	auto &key_type = order_expr.return_type;
+	switch (key_type.InternalType()) {
+	case PhysicalType::BOOL:
+	case PhysicalType::VARCHAR:
+		break;
+	default:
+		if (!TypeIsNumeric(key_type.InternalType())) {
+			// the boundary is pushed as a constant comparison, which only supports these types
+			return;
+		}
+		break;
+	}
+	idx_t column_idx = order_expr.Cast<BoundReferenceExpression>().index;
+	auto scan = FindTopNTableScan(*top_n.children[0], column_idx);
+	if (!scan || !scan->function.dynamic_filter_pushdown || scan->types[column_idx] != key_type) {
+		return;
+	}
+	auto scan_column_idx = scan->projection_ids.empty() ? column_idx : scan->projection_ids[column_idx];
+	if (scan->column_ids[scan_column_idx] == COLUMN_IDENTIFIER_ROW_ID) {
+		return;
+	}
+	auto filter_data = make_shared_ptr<DynamicFilterData>(key_type);
+	if (!scan->table_filters) {
+		scan->table_filters = make_uniq<TableFilterSet>();
+	}
+	scan->table_filters->PushFilter(scan_column_idx, make_uniq<DynamicFilter>(filter_data));
+	top_n.dynamic_filter = std::move(filter_data);
+}
+
+//! Late materialization: instead of carrying every column of a wide table scan through the Top-N heap, the scan only
+//! produces the order columns (and the filter columns) together with the row ids. The remaining columns are fetched
+//! by row id for the (few) rows that survive the Top-N.
+static unique_ptr<PhysicalOperator> TryLateMaterialization(LogicalTopN &op, unique_ptr<PhysicalOperator> &plan) {
+	if (NumericCast<idx_t>(op.limit) + NumericCast<idx_t>(op.offset) > PhysicalTopN::LATE_MATERIALIZATION_MAX_ROWS) {
+		return nullptr;
+	}
+
+	// we can look through a projection that only references columns of the scan
+	optional_ptr<PhysicalProjection> projection;
+	auto scan_op = plan.get();
+	if (plan->type == PhysicalOperatorType::PROJECTION) {
+		projection = &plan->Cast<PhysicalProjection>();
+		for (auto &expr : projection->select_list) {
+			if (expr->type != ExpressionType::BOUND_REF) {
+				return nullptr;
+			}
+		}
+		scan_op = plan->children[0].get();
+	}
+	if (scan_op->type != PhysicalOperatorType::TABLE_SCAN) {
+		return nullptr;
+	}
+	auto &scan = scan_op->Cast<PhysicalTableScan>();
+	if (!scan.function.late_materialization) {
+		return nullptr;
+	}
+
+	// find the scan columns that the orders reference
+	auto get_scan_index = [&](idx_t index) {
+		return projection ? projection->select_list[index]->Cast<BoundReferenceExpression>().index : index;
+	};
+	vector<idx_t> order_columns;
+	unordered_map<idx_t, idx_t> order_column_map;
+	for (auto &order : op.orders) {
+		ExpressionIterator::EnumerateExpression(order.expression, [&](Expression &expr) {
+			if (expr.type != ExpressionType::BOUND_REF) {
+				return;
+			}
+			auto scan_index = get_scan_index(expr.Cast<BoundReferenceExpression>().index);
+			if (order_column_map.find(scan_index) == order_column_map.end()) {
+				order_column_map[scan_index] = order_columns.size();
+				order_columns.push_back(scan_index);
+			}
+		});
+	}
+	if (order_columns.size() >= scan.types.size()) {
+		return nullptr; // there is nothing to fetch afterwards
+	}
+
+	// the fetch produces the original output of the scan
+	vector<column_t> fetch_column_ids;
+	for (idx_t i = 0; i < scan.types.size(); i++) {
+		fetch_column_ids.push_back(scan.column_ids[scan.projection_ids.empty() ? i : scan.projection_ids[i]]);
+	}
+	auto fetch_types = scan.types;
+
+	// narrow the scan down to the filter columns, the order columns and the row ids
+	vector<column_t> column_ids;
+	vector<idx_t> projection_ids;
+	unordered_map<idx_t, idx_t> column_map;
+	auto add_column = [&](idx_t column_index) {
+		auto entry = column_map.find(column_index);
+		if (entry != column_map.end()) {
+			return entry->second;
+		}
+		column_map[column_index] = column_ids.size();
+		column_ids.push_back(scan.column_ids[column_index]);
+		return column_ids.size() - 1;
+	};
+	if (scan.table_filters) {
+		auto table_filters = make_uniq<TableFilterSet>();
+		for (auto &entry : scan.table_filters->filters) {
+			table_filters->filters[add_column(entry.first)] = std::move(entry.second);
+		}
+		scan.table_filters = std::move(table_filters);
+	}
+	for (auto &scan_index : order_columns) {
+		projection_ids.push_back(add_column(scan.projection_ids.empty() ? scan_index : scan.projection_ids[scan_index]));
+	}
+	column_ids.push_back(COLUMN_IDENTIFIER_ROW_ID);
+	projection_ids.push_back(column_ids.size() - 1);
+
+	vector<LogicalType> types;
+	for (auto &projection_id : projection_ids) {
+		auto column_id = column_ids[projection_id];
+		types.push_back(column_id == COLUMN_IDENTIFIER_ROW_ID ? LogicalType::ROW_TYPE : scan.returned_types[column_id]);
+	}
+	scan.column_ids = std::move(column_ids);
+	scan.projection_ids = std::move(projection_ids);
+	scan.types = types;
+
+	// the Top-N now runs over the narrow scan
+	for (auto &order : op.orders) {
+		ExpressionIterator::EnumerateExpression(order.expression, [&](Expression &expr) {
+			if (expr.type != ExpressionType::BOUND_REF) {
+				return;
+			}
+			auto &bound_ref = expr.Cast<BoundReferenceExpression>();
+			bound_ref.index = order_column_map[get_scan_index(bound_ref.index)];
+		});
+	}
+	auto top_n = make_uniq<PhysicalTopN>(std::move(types), std::move(op.orders), NumericCast<idx_t>(op.limit),
+	                                     NumericCast<idx_t>(op.offset), op.estimated_cardinality);
+	if (projection) {
+		top_n->children.push_back(std::move(plan->children[0]));
+	} else {
+		top_n->children.push_back(std::move(plan));
+	}
+	PlanTopNFilterPushdown(*top_n);
+
+	// fetch the remaining columns for the rows that survived
+	auto bind_data = make_uniq<TableScanBindData>(scan.bind_data->Cast<TableScanBindData>().table);
+	auto fetch = make_uniq<PhysicalTableInOutFunction>(std::move(fetch_types), TableScanFunction::GetFetchFunction(),
+	                                                   std::move(bind_data), std::move(fetch_column_ids),
+	                                                   op.estimated_cardinality, vector<column_t>());
+	fetch->children.push_back(std::move(top_n));
+	if (!projection) {
+		return std::move(fetch);
+	}
+	plan->children[0] = std::move(fetch);
+	return std::move(plan);
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalTopN &op) {
 	D_ASSERT(op.children.size() == 1);
 
 	auto plan = CreatePlan(*op.children[0]);
 
+	auto late_materialized = TryLateMaterialization(op, plan);
+	if (late_materialized) {
+		return late_materialized;
+	}
+
 	auto top_n = make_uniq<PhysicalTopN>(op.types, std::move(op.orders), NumericCast<idx_t>(op.limit),
 	                                     NumericCast<idx_t>(op.offset), op.estimated_cardinality);
 	top_n->children.push_back(std::move(plan));
+	PlanTopNFilterPushdown(*top_n);
 	return std::move(top_n);
 }
 
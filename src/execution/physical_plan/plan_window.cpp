@@ -1,3 +1,4 @@
+#include "duckdb/execution/operator/aggregate/physical_ordered_streaming_window.hpp"
 #include "duckdb/execution/operator/aggregate/physical_streaming_window.hpp"
 #include "duckdb/execution/operator/aggregate/physical_window.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
@@ -10,6 +11,22 @@
 
 namespace duckdb {
 
+//! Whether the window functions can be streamed because the input is already sorted by their partitions and orders
+static bool IsOrderedStreaming(ClientContext &context, PhysicalOperator &plan,
+                               const vector<unique_ptr<Expression>> &select_list) {
+	optional_ptr<BoundWindowExpression> over_expr;
+	for (auto &expr : select_list) {
+		auto &wexpr = expr->Cast<BoundWindowExpression>();
+		if (!PhysicalOrderedStreamingWindow::IsStreamingFunction(context, wexpr)) {
+			return false;
+		}
+		if (!over_expr || wexpr.orders.size() > over_expr->orders.size()) {
+			over_expr = &wexpr;
+		}
+	}
+	return PhysicalOrderedStreamingWindow::IsOrderedBy(plan, *over_expr);
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalWindow &op) {
 	D_ASSERT(op.children.size() == 1);
 
@@ -120,7 +137,9 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalWindow &op
 
 		// Chain the new window operator on top of the plan
 		unique_ptr<PhysicalOperator> window;
-		if (i < blocking_count) {
+		if (i < blocking_count && PreserveInsertionOrder(*plan) && IsOrderedStreaming(context, *plan, select_list)) {
+			window = make_uniq<PhysicalOrderedStreamingWindow>(types, std::move(select_list), op.estimated_cardinality);
+		} else if (i < blocking_count) {
 			window = make_uniq<PhysicalWindow>(types, std::move(select_list), op.estimated_cardinality);
 		} else {
 			window = make_uniq<PhysicalStreamingWindow>(types, std::move(select_list), op.estimated_cardinality);
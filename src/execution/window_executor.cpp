@@ -798,18 +798,20 @@ static void PrepareInputExpressions(vector<unique_ptr<Expression>> &exprs, Expre
 WindowExecutor::WindowExecutor(BoundWindowExpression &wexpr, ClientContext &context, const idx_t payload_count,
                                const ValidityMask &partition_mask, const ValidityMask &order_mask)
     : wexpr(wexpr), context(context), payload_count(payload_count), partition_mask(partition_mask),
-      order_mask(order_mask), payload_collection(), payload_executor(context),
+      order_mask(order_mask), payload_collection(),
       range((HasPrecedingRange(wexpr) || HasFollowingRange(wexpr)) ? wexpr.orders[0].expression.get() : nullptr,
             context, payload_count) {
-	// TODO: child may be a scalar, don't need to materialize the whole collection then
+}
 
+WindowExecutorSinkState::WindowExecutorSinkState(BoundWindowExpression &wexpr, ClientContext &context,
+                                                 const WindowInputColumn &range_p)
+    : payload_executor(context), range(range_p.input_expr.expr, context) {
 	// evaluate inner expressions of window functions, could be more complex
 	PrepareInputExpressions(wexpr.children, payload_executor, payload_chunk);
+}
 
-	auto types = payload_chunk.GetTypes();
-	if (!types.empty()) {
-		payload_collection.Initialize(Allocator::Get(context), types);
-	}
+unique_ptr<WindowExecutorSinkState> WindowExecutor::GetSinkState() const {
+	return make_uniq<WindowExecutorSinkState>(wexpr, context, range);
 }
 
 unique_ptr<WindowExecutorState> WindowExecutor::GetExecutorState() const {
@@ -897,6 +899,49 @@ bool WindowAggregateExecutor::IsCustomAggregate() {
 	return (mode < WindowAggregationMode::COMBINE);
 }
 
+//! Returns the (constant) offset of a ROWS frame boundary from the current row, or -1 if there is none
+static int64_t GetSlidingOffset(ClientContext &context, WindowBoundary boundary, const unique_ptr<Expression> &expr) {
+	switch (boundary) {
+	case WindowBoundary::CURRENT_ROW_ROWS:
+		return 0;
+	case WindowBoundary::EXPR_PRECEDING_ROWS:
+	case WindowBoundary::EXPR_FOLLOWING_ROWS: {
+		// the offset has to be the same for every row
+		if (!expr || !expr->IsFoldable()) {
+			return -1;
+		}
+		auto offset = ExpressionExecutor::EvaluateScalar(context, *expr);
+		if (offset.IsNull() || !offset.type().IsIntegral()) {
+			return -1;
+		}
+		return MaxValue<int64_t>(offset.GetValue<int64_t>(), -1);
+	}
+	default:
+		return -1;
+	}
+}
+
+bool WindowAggregateExecutor::IsIncrementalAggregate() {
+	if (!wexpr.aggregate || wexpr.children.empty() || !wexpr.aggregate->remove) {
+		return false;
+	}
+
+	if (wexpr.exclude_clause != WindowExcludeMode::NO_OTHER) {
+		return false;
+	}
+
+	// sliding the frame only pays off if the frames move forward and are narrow: every thread starts by aggregating
+	// the first frame of the rows it evaluates from scratch
+	const auto start_offset = GetSlidingOffset(context, wexpr.start, wexpr.start_expr);
+	const auto end_offset = GetSlidingOffset(context, wexpr.end, wexpr.end_expr);
+	if (start_offset < 0 || end_offset < 0 ||
+	    idx_t(start_offset) + idx_t(end_offset) > WindowIncrementalAggregator::MAXIMUM_FRAME_SIZE) {
+		return false;
+	}
+
+	return (mode < WindowAggregationMode::COMBINE);
+}
+
 void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result,
                               WindowExecutorState &lstate) const {
 	auto &lbstate = lstate.Cast<WindowExecutorBoundsState>();
@@ -911,7 +956,7 @@ void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &res
 WindowAggregateExecutor::WindowAggregateExecutor(BoundWindowExpression &wexpr, ClientContext &context,
                                                  const idx_t count, const ValidityMask &partition_mask,
                                                  const ValidityMask &order_mask, WindowAggregationMode mode)
-    : WindowExecutor(wexpr, context, count, partition_mask, order_mask), mode(mode), filter_executor(context) {
+    : WindowExecutor(wexpr, context, count, partition_mask, order_mask), mode(mode) {
 
 	// Force naive for SEPARATE mode or for (currently!) unsupported functionality
 	const auto force_naive =
@@ -928,31 +973,55 @@ WindowAggregateExecutor::WindowAggregateExecutor(BoundWindowExpression &wexpr, C
 		    make_uniq<WindowConstantAggregator>(aggr, wexpr.return_type, partition_mask, wexpr.exclude_clause, count);
 	} else if (IsCustomAggregate()) {
 		aggregator = make_uniq<WindowCustomAggregator>(aggr, wexpr.return_type, wexpr.exclude_clause, count);
+	} else if (IsIncrementalAggregate()) {
+		// slide a single state along the partition for aggregates that can remove values
+		aggregator = make_uniq<WindowIncrementalAggregator>(aggr, wexpr.return_type, wexpr.exclude_clause, count);
 	} else {
 		// build a segment tree for frame-adhering aggregates
 		// see http://www.vldb.org/pvldb/vol8/p1058-leis.pdf
 		aggregator = make_uniq<WindowSegmentTree>(aggr, wexpr.return_type, mode, wexpr.exclude_clause, count);
 	}
+}
 
-	// evaluate the FILTER clause and stuff it into a large mask for compactness and reuse
-	if (wexpr.filter_expr) {
-		filter_executor.AddExpression(*wexpr.filter_expr);
-		filter_sel.Initialize(STANDARD_VECTOR_SIZE);
+class WindowAggregateSinkState : public WindowExecutorSinkState {
+public:
+	WindowAggregateSinkState(BoundWindowExpression &wexpr, ClientContext &context, const WindowInputColumn &range_p)
+	    : WindowExecutorSinkState(wexpr, context, range_p), filter_executor(context) {
+		// evaluate the FILTER clause and stuff it into a large mask for compactness and reuse
+		if (wexpr.filter_expr) {
+			filter_executor.AddExpression(*wexpr.filter_expr);
+			filter_sel.Initialize(STANDARD_VECTOR_SIZE);
+		}
 	}
+
+	ExpressionExecutor filter_executor;
+	SelectionVector filter_sel;
+};
+
+bool WindowAggregateExecutor::SupportsParallelSink() const {
+	D_ASSERT(aggregator);
+	return aggregator->SupportsParallelSink();
 }
 
-void WindowAggregateExecutor::Sink(DataChunk &input_chunk, const idx_t input_idx, const idx_t total_count) {
-	// TODO we could evaluate those expressions in parallel
+unique_ptr<WindowExecutorSinkState> WindowAggregateExecutor::GetSinkState() const {
+	return make_uniq<WindowAggregateSinkState>(wexpr, context, range);
+}
+
+void WindowAggregateExecutor::Sink(WindowExecutorSinkState &sstate, DataChunk &input_chunk, const idx_t input_idx,
+                                   const idx_t total_count) {
+	auto &lastate = sstate.Cast<WindowAggregateSinkState>();
+	auto &payload_chunk = lastate.payload_chunk;
+
 	idx_t filtered = 0;
 	SelectionVector *filtering = nullptr;
 	if (wexpr.filter_expr) {
-		filtering = &filter_sel;
-		filtered = filter_executor.SelectExpression(input_chunk, filter_sel);
+		filtering = &lastate.filter_sel;
+		filtered = lastate.filter_executor.SelectExpression(input_chunk, lastate.filter_sel);
 	}
 
 	if (!wexpr.children.empty()) {
 		payload_chunk.Reset();
-		payload_executor.Execute(input_chunk, payload_chunk);
+		lastate.payload_executor.Execute(input_chunk, payload_chunk);
 		payload_chunk.Verify();
 	} else if (aggregator) {
 		//	Zero-argument aggregate (e.g., COUNT(*)
@@ -960,9 +1029,9 @@ void WindowAggregateExecutor::Sink(DataChunk &input_chunk, const idx_t input_idx
 	}
 
 	D_ASSERT(aggregator);
-	aggregator->Sink(payload_chunk, filtering, filtered);
+	aggregator->Sink(payload_chunk, input_idx, filtering, filtered);
 
-	WindowExecutor::Sink(input_chunk, input_idx, total_count);
+	WindowExecutor::Sink(sstate, input_chunk, input_idx, total_count);
 }
 
 static void ApplyWindowStats(const WindowBoundary &boundary, FrameDelta &delta, BaseStatistics *base, bool is_start) {
@@ -1273,6 +1342,15 @@ WindowValueExecutor::WindowValueExecutor(BoundWindowExpression &wexpr, ClientCon
                                          const idx_t payload_count, const ValidityMask &partition_mask,
                                          const ValidityMask &order_mask)
     : WindowExecutor(wexpr, context, payload_count, partition_mask, order_mask) {
+	//	The payload is copied into place, so allocate it for the whole partition
+	vector<LogicalType> types;
+	for (auto &child : wexpr.children) {
+		types.push_back(child->return_type);
+	}
+	if (!types.empty() && payload_count) {
+		payload_collection.Initialize(Allocator::Get(context), types, payload_count);
+		payload_collection.SetCardinality(payload_count);
+	}
 }
 
 WindowNtileExecutor::WindowNtileExecutor(BoundWindowExpression &wexpr, ClientContext &context,
@@ -1281,7 +1359,8 @@ WindowNtileExecutor::WindowNtileExecutor(BoundWindowExpression &wexpr, ClientCon
     : WindowValueExecutor(wexpr, context, payload_count, partition_mask, order_mask) {
 }
 
-void WindowValueExecutor::Sink(DataChunk &input_chunk, const idx_t input_idx, const idx_t total_count) {
+void WindowValueExecutor::Sink(WindowExecutorSinkState &sstate, DataChunk &input_chunk, const idx_t input_idx,
+                               const idx_t total_count) {
 	// Single pass over the input to produce the global data.
 	// Vectorisation for the win...
 
@@ -1302,15 +1381,20 @@ void WindowValueExecutor::Sink(DataChunk &input_chunk, const idx_t input_idx, co
 	}
 
 	if (!wexpr.children.empty()) {
+		auto &payload_chunk = sstate.payload_chunk;
 		payload_chunk.Reset();
-		payload_executor.Execute(input_chunk, payload_chunk);
+		sstate.payload_executor.Execute(input_chunk, payload_chunk);
 		payload_chunk.Verify();
-		payload_collection.Append(payload_chunk, true);
+
+		//	Chunks may arrive out of order, so copy them into place
+		const auto count = input_chunk.size();
+		lock_guard<mutex> collection_guard(lock);
+		for (column_t c = 0; c < payload_chunk.ColumnCount(); ++c) {
+			VectorOperations::Copy(payload_chunk.data[c], payload_collection.data[c], count, 0, input_idx);
+		}
 
 		// process payload chunks while they are still piping hot
 		if (check_nulls) {
-			const auto count = input_chunk.size();
-
 			payload_chunk.Flatten();
 			UnifiedVectorFormat vdata;
 			payload_chunk.data[0].ToUnifiedFormat(count, vdata);
@@ -1320,24 +1404,25 @@ void WindowValueExecutor::Sink(DataChunk &input_chunk, const idx_t input_idx, co
 					ignore_nulls.Initialize(total_count);
 				}
 				// Write to the current position
+				idx_t i = 0;
 				if (input_idx % ValidityMask::BITS_PER_VALUE == 0) {
-					// If we are at the edge of an output entry, just copy the entries
+					// If we are at the edge of an output entry, just copy the full entries
 					auto dst = ignore_nulls.GetData() + ignore_nulls.EntryCount(input_idx);
 					auto src = vdata.validity.GetData();
-					for (auto entry_count = vdata.validity.EntryCount(count); entry_count-- > 0;) {
+					for (auto entry_count = count / ValidityMask::BITS_PER_VALUE; entry_count-- > 0;) {
 						*dst++ = *src++;
+						i += ValidityMask::BITS_PER_VALUE;
 					}
-				} else {
-					// If not, we have ragged data and need to copy one bit at a time.
-					for (idx_t i = 0; i < count; ++i) {
-						ignore_nulls.Set(input_idx + i, vdata.validity.RowIsValid(i));
-					}
+				}
+				// Ragged data (or the tail of an entry shared with the next chunk) is copied one bit at a time.
+				for (; i < count; ++i) {
+					ignore_nulls.Set(input_idx + i, vdata.validity.RowIsValid(i));
 				}
 			}
 		}
 	}
 
-	WindowExecutor::Sink(input_chunk, input_idx, total_count);
+	WindowExecutor::Sink(sstate, input_chunk, input_idx, total_count);
 }
 
 unique_ptr<WindowExecutorState> WindowValueExecutor::GetExecutorState() const {
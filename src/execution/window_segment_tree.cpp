@@ -21,18 +21,22 @@ WindowAggregatorState::WindowAggregatorState() : allocator(Allocator::DefaultAll
 WindowAggregator::WindowAggregator(AggregateObject aggr_p, const LogicalType &result_type_p,
                                    const WindowExcludeMode exclude_mode_p, idx_t partition_count_p)
     : aggr(std::move(aggr_p)), result_type(result_type_p), partition_count(partition_count_p),
-      state_size(aggr.function.state_size()), filter_pos(0), exclude_mode(exclude_mode_p) {
+      state_size(aggr.function.state_size()), exclude_mode(exclude_mode_p) {
 }
 
 WindowAggregator::~WindowAggregator() {
 }
 
-void WindowAggregator::Sink(DataChunk &payload_chunk, SelectionVector *filter_sel, idx_t filtered) {
+void WindowAggregator::Sink(DataChunk &payload_chunk, const idx_t input_idx, SelectionVector *filter_sel,
+                            idx_t filtered) {
+	//	Chunks may arrive out of order, so copy them into place
+	lock_guard<mutex> sink_guard(lock);
 	if (!inputs.ColumnCount() && payload_chunk.ColumnCount()) {
-		inputs.Initialize(Allocator::DefaultAllocator(), payload_chunk.GetTypes());
+		inputs.Initialize(Allocator::DefaultAllocator(), payload_chunk.GetTypes(), partition_count);
+		inputs.SetCardinality(partition_count);
 	}
-	if (inputs.ColumnCount()) {
-		inputs.Append(payload_chunk, true);
+	for (column_t c = 0; c < inputs.ColumnCount(); ++c) {
+		VectorOperations::Copy(payload_chunk.data[c], inputs.data[c], payload_chunk.size(), 0, input_idx);
 	}
 	if (filter_sel) {
 		//	Lazy instantiation
@@ -42,9 +46,8 @@ void WindowAggregator::Sink(DataChunk &payload_chunk, SelectionVector *filter_se
 			filter_mask.Initialize(filter_bits.data());
 		}
 		for (idx_t f = 0; f < filtered; ++f) {
-			filter_mask.SetValid(filter_pos + filter_sel->get_index(f));
+			filter_mask.SetValid(input_idx + filter_sel->get_index(f));
 		}
-		filter_pos += payload_chunk.size();
 	}
 }
 
@@ -113,7 +116,8 @@ void WindowConstantAggregator::AggegateFinal(Vector &result, idx_t rid) {
 	}
 }
 
-void WindowConstantAggregator::Sink(DataChunk &payload_chunk, SelectionVector *filter_sel, idx_t filtered) {
+void WindowConstantAggregator::Sink(DataChunk &payload_chunk, const idx_t input_idx, SelectionVector *filter_sel,
+                                    idx_t filtered) {
 	const auto chunk_begin = row;
 	const auto chunk_end = chunk_begin + payload_chunk.size();
 
@@ -594,6 +598,180 @@ void WindowNaiveAggregator::Evaluate(WindowAggregatorState &lstate, const DataCh
 	ldstate.Evaluate(bounds, result, count, row_idx);
 }
 
+//===--------------------------------------------------------------------===//
+// WindowIncrementalAggregator
+//===--------------------------------------------------------------------===//
+WindowIncrementalAggregator::WindowIncrementalAggregator(AggregateObject aggr, const LogicalType &result_type,
+                                                         const WindowExcludeMode exclude_mode_p, idx_t partition_count)
+    : WindowAggregator(std::move(aggr), result_type, exclude_mode_p, partition_count) {
+	D_ASSERT(WindowAggregator::aggr.function.remove);
+	D_ASSERT(exclude_mode == WindowExcludeMode::NO_OTHER);
+}
+
+WindowIncrementalAggregator::~WindowIncrementalAggregator() {
+}
+
+class WindowIncrementalState : public WindowAggregatorState {
+public:
+	explicit WindowIncrementalState(const WindowIncrementalAggregator &gstate);
+	~WindowIncrementalState() override;
+
+	void Evaluate(const DataChunk &bounds, Vector &result, idx_t count);
+
+protected:
+	//! Resets the aggregate state to an empty frame
+	void Reset();
+	//! Adds (or removes) the rows in [begin, end) to (from) the aggregate state
+	void Update(idx_t begin, idx_t end, bool remove);
+	//! Flush the buffered rows into the aggregate state
+	void FlushRows(bool remove);
+
+	//! The global state
+	const WindowIncrementalAggregator &gstate;
+	//! Data pointer that contains the single sliding state
+	vector<data_t> state;
+	//! A constant vector of pointers to "state", used for updating the state
+	Vector statep;
+	//! A flat vector with a single pointer to "state", used for finalizing the state
+	Vector statef;
+	//! Input data chunk, used for slicing the buffered rows
+	DataChunk leaves;
+	//! The buffered rows
+	SelectionVector update_sel;
+	//! Count of buffered rows
+	idx_t flush_count;
+	//! The frame [frame_begin, frame_end) that is currently aggregated in "state"
+	idx_t frame_begin;
+	idx_t frame_end;
+	//! The number of rows in the frame that are not ignored by the aggregate (i.e., no NULL inputs)
+	idx_t valid_count;
+};
+
+WindowIncrementalState::WindowIncrementalState(const WindowIncrementalAggregator &gstate)
+    : gstate(gstate), state(gstate.state_size), statep(Value::POINTER(CastPointerToValue(state.data()))),
+      statef(Value::POINTER(CastPointerToValue(state.data()))), flush_count(0), frame_begin(0), frame_end(0),
+      valid_count(0) {
+	statef.SetVectorType(VectorType::FLAT_VECTOR); // Prevent conversion of results to constants
+
+	auto &inputs = gstate.GetInputs();
+	if (inputs.ColumnCount() > 0) {
+		leaves.Initialize(Allocator::DefaultAllocator(), inputs.GetTypes());
+	}
+	update_sel.Initialize();
+
+	gstate.aggr.function.initialize(state.data());
+}
+
+WindowIncrementalState::~WindowIncrementalState() {
+	auto &aggr = gstate.aggr;
+	if (aggr.function.destructor) {
+		AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+		aggr.function.destructor(statef, aggr_input_data, 1);
+	}
+}
+
+void WindowIncrementalState::Reset() {
+	auto &aggr = gstate.aggr;
+	if (aggr.function.destructor) {
+		AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+		aggr.function.destructor(statef, aggr_input_data, 1);
+	}
+	aggr.function.initialize(state.data());
+	valid_count = 0;
+}
+
+void WindowIncrementalState::FlushRows(bool remove) {
+	if (!flush_count) {
+		return;
+	}
+
+	auto &inputs = gstate.GetInputs();
+	leaves.Slice(inputs, update_sel, flush_count);
+
+	auto &aggr = gstate.aggr;
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	if (remove) {
+		aggr.function.remove(leaves.data.data(), aggr_input_data, leaves.ColumnCount(), state.data(), flush_count);
+	} else if (aggr.function.simple_update) {
+		aggr.function.simple_update(leaves.data.data(), aggr_input_data, leaves.ColumnCount(), state.data(),
+		                            flush_count);
+	} else {
+		aggr.function.update(leaves.data.data(), aggr_input_data, leaves.ColumnCount(), statep, flush_count);
+	}
+
+	flush_count = 0;
+}
+
+void WindowIncrementalState::Update(idx_t begin, idx_t end, bool remove) {
+	auto &inputs = gstate.GetInputs();
+	auto &filter_mask = gstate.GetFilterMask();
+	for (auto f = begin; f < end; ++f) {
+		if (!filter_mask.RowIsValid(f)) {
+			continue;
+		}
+
+		bool valid = true;
+		for (auto &input : inputs.data) {
+			valid = valid && FlatVector::Validity(input).RowIsValid(f);
+		}
+		if (valid) {
+			if (remove) {
+				D_ASSERT(valid_count > 0);
+				--valid_count;
+			} else {
+				++valid_count;
+			}
+		}
+
+		update_sel[flush_count++] = UnsafeNumericCast<sel_t>(f);
+		if (flush_count >= STANDARD_VECTOR_SIZE) {
+			FlushRows(remove);
+		}
+	}
+	FlushRows(remove);
+}
+
+void WindowIncrementalState::Evaluate(const DataChunk &bounds, Vector &result, idx_t count) {
+	auto begins = FlatVector::GetData<const idx_t>(bounds.data[WINDOW_BEGIN]);
+	auto ends = FlatVector::GetData<const idx_t>(bounds.data[WINDOW_END]);
+
+	auto &aggr = gstate.aggr;
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	for (idx_t i = 0; i < count; ++i) {
+		const auto begin = begins[i];
+		const auto end = MaxValue(begins[i], ends[i]);
+
+		if (begin < frame_begin || end < frame_end ||
+		    (MinValue(begin, frame_end) - frame_begin) + (end - MaxValue(begin, frame_end)) > end - begin) {
+			//	The frame moved backwards, or sliding costs more than aggregating the new frame from scratch
+			Reset();
+			Update(begin, end, false);
+		} else {
+			//	Remove the rows that left the frame and add the ones that entered it
+			Update(frame_begin, MinValue(begin, frame_end), true);
+			if (!valid_count) {
+				//	Start from a clean state so that, e.g., SUM returns NULL for an empty frame
+				Reset();
+			}
+			Update(MaxValue(begin, frame_end), end, false);
+		}
+		frame_begin = begin;
+		frame_end = end;
+
+		aggr.function.finalize(statef, aggr_input_data, result, 1, i);
+	}
+}
+
+unique_ptr<WindowAggregatorState> WindowIncrementalAggregator::GetLocalState() const {
+	return make_uniq<WindowIncrementalState>(*this);
+}
+
+void WindowIncrementalAggregator::Evaluate(WindowAggregatorState &lstate, const DataChunk &bounds, Vector &result,
+                                           idx_t count, idx_t row_idx) const {
+	auto &listate = lstate.Cast<WindowIncrementalState>();
+	listate.Evaluate(bounds, result, count);
+}
+
 //===--------------------------------------------------------------------===//
 // WindowSegmentTree
 //===--------------------------------------------------------------------===//
@@ -1119,8 +1297,9 @@ WindowDistinctAggregator::~WindowDistinctAggregator() {
 	}
 }
 
-void WindowDistinctAggregator::Sink(DataChunk &arg_chunk, SelectionVector *filter_sel, idx_t filtered) {
-	WindowAggregator::Sink(arg_chunk, filter_sel, filtered);
+void WindowDistinctAggregator::Sink(DataChunk &arg_chunk, const idx_t input_idx, SelectionVector *filter_sel,
+                                    idx_t filtered) {
+	WindowAggregator::Sink(arg_chunk, input_idx, filter_sel, filtered);
 
 	//	We sort the arguments and use the partition index as a tie-breaker.
 	//	TODO: Use a hash table?
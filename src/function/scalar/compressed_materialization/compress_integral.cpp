@@ -6,7 +6,7 @@
 
 namespace duckdb {
 
-static string IntegralCompressFunctionName(const LogicalType &result_type) {
+string CMIntegralCompressFun::GetFunctionName(const LogicalType &result_type) {
 	return StringUtil::Format("__internal_compress_integral_%s",
 	                          StringUtil::Lower(LogicalTypeIdToString(result_type.id())));
 }
@@ -91,7 +91,7 @@ static scalar_function_t GetIntegralCompressFunctionInputSwitch(const LogicalTyp
 	}
 }
 
-static string IntegralDecompressFunctionName(const LogicalType &result_type) {
+string CMIntegralDecompressFun::GetFunctionName(const LogicalType &result_type) {
 	return StringUtil::Format("__internal_decompress_integral_%s",
 	                          StringUtil::Lower(LogicalTypeIdToString(result_type.id())));
 }
@@ -189,7 +189,7 @@ unique_ptr<FunctionData> CMIntegralDeserialize(Deserializer &deserializer, Scala
 }
 
 ScalarFunction CMIntegralCompressFun::GetFunction(const LogicalType &input_type, const LogicalType &result_type) {
-	ScalarFunction result(IntegralCompressFunctionName(result_type), {input_type, input_type}, result_type,
+	ScalarFunction result(GetFunctionName(result_type), {input_type, input_type}, result_type,
 	                      GetIntegralCompressFunctionInputSwitch(input_type, result_type),
 	                      CompressedMaterializationFunctions::Bind);
 	result.serialize = CMIntegralSerialize;
@@ -198,7 +198,7 @@ ScalarFunction CMIntegralCompressFun::GetFunction(const LogicalType &input_type,
 }
 
 static ScalarFunctionSet GetIntegralCompressFunctionSet(const LogicalType &result_type) {
-	ScalarFunctionSet set(IntegralCompressFunctionName(result_type));
+	ScalarFunctionSet set(CMIntegralCompressFun::GetFunctionName(result_type));
 	for (const auto &input_type : LogicalType::Integral()) {
 		if (GetTypeIdSize(result_type.InternalType()) < GetTypeIdSize(input_type.InternalType())) {
 			set.AddFunction(CMIntegralCompressFun::GetFunction(input_type, result_type));
@@ -214,7 +214,7 @@ void CMIntegralCompressFun::RegisterFunction(BuiltinFunctions &set) {
 }
 
 ScalarFunction CMIntegralDecompressFun::GetFunction(const LogicalType &input_type, const LogicalType &result_type) {
-	ScalarFunction result(IntegralDecompressFunctionName(result_type), {input_type, result_type}, result_type,
+	ScalarFunction result(GetFunctionName(result_type), {input_type, result_type}, result_type,
 	                      GetIntegralDecompressFunctionInputSwitch(input_type, result_type),
 	                      CompressedMaterializationFunctions::Bind);
 	result.serialize = CMIntegralSerialize;
@@ -223,7 +223,7 @@ ScalarFunction CMIntegralDecompressFun::GetFunction(const LogicalType &input_typ
 }
 
 static ScalarFunctionSet GetIntegralDecompressFunctionSet(const LogicalType &result_type) {
-	ScalarFunctionSet set(IntegralDecompressFunctionName(result_type));
+	ScalarFunctionSet set(CMIntegralDecompressFun::GetFunctionName(result_type));
 	for (const auto &input_type : CompressedMaterializationFunctions::IntegralTypes()) {
 		if (GetTypeIdSize(result_type.InternalType()) > GetTypeIdSize(input_type.InternalType())) {
 			set.AddFunction(CMIntegralDecompressFun::GetFunction(input_type, result_type));
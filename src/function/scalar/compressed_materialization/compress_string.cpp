@@ -5,7 +5,7 @@
 
 namespace duckdb {
 
-static string StringCompressFunctionName(const LogicalType &result_type) {
+string CMStringCompressFun::GetFunctionName(const LogicalType &result_type) {
 	return StringUtil::Format("__internal_compress_string_%s",
 	                          StringUtil::Lower(LogicalTypeIdToString(result_type.id())));
 }
@@ -93,7 +93,7 @@ static scalar_function_t GetStringCompressFunctionSwitch(const LogicalType &resu
 	}
 }
 
-static string StringDecompressFunctionName() {
+string CMStringDecompressFun::GetFunctionName() {
 	return "__internal_decompress_string";
 }
 
@@ -202,7 +202,7 @@ unique_ptr<FunctionData> CMStringCompressDeserialize(Deserializer &deserializer,
 }
 
 ScalarFunction CMStringCompressFun::GetFunction(const LogicalType &result_type) {
-	ScalarFunction result(StringCompressFunctionName(result_type), {LogicalType::VARCHAR}, result_type,
+	ScalarFunction result(GetFunctionName(result_type), {LogicalType::VARCHAR}, result_type,
 	                      GetStringCompressFunctionSwitch(result_type), CompressedMaterializationFunctions::Bind);
 	result.serialize = CMStringCompressSerialize;
 	result.deserialize = CMStringCompressDeserialize;
@@ -227,7 +227,7 @@ unique_ptr<FunctionData> CMStringDecompressDeserialize(Deserializer &deserialize
 }
 
 ScalarFunction CMStringDecompressFun::GetFunction(const LogicalType &input_type) {
-	ScalarFunction result(StringDecompressFunctionName(), {input_type}, LogicalType::VARCHAR,
+	ScalarFunction result(GetFunctionName(), {input_type}, LogicalType::VARCHAR,
 	                      GetStringDecompressFunctionSwitch(input_type), CompressedMaterializationFunctions::Bind,
 	                      nullptr, nullptr, StringDecompressLocalState::Init);
 	result.serialize = CMStringDecompressSerialize;
@@ -236,7 +236,7 @@ ScalarFunction CMStringDecompressFun::GetFunction(const LogicalType &input_type)
 }
 
 static ScalarFunctionSet GetStringDecompressFunctionSet() {
-	ScalarFunctionSet set(StringDecompressFunctionName());
+	ScalarFunctionSet set(CMStringDecompressFun::GetFunctionName());
 	for (const auto &input_type : CompressedMaterializationFunctions::StringTypes()) {
 		set.AddFunction(CMStringDecompressFun::GetFunction(input_type));
 	}
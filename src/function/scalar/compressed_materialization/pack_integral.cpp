@@ -0,0 +1,267 @@
+#include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/function/function_set.hpp"
+#include "duckdb/function/scalar/compressed_materialization_functions.hpp"
+
+namespace duckdb {
+
+static string IntegralPackFunctionName(const LogicalType &result_type) {
+	return StringUtil::Format("__internal_pack_integral_%s",
+	                          StringUtil::Lower(LogicalTypeIdToString(result_type.id())));
+}
+
+static string IntegralUnpackFunctionName(const LogicalType &result_type) {
+	return StringUtil::Format("__internal_unpack_integral_%s",
+	                          StringUtil::Lower(LogicalTypeIdToString(result_type.id())));
+}
+
+template <class T>
+static inline uint64_t PackedFieldToUBigInt(const T &input) {
+	return static_cast<uint64_t>(input);
+}
+
+template <>
+inline uint64_t PackedFieldToUBigInt(const uhugeint_t &input) {
+	return input.lower;
+}
+
+template <class T>
+static inline T GetPackedFieldMask(const uint8_t width) {
+	if (width >= sizeof(T) * 8) {
+		return NumericLimits<T>::Maximum();
+	}
+	return static_cast<T>((T(1) << width) - T(1));
+}
+
+template <>
+inline uhugeint_t GetPackedFieldMask(const uint8_t width) {
+	if (width >= 128) {
+		return NumericLimits<uhugeint_t>::Maximum();
+	}
+	return (uhugeint_t(1) << uhugeint_t(width)) - uhugeint_t(1);
+}
+
+//===--------------------------------------------------------------------===//
+// Pack
+//===--------------------------------------------------------------------===//
+// Every key is stored as (key - min + 1) at its own bit offset, the all-zeroes field is reserved for NULL
+template <class INPUT_TYPE, class RESULT_TYPE>
+static void TemplatedPackKey(Vector &input, Vector &min_vector, Vector &shift_vector, RESULT_TYPE *result_data,
+                             const idx_t count) {
+	D_ASSERT(min_vector.GetVectorType() == VectorType::CONSTANT_VECTOR);
+	D_ASSERT(shift_vector.GetVectorType() == VectorType::CONSTANT_VECTOR);
+	const auto min_val = static_cast<uint64_t>(ConstantVector::GetData<INPUT_TYPE>(min_vector)[0]);
+	const auto shift = ConstantVector::GetData<uint8_t>(shift_vector)[0];
+
+	UnifiedVectorFormat format;
+	input.ToUnifiedFormat(count, format);
+	const auto input_data = UnifiedVectorFormat::GetData<INPUT_TYPE>(format);
+	for (idx_t i = 0; i < count; i++) {
+		const auto idx = format.sel->get_index(i);
+		if (!format.validity.RowIsValid(idx)) {
+			continue;
+		}
+		const auto field = RESULT_TYPE(static_cast<uint64_t>(input_data[idx]) - min_val + 1);
+		result_data[i] |= static_cast<RESULT_TYPE>(field << shift);
+	}
+}
+
+template <class RESULT_TYPE>
+static void PackKey(Vector &input, Vector &min_vector, Vector &shift_vector, RESULT_TYPE *result_data,
+                    const idx_t count) {
+	switch (input.GetType().InternalType()) {
+	case PhysicalType::INT8:
+		return TemplatedPackKey<int8_t, RESULT_TYPE>(input, min_vector, shift_vector, result_data, count);
+	case PhysicalType::INT16:
+		return TemplatedPackKey<int16_t, RESULT_TYPE>(input, min_vector, shift_vector, result_data, count);
+	case PhysicalType::INT32:
+		return TemplatedPackKey<int32_t, RESULT_TYPE>(input, min_vector, shift_vector, result_data, count);
+	case PhysicalType::INT64:
+		return TemplatedPackKey<int64_t, RESULT_TYPE>(input, min_vector, shift_vector, result_data, count);
+	case PhysicalType::UINT8:
+		return TemplatedPackKey<uint8_t, RESULT_TYPE>(input, min_vector, shift_vector, result_data, count);
+	case PhysicalType::UINT16:
+		return TemplatedPackKey<uint16_t, RESULT_TYPE>(input, min_vector, shift_vector, result_data, count);
+	case PhysicalType::UINT32:
+		return TemplatedPackKey<uint32_t, RESULT_TYPE>(input, min_vector, shift_vector, result_data, count);
+	case PhysicalType::UINT64:
+		return TemplatedPackKey<uint64_t, RESULT_TYPE>(input, min_vector, shift_vector, result_data, count);
+	default:
+		throw InternalException("Unexpected input type in PackKey");
+	}
+}
+
+template <class RESULT_TYPE>
+static void IntegralPackFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	D_ASSERT(args.ColumnCount() % 3 == 0);
+	const auto count = args.size();
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<RESULT_TYPE>(result);
+	for (idx_t i = 0; i < count; i++) {
+		result_data[i] = RESULT_TYPE(0);
+	}
+	for (idx_t col_idx = 0; col_idx < args.ColumnCount(); col_idx += 3) {
+		PackKey<RESULT_TYPE>(args.data[col_idx], args.data[col_idx + 1], args.data[col_idx + 2], result_data, count);
+	}
+	if (args.AllConstant()) {
+		result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	}
+}
+
+static scalar_function_t GetIntegralPackFunction(const LogicalType &result_type) {
+	switch (result_type.id()) {
+	case LogicalTypeId::UTINYINT:
+		return IntegralPackFunction<uint8_t>;
+	case LogicalTypeId::USMALLINT:
+		return IntegralPackFunction<uint16_t>;
+	case LogicalTypeId::UINTEGER:
+		return IntegralPackFunction<uint32_t>;
+	case LogicalTypeId::UBIGINT:
+		return IntegralPackFunction<uint64_t>;
+	case LogicalTypeId::UHUGEINT:
+		return IntegralPackFunction<uhugeint_t>;
+	default:
+		throw InternalException("Unexpected result type in GetIntegralPackFunction");
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Unpack
+//===--------------------------------------------------------------------===//
+template <class INPUT_TYPE, class RESULT_TYPE>
+static void IntegralUnpackFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	D_ASSERT(args.ColumnCount() == 4);
+	D_ASSERT(args.data[1].GetVectorType() == VectorType::CONSTANT_VECTOR);
+	D_ASSERT(args.data[2].GetVectorType() == VectorType::CONSTANT_VECTOR);
+	D_ASSERT(args.data[3].GetVectorType() == VectorType::CONSTANT_VECTOR);
+	D_ASSERT(args.data[3].GetType() == result.GetType());
+	const auto shift = INPUT_TYPE(ConstantVector::GetData<uint8_t>(args.data[1])[0]);
+	const auto mask = GetPackedFieldMask<INPUT_TYPE>(ConstantVector::GetData<uint8_t>(args.data[2])[0]);
+	const auto min_val = static_cast<uint64_t>(ConstantVector::GetData<RESULT_TYPE>(args.data[3])[0]);
+	UnaryExecutor::ExecuteWithNulls<INPUT_TYPE, RESULT_TYPE>(
+	    args.data[0], result, args.size(), [&](const INPUT_TYPE &input, ValidityMask &validity, idx_t idx) {
+		    const auto field = PackedFieldToUBigInt<INPUT_TYPE>((input >> shift) & mask);
+		    if (field == 0) {
+			    validity.SetInvalid(idx);
+			    return RESULT_TYPE(0);
+		    }
+		    return static_cast<RESULT_TYPE>(min_val + (field - 1));
+	    });
+}
+
+template <class INPUT_TYPE>
+static scalar_function_t GetIntegralUnpackFunctionResultSwitch(const LogicalType &result_type) {
+	switch (result_type.InternalType()) {
+	case PhysicalType::INT8:
+		return IntegralUnpackFunction<INPUT_TYPE, int8_t>;
+	case PhysicalType::INT16:
+		return IntegralUnpackFunction<INPUT_TYPE, int16_t>;
+	case PhysicalType::INT32:
+		return IntegralUnpackFunction<INPUT_TYPE, int32_t>;
+	case PhysicalType::INT64:
+		return IntegralUnpackFunction<INPUT_TYPE, int64_t>;
+	case PhysicalType::UINT8:
+		return IntegralUnpackFunction<INPUT_TYPE, uint8_t>;
+	case PhysicalType::UINT16:
+		return IntegralUnpackFunction<INPUT_TYPE, uint16_t>;
+	case PhysicalType::UINT32:
+		return IntegralUnpackFunction<INPUT_TYPE, uint32_t>;
+	case PhysicalType::UINT64:
+		return IntegralUnpackFunction<INPUT_TYPE, uint64_t>;
+	default:
+		throw InternalException("Unexpected result type in GetIntegralUnpackFunctionResultSwitch");
+	}
+}
+
+static scalar_function_t GetIntegralUnpackFunctionInputSwitch(const LogicalType &input_type,
+                                                              const LogicalType &result_type) {
+	switch (input_type.id()) {
+	case LogicalTypeId::UTINYINT:
+		return GetIntegralUnpackFunctionResultSwitch<uint8_t>(result_type);
+	case LogicalTypeId::USMALLINT:
+		return GetIntegralUnpackFunctionResultSwitch<uint16_t>(result_type);
+	case LogicalTypeId::UINTEGER:
+		return GetIntegralUnpackFunctionResultSwitch<uint32_t>(result_type);
+	case LogicalTypeId::UBIGINT:
+		return GetIntegralUnpackFunctionResultSwitch<uint64_t>(result_type);
+	case LogicalTypeId::UHUGEINT:
+		return GetIntegralUnpackFunctionResultSwitch<uhugeint_t>(result_type);
+	default:
+		throw InternalException("Unexpected input type in GetIntegralUnpackFunctionInputSwitch");
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// (De)serialization
+//===--------------------------------------------------------------------===//
+static void CMPackSerialize(Serializer &serializer, const optional_ptr<FunctionData> bind_data,
+                            const ScalarFunction &function) {
+	serializer.WriteProperty(100, "arguments", function.arguments);
+	serializer.WriteProperty(101, "return_type", function.return_type);
+}
+
+static unique_ptr<FunctionData> CMIntegralPackDeserialize(Deserializer &deserializer, ScalarFunction &function) {
+	function.arguments = deserializer.ReadProperty<vector<LogicalType>>(100, "arguments");
+	auto return_type = deserializer.ReadProperty<LogicalType>(101, "return_type");
+	function.varargs = LogicalType::INVALID;
+	function.function = GetIntegralPackFunction(return_type);
+	return nullptr;
+}
+
+static unique_ptr<FunctionData> CMIntegralUnpackDeserialize(Deserializer &deserializer, ScalarFunction &function) {
+	function.arguments = deserializer.ReadProperty<vector<LogicalType>>(100, "arguments");
+	auto return_type = deserializer.ReadProperty<LogicalType>(101, "return_type");
+	function.function = GetIntegralUnpackFunctionInputSwitch(function.arguments[0], return_type);
+	return nullptr;
+}
+
+//===--------------------------------------------------------------------===//
+// Registration
+//===--------------------------------------------------------------------===//
+const vector<LogicalType> CMIntegralPackFun::PackedTypes() {
+	return {LogicalType::UTINYINT, LogicalType::USMALLINT, LogicalType::UINTEGER, LogicalType::UBIGINT,
+	        LogicalType::UHUGEINT};
+}
+
+ScalarFunction CMIntegralPackFun::GetFunction(const vector<LogicalType> &input_types, const LogicalType &result_type) {
+	ScalarFunction result(IntegralPackFunctionName(result_type), input_types, result_type,
+	                      GetIntegralPackFunction(result_type), CompressedMaterializationFunctions::Bind);
+	// NULL keys are packed into the reserved all-zeroes field, the result is never NULL
+	result.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+	result.serialize = CMPackSerialize;
+	result.deserialize = CMIntegralPackDeserialize;
+	return result;
+}
+
+void CMIntegralPackFun::RegisterFunction(BuiltinFunctions &set) {
+	for (const auto &result_type : PackedTypes()) {
+		auto function = GetFunction({}, result_type);
+		function.varargs = LogicalType::ANY;
+		set.AddFunction(function);
+	}
+}
+
+ScalarFunction CMIntegralUnpackFun::GetFunction(const LogicalType &input_type, const LogicalType &result_type) {
+	ScalarFunction result(IntegralUnpackFunctionName(result_type),
+	                      {input_type, LogicalType::UTINYINT, LogicalType::UTINYINT, result_type}, result_type,
+	                      GetIntegralUnpackFunctionInputSwitch(input_type, result_type),
+	                      CompressedMaterializationFunctions::Bind);
+	result.serialize = CMPackSerialize;
+	result.deserialize = CMIntegralUnpackDeserialize;
+	return result;
+}
+
+void CMIntegralUnpackFun::RegisterFunction(BuiltinFunctions &set) {
+	for (const auto &result_type : LogicalType::Integral()) {
+		if (GetTypeIdSize(result_type.InternalType()) > sizeof(uint64_t)) {
+			continue;
+		}
+		ScalarFunctionSet function_set(IntegralUnpackFunctionName(result_type));
+		for (const auto &input_type : CMIntegralPackFun::PackedTypes()) {
+			function_set.AddFunction(CMIntegralUnpackFun::GetFunction(input_type, result_type));
+		}
+		set.AddFunction(function_set);
+	}
+}
+
+} // namespace duckdb
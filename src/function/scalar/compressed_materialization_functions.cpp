@@ -19,9 +19,32 @@ unique_ptr<FunctionData> CompressedMaterializationFunctions::Bind(ClientContext
 }
 // LCOV_EXCL_STOP
 
+bool CompressedMaterializationFunctions::PreservesOrder(const ScalarFunction &function) {
+	// packing multiple values into one does not preserve the order of the first one, so we only list these
+	auto &name = function.name;
+	for (const auto &type : IntegralTypes()) {
+		if (name == CMIntegralCompressFun::GetFunctionName(type)) {
+			return true;
+		}
+	}
+	for (const auto &type : LogicalType::Integral()) {
+		if (name == CMIntegralDecompressFun::GetFunctionName(type)) {
+			return true;
+		}
+	}
+	for (const auto &type : StringTypes()) {
+		if (name == CMStringCompressFun::GetFunctionName(type)) {
+			return true;
+		}
+	}
+	return name == CMStringDecompressFun::GetFunctionName();
+}
+
 void BuiltinFunctions::RegisterCompressedMaterializationFunctions() {
 	Register<CMIntegralCompressFun>();
 	Register<CMIntegralDecompressFun>();
+	Register<CMIntegralPackFun>();
+	Register<CMIntegralUnpackFun>();
 	Register<CMStringCompressFun>();
 	Register<CMStringDecompressFun>();
 }
@@ -53,16 +53,28 @@ static void TemplatedCheckpointFunction(ClientContext &context, TableFunctionInp
 	transaction_manager.Checkpoint(context, FORCE);
 }
 
+static double CheckpointProgress(ClientContext &context, const FunctionData *bind_data_p,
+                                 const GlobalTableFunctionState *global_state) {
+	auto &bind_data = bind_data_p->Cast<CheckpointBindData>();
+	return StorageManager::Get(*bind_data.db.get_mutable()).GetCheckpointProgress();
+}
+
+template <bool FORCE>
+static TableFunction GetCheckpointFunction(vector<LogicalType> arguments) {
+	TableFunction function(std::move(arguments), TemplatedCheckpointFunction<FORCE>, CheckpointBind);
+	function.table_scan_progress = CheckpointProgress;
+	return function;
+}
+
 void CheckpointFunction::RegisterFunction(BuiltinFunctions &set) {
 	TableFunctionSet checkpoint("checkpoint");
-	checkpoint.AddFunction(TableFunction({}, TemplatedCheckpointFunction<false>, CheckpointBind));
-	checkpoint.AddFunction(TableFunction({LogicalType::VARCHAR}, TemplatedCheckpointFunction<false>, CheckpointBind));
+	checkpoint.AddFunction(GetCheckpointFunction<false>({}));
+	checkpoint.AddFunction(GetCheckpointFunction<false>({LogicalType::VARCHAR}));
 	set.AddFunction(checkpoint);
 
 	TableFunctionSet force_checkpoint("force_checkpoint");
-	force_checkpoint.AddFunction(TableFunction({}, TemplatedCheckpointFunction<true>, CheckpointBind));
-	force_checkpoint.AddFunction(
-	    TableFunction({LogicalType::VARCHAR}, TemplatedCheckpointFunction<true>, CheckpointBind));
+	force_checkpoint.AddFunction(GetCheckpointFunction<true>({}));
+	force_checkpoint.AddFunction(GetCheckpointFunction<true>({LogicalType::VARCHAR}));
 	set.AddFunction(force_checkpoint);
 }
 
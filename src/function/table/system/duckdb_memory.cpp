@@ -22,6 +22,15 @@ static unique_ptr<FunctionData> DuckDBMemoryBind(ClientContext &context, TableFu
 	names.emplace_back("temporary_storage_bytes");
 	return_types.emplace_back(LogicalType::BIGINT);
 
+	names.emplace_back("buffer_hits");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("buffer_loads");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("buffer_evictions");
+	return_types.emplace_back(LogicalType::BIGINT);
+
 	return nullptr;
 }
 
@@ -51,6 +60,12 @@ void DuckDBMemoryFunction(ClientContext &context, TableFunctionInput &data_p, Da
 		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.size)));
 		// temporary_storage_bytes, BIGINT
 		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.evicted_data)));
+		// buffer_hits, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.buffer_hits)));
+		// buffer_loads, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.buffer_loads)));
+		// buffer_evictions, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.buffer_evictions)));
 		count++;
 	}
 	output.SetCardinality(count);
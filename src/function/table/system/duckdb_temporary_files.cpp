@@ -19,6 +19,12 @@ static unique_ptr<FunctionData> DuckDBTemporaryFilesBind(ClientContext &context,
 	names.emplace_back("size");
 	return_types.emplace_back(LogicalType::BIGINT);
 
+	names.emplace_back("uncompressed_size");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("compressed_size");
+	return_types.emplace_back(LogicalType::BIGINT);
+
 	return nullptr;
 }
 
@@ -46,6 +52,10 @@ void DuckDBTemporaryFilesFunction(ClientContext &context, TableFunctionInput &da
 		output.SetValue(col++, count, entry.path);
 		// database_oid, BIGINT
 		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.size)));
+		// uncompressed_size, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.uncompressed_size)));
+		// compressed_size, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.compressed_size)));
 		count++;
 	}
 	output.SetCardinality(count);
@@ -0,0 +1,80 @@
+#include "duckdb/function/table/system_functions.hpp"
+
+#include "duckdb/storage/storage_manager.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/database_manager.hpp"
+
+namespace duckdb {
+
+struct PragmaWALCommitStatsData : public GlobalTableFunctionState {
+	PragmaWALCommitStatsData() : index(0) {
+	}
+
+	idx_t index;
+	vector<reference<AttachedDatabase>> databases;
+};
+
+static unique_ptr<FunctionData> PragmaWALCommitStatsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                         vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("database_name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("commits");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("syncs");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("avg_batch_size");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("max_batch_size");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("avg_sync_time_us");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("max_sync_time_us");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> PragmaWALCommitStatsInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<PragmaWALCommitStatsData>();
+	result->databases = DatabaseManager::Get(context).GetDatabases(context);
+	return std::move(result);
+}
+
+void PragmaWALCommitStatsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<PragmaWALCommitStatsData>();
+	idx_t row = 0;
+	for (; data.index < data.databases.size() && row < STANDARD_VECTOR_SIZE; data.index++) {
+		auto &db = data.databases[data.index].get();
+		if (db.IsSystem() || db.IsTemporary() || !db.GetCatalog().IsDuckCatalog()) {
+			continue;
+		}
+		auto stats = db.GetStorageManager().GetWALCommitStatistics();
+		idx_t col = 0;
+		output.data[col++].SetValue(row, Value(db.GetName()));
+		output.data[col++].SetValue(row, Value::BIGINT(NumericCast<int64_t>(stats.commits)));
+		output.data[col++].SetValue(row, Value::BIGINT(NumericCast<int64_t>(stats.syncs)));
+		output.data[col++].SetValue(row, stats.syncs == 0 ? Value()
+		                                                  : Value::DOUBLE(static_cast<double>(stats.commits) /
+		                                                                  static_cast<double>(stats.syncs)));
+		output.data[col++].SetValue(row, Value::BIGINT(NumericCast<int64_t>(stats.max_batch_size)));
+		output.data[col++].SetValue(row, stats.syncs == 0 ? Value()
+		                                                  : Value::DOUBLE(static_cast<double>(stats.total_sync_time) /
+		                                                                  static_cast<double>(stats.syncs)));
+		output.data[col++].SetValue(row, Value::BIGINT(NumericCast<int64_t>(stats.max_sync_time)));
+		row++;
+	}
+	output.SetCardinality(row);
+}
+
+void PragmaWALCommitStats::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("pragma_wal_commit_stats", {}, PragmaWALCommitStatsFunction,
+	                              PragmaWALCommitStatsBind, PragmaWALCommitStatsInit));
+}
+
+} // namespace duckdb
@@ -259,6 +259,84 @@ static void IndexScanFunction(ClientContext &context, TableFunctionInput &data_p
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Row Id Fetch
+//===--------------------------------------------------------------------===//
+struct TableFetchGlobalState : public GlobalTableFunctionState {
+	vector<storage_t> column_ids;
+};
+
+struct TableFetchLocalState : public LocalTableFunctionState {
+	TableFetchLocalState() : row_ids(LogicalType::ROW_TYPE) {
+	}
+
+	Vector row_ids;
+	ColumnFetchState fetch_state;
+	DataChunk fetch_chunk;
+};
+
+static unique_ptr<GlobalTableFunctionState> TableFetchInitGlobal(ClientContext &context,
+                                                                 TableFunctionInitInput &input) {
+	auto &bind_data = input.bind_data->Cast<TableScanBindData>();
+	auto result = make_uniq<TableFetchGlobalState>();
+	result->column_ids.reserve(input.column_ids.size());
+	for (auto &id : input.column_ids) {
+		result->column_ids.push_back(GetStorageIndex(bind_data.table, id));
+	}
+	return std::move(result);
+}
+
+static unique_ptr<LocalTableFunctionState> TableFetchInitLocal(ExecutionContext &context,
+                                                               TableFunctionInitInput &input,
+                                                               GlobalTableFunctionState *global_state) {
+	return make_uniq<TableFetchLocalState>();
+}
+
+static OperatorResultType TableFetchFunction(ExecutionContext &context, TableFunctionInput &data_p, DataChunk &input,
+                                             DataChunk &output) {
+	auto &bind_data = data_p.bind_data->Cast<TableScanBindData>();
+	auto &gstate = data_p.global_state->Cast<TableFetchGlobalState>();
+	auto &lstate = data_p.local_state->Cast<TableFetchLocalState>();
+	auto &storage = bind_data.table.GetStorage();
+	auto &transaction = DuckTransaction::Get(context.client, bind_data.table.catalog);
+	auto &local_storage = LocalStorage::Get(transaction);
+	if (lstate.fetch_chunk.ColumnCount() == 0) {
+		lstate.fetch_chunk.Initialize(context.client, output.GetTypes());
+	}
+
+	// the row ids are the last column of the input
+	const auto count = input.size();
+	auto &row_id_input = input.data[input.ColumnCount() - 1];
+	D_ASSERT(row_id_input.GetType() == LogicalType::ROW_TYPE);
+	VectorOperations::Copy(row_id_input, lstate.row_ids, count, 0, 0);
+	auto row_id_data = FlatVector::GetData<row_t>(lstate.row_ids);
+
+	// fetch the rows in order - rows in the transaction-local storage are fetched from there
+	output.Reset();
+	idx_t run_start = 0;
+	while (run_start < count) {
+		const auto is_local = row_id_data[run_start] >= MAX_ROW_ID;
+		idx_t run_end = run_start + 1;
+		while (run_end < count && (row_id_data[run_end] >= MAX_ROW_ID) == is_local) {
+			run_end++;
+		}
+		const auto run_count = run_end - run_start;
+		Vector run_row_ids(LogicalType::ROW_TYPE, data_ptr_cast(row_id_data + run_start));
+		lstate.fetch_chunk.Reset();
+		if (is_local) {
+			local_storage.FetchChunk(storage, run_row_ids, run_count, gstate.column_ids, lstate.fetch_chunk,
+			                         lstate.fetch_state);
+		} else {
+			storage.Fetch(transaction, lstate.fetch_chunk, gstate.column_ids, run_row_ids, run_count,
+			              lstate.fetch_state);
+		}
+		output.Append(lstate.fetch_chunk);
+		run_start = run_end;
+	}
+	D_ASSERT(output.size() == count);
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
 static void RewriteIndexExpression(Index &index, LogicalGet &get, Expression &expr, bool &rewrite_possible) {
 	if (expr.type == ExpressionType::BOUND_COLUMN_REF) {
 		auto &bound_colref = expr.Cast<BoundColumnRefExpression>();
@@ -398,6 +476,14 @@ TableFunction TableScanFunction::GetIndexScanFunction() {
 	return scan_function;
 }
 
+TableFunction TableScanFunction::GetFetchFunction() {
+	TableFunction fetch_function("table_fetch", {}, nullptr);
+	fetch_function.in_out_function = TableFetchFunction;
+	fetch_function.init_global = TableFetchInitGlobal;
+	fetch_function.init_local = TableFetchInitLocal;
+	return fetch_function;
+}
+
 TableFunction TableScanFunction::GetFunction() {
 	TableFunction scan_function("seq_scan", {}, TableScanFunc);
 	scan_function.init_local = TableScanInitLocal;
@@ -413,6 +499,10 @@ TableFunction TableScanFunction::GetFunction() {
 	scan_function.projection_pushdown = true;
 	scan_function.filter_pushdown = true;
 	scan_function.filter_prune = true;
+	scan_function.dynamic_filter_pushdown = true;
+	scan_function.in_filter_pushdown = true;
+	scan_function.late_materialization = true;
+	scan_function.row_id_order = true;
 	scan_function.serialize = TableScanSerialize;
 	scan_function.deserialize = TableScanDeserialize;
 	return scan_function;
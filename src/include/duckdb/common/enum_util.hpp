@@ -116,6 +116,8 @@ enum class DistinctType : uint8_t;
 
 enum class ErrorType : uint16_t;
 
+enum class EvictionQueueType : uint8_t;
+
 enum class ExceptionFormatValueType : uint8_t;
 
 enum class ExceptionType : uint8_t;
@@ -308,6 +310,8 @@ enum class TaskExecutionMode : uint8_t;
 
 enum class TaskExecutionResult : uint8_t;
 
+enum class TemporaryBufferSize : uint64_t;
+
 enum class TimestampCastResult : uint8_t;
 
 enum class TransactionType : uint8_t;
@@ -463,6 +467,9 @@ const char* EnumUtil::ToChars<DistinctType>(DistinctType value);
 template<>
 const char* EnumUtil::ToChars<ErrorType>(ErrorType value);
 
+template<>
+const char* EnumUtil::ToChars<EvictionQueueType>(EvictionQueueType value);
+
 template<>
 const char* EnumUtil::ToChars<ExceptionFormatValueType>(ExceptionFormatValueType value);
 
@@ -751,6 +758,9 @@ const char* EnumUtil::ToChars<TaskExecutionMode>(TaskExecutionMode value);
 template<>
 const char* EnumUtil::ToChars<TaskExecutionResult>(TaskExecutionResult value);
 
+template<>
+const char* EnumUtil::ToChars<TemporaryBufferSize>(TemporaryBufferSize value);
+
 template<>
 const char* EnumUtil::ToChars<TimestampCastResult>(TimestampCastResult value);
 
@@ -920,6 +930,9 @@ DistinctType EnumUtil::FromString<DistinctType>(const char *value);
 template<>
 ErrorType EnumUtil::FromString<ErrorType>(const char *value);
 
+template<>
+EvictionQueueType EnumUtil::FromString<EvictionQueueType>(const char *value);
+
 template<>
 ExceptionFormatValueType EnumUtil::FromString<ExceptionFormatValueType>(const char *value);
 
@@ -1208,6 +1221,9 @@ TaskExecutionMode EnumUtil::FromString<TaskExecutionMode>(const char *value);
 template<>
 TaskExecutionResult EnumUtil::FromString<TaskExecutionResult>(const char *value);
 
+template<>
+TemporaryBufferSize EnumUtil::FromString<TemporaryBufferSize>(const char *value);
+
 template<>
 TimestampCastResult EnumUtil::FromString<TimestampCastResult>(const char *value);
 
@@ -34,6 +34,7 @@ enum class PhysicalOperatorType : uint8_t {
 	RESERVOIR_SAMPLE,
 	STREAMING_SAMPLE,
 	STREAMING_WINDOW,
+	ORDERED_STREAMING_WINDOW,
 	PIVOT,
 	COPY_DATABASE,
 
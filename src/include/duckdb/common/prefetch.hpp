@@ -0,0 +1,25 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/prefetch.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+#if __GNUC__
+#define DUCKDB_PREFETCH(address) (__builtin_prefetch(address))
+#else
+#define DUCKDB_PREFETCH(address) ((void)(address))
+#endif
+
+namespace duckdb {
+
+//! Assume (1 << 23) = 8MB of shared last-level cache. Random accesses into data structures that fit in it are cheap,
+//! so software prefetching only pays off for data structures that are larger than this
+static constexpr const idx_t LAST_LEVEL_CACHE_SIZE = 8388608;
+
+} // namespace duckdb
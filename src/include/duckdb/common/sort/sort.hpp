@@ -22,6 +22,8 @@ struct SortConstants {
 	static constexpr idx_t MSD_RADIX_LOCATIONS = VALUES_PER_RADIX + 1;
 	static constexpr idx_t INSERTION_SORT_THRESHOLD = 24;
 	static constexpr idx_t MSD_RADIX_SORT_SIZE_THRESHOLD = 4;
+	//! The maximum number of sorted blocks that are merged at once during an external sort
+	static constexpr idx_t MAX_MERGE_FAN_IN = 64;
 };
 
 struct SortLayout {
@@ -67,6 +69,10 @@ public:
 	//! Print the sorted data to the console.
 	void Print();
 
+private:
+	//! Computes how many sorted blocks are merged at once in the next round
+	idx_t ComputeMergeFanIn() const;
+
 public:
 	//! The lock for updating the order global state
 	mutex lock;
@@ -91,11 +97,17 @@ public:
 	//! Whether we are doing an external sort
 	bool external;
 
-	//! Progress in merge path stage
+	//! Number of sorted blocks that are merged at once in the current round (2 if merging pairwise)
+	//! External sorts merge more blocks at once, which reduces the number of times that the data is spilled
+	idx_t merge_fan_in;
+
+	//! Progress in merge path stage (a "pair" is a group of merge_fan_in blocks when merging k-way)
 	idx_t pair_idx;
 	idx_t num_pairs;
 	idx_t l_start;
 	idx_t r_start;
+	//! Progress in the blocks of the current group when merging k-way
+	vector<idx_t> run_starts;
 };
 
 struct LocalSortState {
@@ -170,6 +182,13 @@ private:
 	unique_ptr<SortedBlock> right_input;
 	SortedBlock *result;
 
+	//! The readers, input slices and current radix pointers of the blocks that are merged k-way
+	vector<unique_ptr<SBScanState>> runs;
+	vector<unique_ptr<SortedBlock>> run_inputs;
+	vector<data_ptr_t> run_radix_ptrs;
+	//! The loser tree used for k-way merging: index 0 holds the winner, the other nodes hold the losers
+	vector<idx_t> loser_tree;
+
 private:
 	//! Computes the left and right block that will be merged next (Merge Path partition)
 	void GetNextPartition();
@@ -177,6 +196,25 @@ private:
 	void GetIntersection(const idx_t diagonal, idx_t &l_idx, idx_t &r_idx);
 	//! Compare values within SortedBlocks using a global index
 	int CompareUsingGlobalIndex(SBScanState &l, SBScanState &r, const idx_t l_idx, const idx_t r_idx);
+	//! Compare values within SortedBlocks using a global index, without using the progress of the merge
+	int CompareAtGlobalIndex(SBScanState &l, SBScanState &r, const idx_t l_idx, const idx_t r_idx);
+
+	//! Computes the slices of the group of blocks that will be merged next (k-way Merge Path partition)
+	void GetNextKWayPartition();
+	//! Finds the end of the partition with 'count' rows in every block of the group using multi-way binary search
+	void GetKWayIntersection(vector<unique_ptr<SBScanState>> &readers, const vector<idx_t> &counts,
+	                         const idx_t count, vector<idx_t> &ends);
+	//! Finds the next k-way partition and merges it using a loser tree
+	void MergeKWayPartition();
+	//! Whether the current row of run 'l' is smaller than the current row of run 'r' (exhausted runs are largest)
+	bool KWayRunIsSmaller(const idx_t l, const idx_t r);
+	//! Replays the matches of the loser tree from the leaf of a run up to the root
+	void AdjustLoserTree(idx_t run_idx);
+	//! Moves a run past the blocks that have been fully merged (releasing them), and pins its current block
+	void AdvanceRun(const idx_t run_idx);
+	//! Appends the current row of a run (and its heap entry if needed) to the result
+	void AppendRow(SBScanState &source, SortedData &source_data, SortedData &result_data, data_ptr_t &result_data_ptr,
+	               BufferHandle &result_heap_handle);
 
 	//! Finds the next partition and merges it
 	void MergePartition();
@@ -172,4 +172,26 @@ struct BaseSumOperation {
 	}
 };
 
+//! The inverse of BaseSumOperation for exact (integral) sums: removes values from the state
+template <class STATEOP>
+struct BaseSumRemoveOperation {
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void Operation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &) {
+		STATEOP::template RemoveValues<STATE>(state, 1);
+		state.value -= input;
+	}
+
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &, idx_t count) {
+		STATEOP::template RemoveValues<STATE>(state, count);
+		for (idx_t i = 0; i < count; i++) {
+			state.value -= input;
+		}
+	}
+
+	static bool IgnoreNull() {
+		return true;
+	}
+};
+
 } // namespace duckdb
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/optional_ptr.hpp"
 #include "duckdb/common/radix_partitioning.hpp"
 #include "duckdb/common/types/column/column_data_consumer.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
@@ -17,6 +18,7 @@
 #include "duckdb/common/types/row/tuple_data_layout.hpp"
 #include "duckdb/common/types/vector.hpp"
 #include "duckdb/execution/aggregate_hashtable.hpp"
+#include "duckdb/execution/ht_entry.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
@@ -27,6 +29,7 @@ class BufferHandle;
 class ColumnDataCollection;
 struct ColumnDataAppendState;
 struct ClientConfig;
+class HashBloomFilter;
 
 struct JoinHTScanState {
 public:
@@ -49,12 +52,15 @@ private:
    data ptrs. The storage looks like this internally.
    [SERIALIZED ROW][NEXT POINTER]
    [SERIALIZED ROW][NEXT POINTER]
-   There is a separate hash map of pointers that point into this table.
+   There is a separate hash map of entries that point into this table.
    This is what is used to resolve the hashes.
-   [POINTER]
-   [POINTER]
-   [POINTER]
-   The pointers are either NULL
+   [SALT][POINTER]
+   [SALT][POINTER]
+   [SALT][POINTER]
+   The entries are either empty, or point to the head of a chain of rows
+   whose hashes share the salt (the upper 16 bits of the hash). Collisions
+   between different salts are resolved with linear probing, so probes can
+   skip entries with a different salt without touching the row data.
 */
 class JoinHashTable {
 public:
@@ -105,6 +111,7 @@ public:
 		idx_t ScanInnerJoin(DataChunk &keys, SelectionVector &result_vector);
 
 	public:
+		//! Select the probe tuples that have a non-empty chain of rows
 		void InitializeSelectionVector(const SelectionVector *&current_sel);
 		void AdvancePointers();
 		void AdvancePointers(const SelectionVector &sel, idx_t sel_count);
@@ -190,6 +197,10 @@ public:
 	bool has_null;
 	//! Bitmask for getting relevant bits from the hashes to determine the position
 	uint64_t bitmask;
+	//! Whether the HT is larger than the cache, in which case probes prefetch the entries and rows they access
+	bool prefetch = false;
+	//! Bloom filter that the hashes are inserted into during Finalize (if any), used for join filter pushdown
+	optional_ptr<HashBloomFilter> bloom_filter;
 
 	struct {
 		mutex mj_lock;
@@ -213,9 +224,8 @@ private:
 	                                                  const SelectionVector *&current_sel);
 	void Hash(DataChunk &keys, const SelectionVector &sel, idx_t count, Vector &hashes);
 
-	//! Apply a bitmask to the hashes
-	void ApplyBitmask(Vector &hashes, idx_t count);
-	void ApplyBitmask(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers);
+	//! Look up the heads of the row chains for the given hashes, or NULL if there are none
+	void GetRowPointers(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers);
 
 private:
 	//! Insert the given set of locations into the HT with the given set of hashes
@@ -232,6 +242,8 @@ private:
 	unique_ptr<TupleDataCollection> data_collection;
 	//! The hash map of the HT, created after finalization
 	AllocatedData hash_map;
+	//! The entries of the hash map
+	ht_entry_t *entries = nullptr;
 	//! Whether or not NULL values are considered equal in each of the comparisons
 	vector<bool> null_values_are_equal;
 
@@ -308,7 +320,7 @@ public:
 	}
 	//! Size of the pointer table (in bytes)
 	static idx_t PointerTableSize(idx_t count) {
-		return PointerTableCapacity(count) * sizeof(data_ptr_t);
+		return PointerTableCapacity(count) * sizeof(ht_entry_t);
 	}
 
 	//! Get total size of HT if all partitions would be built
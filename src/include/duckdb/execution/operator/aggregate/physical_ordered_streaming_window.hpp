@@ -0,0 +1,63 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/aggregate/physical_ordered_streaming_window.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/planner/expression/bound_window_expression.hpp"
+
+namespace duckdb {
+
+//! PhysicalOrderedStreamingWindow evaluates window functions over input that is already sorted by the partition and
+//! order keys. Instead of materializing the input, it detects the partition and peer boundaries as the rows stream by
+//! and only holds on to the rows that LAG/LEAD and bounded ROWS frames can still reach.
+class PhysicalOrderedStreamingWindow : public PhysicalOperator {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::ORDERED_STREAMING_WINDOW;
+	//! The maximum number of rows a function can look back or ahead
+	static constexpr const idx_t MAXIMUM_OFFSET = 4096;
+
+	//! Whether the window function can be evaluated over sorted input
+	static bool IsStreamingFunction(ClientContext &context, BoundWindowExpression &wexpr);
+	//! Whether the output order of "plan" sorts by the partitions and orders of "wexpr"
+	static bool IsOrderedBy(PhysicalOperator &plan, const BoundWindowExpression &wexpr);
+
+public:
+	PhysicalOrderedStreamingWindow(vector<LogicalType> types, vector<unique_ptr<Expression>> select_list,
+	                               idx_t estimated_cardinality);
+
+	//! The projection list of the WINDOW statement
+	vector<unique_ptr<Expression>> select_list;
+	//! The window expression with the longest ORDER BY clause (it defines the boundaries)
+	idx_t order_idx;
+
+public:
+	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
+
+	OperatorResultType Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+	                           GlobalOperatorState &gstate, OperatorState &state) const override;
+	OperatorFinalizeResultType FinalExecute(ExecutionContext &context, DataChunk &chunk, GlobalOperatorState &gstate,
+	                                        OperatorState &state) const override;
+
+	bool RequiresFinalExecute() const override {
+		return true;
+	}
+
+	OrderPreservationType OperatorOrder() const override {
+		return OrderPreservationType::FIXED_ORDER;
+	}
+
+	vector<SortedColumn> GetOutputOrder() const override {
+		// the window functions are appended to the input columns
+		return children[0]->GetOutputOrder();
+	}
+
+	string ParamsToString() const override;
+};
+
+} // namespace duckdb
@@ -39,6 +39,11 @@ public:
 		return OrderPreservationType::FIXED_ORDER;
 	}
 
+	vector<SortedColumn> GetOutputOrder() const override {
+		// the window functions are appended to the input columns
+		return children[0]->GetOutputOrder();
+	}
+
 	string ParamsToString() const override;
 };
 
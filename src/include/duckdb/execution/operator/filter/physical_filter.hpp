@@ -35,6 +35,10 @@ public:
 
 	string ParamsToString() const override;
 
+	vector<SortedColumn> GetOutputOrder() const override {
+		return children[0]->GetOutputOrder();
+	}
+
 protected:
 	OperatorResultType ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
 	                                   GlobalOperatorState &gstate, OperatorState &state) const override;
@@ -17,21 +17,31 @@ namespace duckdb {
 
 class HashJoinOperatorState;
 class HashJoinGlobalSinkState;
+class PerfectHashJoinState;
 class PhysicalHashJoin;
 
 struct PerfectHashJoinStats {
-	Value build_min;
-	Value build_max;
-	Value probe_min;
-	Value probe_max;
+	//! The min/max of the build and probe keys of every join condition
+	vector<Value> build_min;
+	vector<Value> build_max;
+	vector<Value> probe_min;
+	vector<Value> probe_max;
 	bool is_build_small = false;
 	bool is_build_dense = false;
 	bool is_probe_in_domain = false;
+	//! The range (max - min) of the build side of every join key
+	vector<idx_t> key_ranges;
+	//! The number of slots of the perfect hash table minus one, i.e., the product of the key ranges (plus one) minus one
 	idx_t build_range = 0;
 	idx_t estimated_cardinality = 0;
 };
 
-//! PhysicalHashJoin represents a hash loop join between two tables
+//! PerfectHashJoinExecutor executes an inner equi-join on integral keys by indexing dense arrays with the keys.
+/*!
+    Composite keys are packed into a single index using the min/max statistics of every key. If every key occurs at
+    most once in the build side, the build columns are stored at the index of their key. Otherwise, the build tuples are
+    stored sorted by their key, and a prefix sum of the key counts points to the tuples of every key.
+*/
 class PerfectHashJoinExecutor {
 	using PerfectHashTable = vector<Vector>;
 
@@ -44,21 +54,28 @@ public:
 	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context);
 	OperatorResultType ProbePerfectHashTable(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
 	                                         OperatorState &state);
-	bool BuildPerfectHashTable(LogicalType &type);
+	bool BuildPerfectHashTable();
+
+	//! Build ranges up to this size are always allowed
+	static constexpr const idx_t MAX_DENSE_BUILD_SIZE = 1000000;
+	//! Build ranges up to this size are allowed if the build side fills enough of the range
+	static constexpr const idx_t MAX_BUILD_SIZE = 8388608;
+	//! The minimum fraction (1 / MAX_BUILD_SPARSITY) of the range that a large build side must fill
+	static constexpr const idx_t MAX_BUILD_SPARSITY = 4;
 
 private:
-	void FillSelectionVectorSwitchProbe(Vector &source, SelectionVector &build_sel_vec, SelectionVector &probe_sel_vec,
-	                                    idx_t count, idx_t &probe_sel_count);
+	//! Computes the index of the keys of the rows in "sel" into the perfect hash table in "indices". Rows for which
+	//! any of the keys is NULL or outside the range of the build side are removed from "sel".
+	void ComputeKeyIndices(vector<Vector> &keys, idx_t count, SelectionVector &sel, idx_t &sel_count,
+	                       idx_t indices[]);
 	template <typename T>
-	void TemplatedFillSelectionVectorProbe(Vector &source, SelectionVector &build_sel_vec,
-	                                       SelectionVector &probe_sel_vec, idx_t count, idx_t &prob_sel_count);
+	void TemplatedComputeKeyIndices(Vector &source, idx_t count, idx_t key_idx, idx_t multiplier, SelectionVector &sel,
+	                                idx_t &sel_count, idx_t indices[]);
 
-	bool FillSelectionVectorSwitchBuild(Vector &source, SelectionVector &sel_vec, SelectionVector &seq_sel_vec,
-	                                    idx_t count);
-	template <typename T>
-	bool TemplatedFillSelectionVectorBuild(Vector &source, SelectionVector &sel_vec, SelectionVector &seq_sel_vec,
-	                                       idx_t count);
-	bool FullScanHashTable(LogicalType &key_type);
+	bool FullScanHashTable();
+
+	OperatorResultType ProbeUnique(DataChunk &input, DataChunk &result, PerfectHashJoinState &state);
+	OperatorResultType ProbeDuplicates(DataChunk &input, DataChunk &result, PerfectHashJoinState &state);
 
 private:
 	const PhysicalHashJoin &join;
@@ -67,8 +84,14 @@ private:
 	PerfectHashTable perfect_hash_table;
 	//! Build and probe statistics
 	PerfectHashJoinStats perfect_join_statistics;
-	//! Stores the occurences of each value in the build side
+	//! The multiplier of every key when packing them into an index
+	vector<idx_t> key_multipliers;
+	//! Whether any key occurs more than once in the build side
+	bool has_duplicates = false;
+	//! Stores the occurences of each value in the build side (if there are no duplicates)
 	unsafe_unique_array<bool> bitmap_build_idx;
+	//! Stores the offset of the tuples of each value in the build side (if there are duplicates)
+	unsafe_unique_array<uint32_t> key_offsets;
 	//! Stores the number of unique keys in the build side
 	idx_t unique_keys = 0;
 };
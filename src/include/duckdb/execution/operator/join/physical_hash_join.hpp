@@ -16,6 +16,15 @@
 #include "duckdb/planner/operator/logical_join.hpp"
 
 namespace duckdb {
+struct DynamicFilterData;
+
+//! A filter on a join key that is computed from the build side and pushed into a table scan on the probe side
+struct JoinFilterPushdownColumn {
+	//! The index of the join condition the filter is computed on
+	idx_t condition_idx;
+	//! The filter data, shared with the DynamicFilter in the table scan
+	shared_ptr<DynamicFilterData> filter_data;
+};
 
 //! PhysicalHashJoin represents a hash loop join between two tables
 class PhysicalHashJoin : public PhysicalComparisonJoin {
@@ -51,6 +60,8 @@ public:
 	vector<LogicalType> delim_types;
 	//! Used in perfect hash join
 	PerfectHashJoinStats perfect_join_statistics;
+	//! Filters on the join keys that are pushed into table scans on the probe side
+	vector<JoinFilterPushdownColumn> filter_pushdown;
 
 public:
 	string ParamsToString() const override;
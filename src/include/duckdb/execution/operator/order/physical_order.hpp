@@ -75,6 +75,7 @@ public:
 
 public:
 	string ParamsToString() const override;
+	vector<SortedColumn> GetOutputOrder() const override;
 
 	//! Schedules tasks to merge the data during the Finalize phase
 	static void ScheduleMergeTasks(Pipeline &pipeline, Event &event, OrderGlobalSinkState &state);
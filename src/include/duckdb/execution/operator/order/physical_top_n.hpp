@@ -12,12 +12,16 @@
 #include "duckdb/planner/bound_query_node.hpp"
 
 namespace duckdb {
+struct DynamicFilterData;
 
 //! Represents a physical ordering of the data. Note that this will not change
 //! the data but only add a selection vector.
 class PhysicalTopN : public PhysicalOperator {
 public:
 	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::TOP_N;
+	//! Top-N's over a table scan that return at most this many rows are late materialized: only the order columns
+	//! and the row ids go through the heap, the other columns are fetched for the surviving rows afterwards
+	static constexpr const idx_t LATE_MATERIALIZATION_MAX_ROWS = 1024;
 
 public:
 	PhysicalTopN(vector<LogicalType> types, vector<BoundOrderByNode> orders, idx_t limit, idx_t offset,
@@ -26,6 +30,9 @@ public:
 	vector<BoundOrderByNode> orders;
 	idx_t limit;
 	idx_t offset;
+	//! The dynamic filter on the first order column that is pushed into the table scan (if any), it is tightened
+	//! whenever the boundary of the heap moves
+	shared_ptr<DynamicFilterData> dynamic_filter;
 
 public:
 	// Source interface
@@ -55,6 +62,7 @@ public:
 	}
 
 	string ParamsToString() const override;
+	vector<SortedColumn> GetOutputOrder() const override;
 };
 
 } // namespace duckdb
@@ -33,6 +33,7 @@ public:
 	}
 
 	string ParamsToString() const override;
+	vector<SortedColumn> GetOutputOrder() const override;
 
 	static unique_ptr<PhysicalOperator>
 	CreateJoinProjection(vector<LogicalType> proj_types, const vector<LogicalType> &lhs_types,
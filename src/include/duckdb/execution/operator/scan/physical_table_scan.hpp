@@ -48,6 +48,7 @@ public:
 public:
 	string GetName() const override;
 	string ParamsToString() const override;
+	vector<SortedColumn> GetOutputOrder() const override;
 
 	bool Equals(const PhysicalOperator &other) const override;
 
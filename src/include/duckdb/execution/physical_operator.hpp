@@ -18,6 +18,7 @@
 #include "duckdb/common/optional_idx.hpp"
 #include "duckdb/execution/physical_operator_states.hpp"
 #include "duckdb/common/enums/order_preservation_type.hpp"
+#include "duckdb/common/enums/order_type.hpp"
 
 namespace duckdb {
 class Event;
@@ -27,6 +28,17 @@ class Pipeline;
 class PipelineBuildState;
 class MetaPipeline;
 
+//! A column of the output of an operator that the rows are sorted on
+struct SortedColumn {
+	SortedColumn(idx_t column_index, OrderType type, OrderByNullType null_order)
+	    : column_index(column_index), type(type), null_order(null_order) {
+	}
+
+	idx_t column_index;
+	OrderType type;
+	OrderByNullType null_order;
+};
+
 //! PhysicalOperator is the base class of the physical operators present in the
 //! execution plan
 class PhysicalOperator {
@@ -99,6 +111,12 @@ public:
 		return OrderPreservationType::INSERTION_ORDER;
 	}
 
+	//! The columns that the output of the operator is known to be sorted on, from the most significant one onwards.
+	//! The order only holds if it is preserved, i.e., if PhysicalPlanGenerator::PreserveInsertionOrder holds.
+	virtual vector<SortedColumn> GetOutputOrder() const {
+		return vector<SortedColumn>();
+	}
+
 public:
 	// Source interface
 	virtual unique_ptr<LocalSourceState> GetLocalSourceState(ExecutionContext &context,
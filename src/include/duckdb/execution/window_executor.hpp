@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/execution/window_segment_tree.hpp"
 #include "duckdb/planner/expression/bound_window_expression.hpp"
@@ -80,14 +82,17 @@ struct WindowInputColumn {
 		}
 	}
 
-	void Append(DataChunk &input_chunk) {
+	//! Evaluates the expression on "input_chunk" and copies the result to position "input_idx".
+	//! Chunks can be copied from several threads at once, each using its own "input" evaluator.
+	void Copy(WindowInputExpression &input, DataChunk &input_chunk, const idx_t input_idx) {
 		if (input_expr.expr) {
 			const auto source_count = input_chunk.size();
-			D_ASSERT(count + source_count <= capacity);
-			if (!input_expr.scalar || !count) {
-				input_expr.Execute(input_chunk);
-				auto &source = input_expr.chunk.data[0];
-				VectorOperations::Copy(source, *target, source_count, 0, count);
+			D_ASSERT(input_idx + source_count <= capacity);
+			if (!input_expr.scalar || !input_idx) {
+				input.Execute(input_chunk);
+				auto &source = input.chunk.data[0];
+				lock_guard<mutex> target_guard(lock);
+				VectorOperations::Copy(source, *target, source_count, 0, input_idx);
 			}
 			count += source_count;
 		}
@@ -111,8 +116,10 @@ struct WindowInputColumn {
 
 private:
 	unique_ptr<Vector> target;
-	idx_t count;
+	atomic<idx_t> count;
 	idx_t capacity;
+	//! Serialises writes into the target (validity entries and string heaps are shared)
+	mutex lock;
 };
 
 //	Column indexes of the bounds chunk
@@ -136,6 +143,31 @@ public:
 	}
 };
 
+//! Per-thread state for sinking partition data into an executor
+class WindowExecutorSinkState {
+public:
+	WindowExecutorSinkState(BoundWindowExpression &wexpr, ClientContext &context, const WindowInputColumn &range_p);
+	virtual ~WindowExecutorSinkState() {
+	}
+
+	template <class TARGET>
+	TARGET &Cast() {
+		DynamicCastCheck<TARGET>(this);
+		return reinterpret_cast<TARGET &>(*this);
+	}
+	template <class TARGET>
+	const TARGET &Cast() const {
+		DynamicCastCheck<TARGET>(this);
+		return reinterpret_cast<const TARGET &>(*this);
+	}
+
+	//! Evaluates the arguments of the window function
+	ExpressionExecutor payload_executor;
+	DataChunk payload_chunk;
+	//! Evaluates the RANGE expression
+	WindowInputExpression range;
+};
+
 class WindowExecutor {
 public:
 	WindowExecutor(BoundWindowExpression &wexpr, ClientContext &context, const idx_t payload_count,
@@ -143,8 +175,14 @@ public:
 	virtual ~WindowExecutor() {
 	}
 
-	virtual void Sink(DataChunk &input_chunk, const idx_t input_idx, const idx_t total_count) {
-		range.Append(input_chunk);
+	//! Whether chunks of the partition can be sunk out of order from several threads
+	virtual bool SupportsParallelSink() const {
+		return true;
+	}
+	virtual unique_ptr<WindowExecutorSinkState> GetSinkState() const;
+	virtual void Sink(WindowExecutorSinkState &sstate, DataChunk &input_chunk, const idx_t input_idx,
+	                  const idx_t total_count) {
+		range.Copy(sstate.range, input_chunk, input_idx);
 	}
 
 	virtual void Finalize() {
@@ -164,8 +202,8 @@ protected:
 
 	// Expression collections
 	DataChunk payload_collection;
-	ExpressionExecutor payload_executor;
-	DataChunk payload_chunk;
+	//! Serialises writes into the shared collections
+	mutex lock;
 
 	// evaluate RANGE expressions, if needed
 	WindowInputColumn range;
@@ -178,12 +216,16 @@ public:
 	bool IsConstantAggregate();
 	bool IsCustomAggregate();
 	bool IsDistinctAggregate();
+	bool IsIncrementalAggregate();
 
 	WindowAggregateExecutor(BoundWindowExpression &wexpr, ClientContext &context, const idx_t payload_count,
 	                        const ValidityMask &partition_mask, const ValidityMask &order_mask,
 	                        WindowAggregationMode mode);
 
-	void Sink(DataChunk &input_chunk, const idx_t input_idx, const idx_t total_count) override;
+	bool SupportsParallelSink() const override;
+	unique_ptr<WindowExecutorSinkState> GetSinkState() const override;
+	void Sink(WindowExecutorSinkState &sstate, DataChunk &input_chunk, const idx_t input_idx,
+	          const idx_t total_count) override;
 	void Finalize() override;
 
 	unique_ptr<WindowExecutorState> GetExecutorState() const override;
@@ -191,9 +233,6 @@ public:
 	const WindowAggregationMode mode;
 
 protected:
-	ExpressionExecutor filter_executor;
-	SelectionVector filter_sel;
-
 	// aggregate computation algorithm
 	unique_ptr<WindowAggregator> aggregator;
 
@@ -258,7 +297,8 @@ public:
 	WindowValueExecutor(BoundWindowExpression &wexpr, ClientContext &context, const idx_t payload_count,
 	                    const ValidityMask &partition_mask, const ValidityMask &order_mask);
 
-	void Sink(DataChunk &input_chunk, const idx_t input_idx, const idx_t total_count) override;
+	void Sink(WindowExecutorSinkState &sstate, DataChunk &input_chunk, const idx_t input_idx,
+	          const idx_t total_count) override;
 	unique_ptr<WindowExecutorState> GetExecutorState() const override;
 
 protected:
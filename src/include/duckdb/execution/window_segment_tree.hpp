@@ -54,7 +54,11 @@ public:
 	}
 
 	//	Build
-	virtual void Sink(DataChunk &payload_chunk, SelectionVector *filter_sel, idx_t filtered);
+	//! Whether chunks can be sunk out of order from several threads
+	virtual bool SupportsParallelSink() const {
+		return true;
+	}
+	virtual void Sink(DataChunk &payload_chunk, const idx_t input_idx, SelectionVector *filter_sel, idx_t filtered);
 	virtual void Finalize(const FrameStats &stats);
 
 	//	Probe
@@ -78,7 +82,8 @@ protected:
 	//! The filtered rows in inputs.
 	vector<validity_t> filter_bits;
 	ValidityMask filter_mask;
-	idx_t filter_pos;
+	//! Serialises writes into the inputs
+	mutex lock;
 	//! The state used by the aggregator to build.
 	unique_ptr<WindowAggregatorState> gstate;
 
@@ -106,7 +111,10 @@ public:
 	~WindowConstantAggregator() override {
 	}
 
-	void Sink(DataChunk &payload_chunk, SelectionVector *filter_sel, idx_t filtered) override;
+	bool SupportsParallelSink() const override {
+		return false;
+	}
+	void Sink(DataChunk &payload_chunk, const idx_t input_idx, SelectionVector *filter_sel, idx_t filtered) override;
 	void Finalize(const FrameStats &stats) override;
 
 	unique_ptr<WindowAggregatorState> GetLocalState() const override;
@@ -152,6 +160,23 @@ public:
 	unique_ptr<WindowAggregatorState> gstate;
 };
 
+//! Slides a single aggregate state along the partition: the rows that enter the frame are added to the state, and the
+//! rows that leave it are removed with the remove function of the aggregate. This only requires O(1) work per row for
+//! narrow frames that move forward, e.g., ROWS BETWEEN 100 PRECEDING AND CURRENT ROW
+class WindowIncrementalAggregator : public WindowAggregator {
+public:
+	WindowIncrementalAggregator(AggregateObject aggr, const LogicalType &result_type_p,
+	                            const WindowExcludeMode exclude_mode_p, idx_t partition_count);
+	~WindowIncrementalAggregator() override;
+
+	unique_ptr<WindowAggregatorState> GetLocalState() const override;
+	void Evaluate(WindowAggregatorState &lstate, const DataChunk &bounds, Vector &result, idx_t count,
+	              idx_t row_idx) const override;
+
+	//! The maximum frame size for which the frame is slid, wider frames use the segment tree
+	static constexpr idx_t MAXIMUM_FRAME_SIZE = 4096;
+};
+
 class WindowSegmentTree : public WindowAggregator {
 
 public:
@@ -198,7 +223,10 @@ public:
 	~WindowDistinctAggregator() override;
 
 	//	Build
-	void Sink(DataChunk &args_chunk, SelectionVector *filter_sel, idx_t filtered) override;
+	bool SupportsParallelSink() const override {
+		return false;
+	}
+	void Sink(DataChunk &args_chunk, const idx_t input_idx, SelectionVector *filter_sel, idx_t filtered) override;
 	void Finalize(const FrameStats &stats) override;
 
 	//	Evaluate
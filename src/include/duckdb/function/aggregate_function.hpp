@@ -66,6 +66,10 @@ typedef void (*aggregate_destructor_t)(Vector &state, AggregateInputData &aggr_i
 typedef void (*aggregate_simple_update_t)(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count,
                                           data_ptr_t state, idx_t count);
 
+//! The type used for removing values from a simple (non-grouped) aggregate state, the inverse of simple update
+typedef void (*aggregate_remove_t)(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count,
+                                   data_ptr_t state, idx_t count);
+
 //! The type used for computing complex/custom windowed aggregate functions (optional)
 typedef void (*aggregate_window_t)(AggregateInputData &aggr_input_data, const WindowPartitionInput &partition,
                                    const_data_ptr_t g_state, data_ptr_t l_state, const SubFrames &subframes,
@@ -149,6 +153,8 @@ public:
 	aggregate_window_t window;
 	//! The windowed aggregate custom initialization function (may be null)
 	aggregate_wininit_t window_init = nullptr;
+	//! The function to remove values from a state (may be null), used to slide window frames incrementally
+	aggregate_remove_t remove = nullptr;
 
 	//! The bind function (may be null)
 	bind_aggregate_function_t bind;
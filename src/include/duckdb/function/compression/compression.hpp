@@ -33,6 +33,11 @@ struct BitpackingFun {
 	static bool TypeIsSupported(PhysicalType type);
 };
 
+struct PForDeltaFun {
+	static CompressionFunction GetFunction(PhysicalType type);
+	static bool TypeIsSupported(PhysicalType type);
+};
+
 struct DictionaryCompressionFun {
 	static CompressionFunction GetFunction(PhysicalType type);
 	static bool TypeIsSupported(PhysicalType type);
@@ -63,4 +68,9 @@ struct FSSTFun {
 	static bool TypeIsSupported(PhysicalType type);
 };
 
+struct ZSTDFun {
+	static CompressionFunction GetFunction(PhysicalType type);
+	static bool TypeIsSupported(PhysicalType type);
+};
+
 } // namespace duckdb
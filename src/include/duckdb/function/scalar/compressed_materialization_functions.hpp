@@ -21,27 +21,47 @@ struct CompressedMaterializationFunctions {
 
 	static unique_ptr<FunctionData> Bind(ClientContext &context, ScalarFunction &bound_function,
 	                                     vector<unique_ptr<Expression>> &arguments);
+	//! Whether the function is one of the (de)compress functions, which preserve the order of their first argument
+	static bool PreservesOrder(const ScalarFunction &function);
 };
 
 //! Needed for (de)serialization without binding
 enum class CompressedMaterializationDirection : uint8_t { INVALID = 0, COMPRESS = 1, DECOMPRESS = 2 };
 
 struct CMIntegralCompressFun {
+	static string GetFunctionName(const LogicalType &result_type);
 	static ScalarFunction GetFunction(const LogicalType &input_type, const LogicalType &result_type);
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
 struct CMIntegralDecompressFun {
+	static string GetFunctionName(const LogicalType &result_type);
+	static ScalarFunction GetFunction(const LogicalType &input_type, const LogicalType &result_type);
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
+//! Packs multiple narrow integral keys into a single unsigned integer, arguments are (key, min, shift) triples
+struct CMIntegralPackFun {
+	//! The types we pack integral keys into
+	static const vector<LogicalType> PackedTypes();
+	static ScalarFunction GetFunction(const vector<LogicalType> &input_types, const LogicalType &result_type);
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
+//! Extracts a single key from a packed integer, arguments are (packed, shift, width, min)
+struct CMIntegralUnpackFun {
 	static ScalarFunction GetFunction(const LogicalType &input_type, const LogicalType &result_type);
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
 struct CMStringCompressFun {
+	static string GetFunctionName(const LogicalType &result_type);
 	static ScalarFunction GetFunction(const LogicalType &result_type);
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
 struct CMStringDecompressFun {
+	static string GetFunctionName();
 	static ScalarFunction GetFunction(const LogicalType &input_type);
 	static void RegisterFunction(BuiltinFunctions &set);
 };
@@ -41,6 +41,10 @@ struct PragmaDatabaseSize {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+struct PragmaWALCommitStats {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 struct DuckDBSchemasFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
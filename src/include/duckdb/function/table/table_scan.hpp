@@ -42,6 +42,8 @@ struct TableScanFunction {
 	static void RegisterFunction(BuiltinFunctions &set);
 	static TableFunction GetFunction();
 	static TableFunction GetIndexScanFunction();
+	//! A table in-out function that fetches the rows of the table for a column of row ids (late materialization)
+	static TableFunction GetFetchFunction();
 };
 
 } // namespace duckdb
@@ -294,6 +294,18 @@ public:
 	//! Whether or not the table function can immediately prune out filter columns that are unused in the remainder of
 	//! the query plan, e.g., "SELECT i FROM tbl WHERE j = 42;" - j does not need to leave the table function at all
 	bool filter_prune;
+	//! Whether or not the table function supports dynamic filters, i.e., table filters that are only computed during
+	//! execution (e.g. from the build side of a hash join). These are added to the table filters in the physical plan.
+	bool dynamic_filter_pushdown;
+	//! Whether or not the table function supports IN filters (i.e., "x IN (C1, C2, ...)" table filters). If not
+	//! supported, IN lists that cannot be rewritten into a range filter are evaluated after the scan.
+	bool in_filter_pushdown;
+	//! Whether or not the table function supports late materialization, i.e., the remaining columns of the rows that
+	//! survive a Top-N can be fetched by row id afterwards (see TableScanFunction::GetFetchFunction)
+	bool late_materialization;
+	//! Whether or not the table function emits the rows in the order of their row ids (if insertion order is
+	//! preserved), which allows sorts on the row id to be skipped
+	bool row_id_order;
 	//! Additional function info, passed to the bind
 	shared_ptr<TableFunctionInfo> function_info;
 
@@ -62,6 +62,16 @@ struct AllowPersistentSecrets {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct BackgroundCheckpointSetting {
+	static constexpr const char *Name = "background_checkpoint";
+	static constexpr const char *Description =
+	    "Whether automatic checkpoints are performed by a background thread instead of by the committing transaction";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct CheckpointThresholdSetting {
 	static constexpr const char *Name = "checkpoint_threshold";
 	static constexpr const char *Description =
@@ -72,6 +82,17 @@ struct CheckpointThresholdSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct CommitDelaySetting {
+	static constexpr const char *Name = "commit_delay";
+	static constexpr const char *Description =
+	    "The time (in microseconds) a commit waits for concurrent commits before syncing the WAL, so that they can share "
+	    "a single sync";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct DebugCheckpointAbort {
 	static constexpr const char *Name = "debug_checkpoint_abort";
 	static constexpr const char *Description =
@@ -663,6 +684,16 @@ struct TempDirectorySetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct TempFileCompressionSetting {
+	static constexpr const char *Name = "temp_file_compression";
+	static constexpr const char *Description =
+	    "Compress the buffers that are written to the temp directory (using ZSTD, if it pays off for the buffer)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ThreadsSetting {
 	static constexpr const char *Name = "threads";
 	static constexpr const char *Description = "The number of total threads used by the system.";
@@ -85,6 +85,9 @@ private:
 	void CompressDistinct(unique_ptr<LogicalOperator> &op);
 	void CompressOrder(unique_ptr<LogicalOperator> &op);
 
+	//! Pack narrow integral groups of an aggregate into a single key, returns the (possibly moved) aggregate
+	unique_ptr<LogicalOperator> &PackAggregateGroups(unique_ptr<LogicalOperator> &op);
+
 	//! Update statistics after compressing
 	void UpdateAggregateStats(unique_ptr<LogicalOperator> &op);
 	void UpdateOrderStats(unique_ptr<LogicalOperator> &op);
@@ -0,0 +1,68 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/parallel/task_executor.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/execution/task_error_manager.hpp"
+#include "duckdb/parallel/task.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+
+#include <condition_variable>
+
+namespace duckdb {
+
+//! The TaskExecutor schedules a set of tasks on the task scheduler and lets the calling thread work on them until all
+//! of them are finished. Errors thrown by the tasks are collected and re-thrown by the calling thread.
+class TaskExecutor {
+public:
+	explicit TaskExecutor(TaskScheduler &scheduler);
+	~TaskExecutor();
+
+public:
+	void PushError(ErrorData error);
+	bool HasError();
+	void ThrowError();
+
+	void ScheduleTask(unique_ptr<Task> task);
+	void FinishTask();
+	//! Fetches a task that has not been picked up by any thread yet
+	bool GetTask(shared_ptr<Task> &task);
+	//! Works on the tasks until all of them are finished - throws if any of them failed
+	void WorkOnTasks();
+	//! Fails any task that has not started yet and waits for the running tasks to finish (without throwing)
+	void CancelTasks();
+
+private:
+	//! Executes the tasks that have not been picked up yet and waits for the tasks that are running on other threads
+	void WaitForTasks();
+
+private:
+	TaskScheduler &scheduler;
+	TaskErrorManager error_manager;
+	unique_ptr<ProducerToken> token;
+	mutex tasks_lock;
+	std::condition_variable tasks_finished;
+	idx_t completed_tasks;
+	idx_t total_tasks;
+};
+
+//! A task that is executed by a TaskExecutor
+class BaseExecutorTask : public Task {
+public:
+	explicit BaseExecutorTask(TaskExecutor &executor);
+
+	virtual void ExecuteTask() = 0;
+	TaskExecutionResult Execute(TaskExecutionMode mode) override;
+
+protected:
+	TaskExecutor &executor;
+};
+
+} // namespace duckdb
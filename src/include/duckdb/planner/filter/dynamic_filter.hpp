@@ -0,0 +1,114 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/dynamic_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+
+namespace duckdb {
+class Vector;
+
+//! A blocked bloom filter over hashes computed by VectorOperations::Hash
+//! Every hash sets (and probes) four bits within a single 64-bit block, so a probe costs one random memory access
+class HashBloomFilter {
+public:
+	explicit HashBloomFilter(idx_t expected_count);
+
+	//! Insert a set of hashes into the bloom filter - can be called concurrently from multiple threads
+	void Insert(const hash_t *hashes, idx_t count);
+	//! Probe the hashes of the rows in "sel", "sel" is updated to contain only the rows that might match
+	idx_t Probe(const hash_t *hashes, SelectionVector &sel, idx_t count) const;
+
+	idx_t SizeInBytes() const {
+		return (block_mask + 1) * sizeof(uint64_t);
+	}
+
+	//! The maximum amount of memory a bloom filter may use
+	static constexpr const idx_t MAXIMUM_SIZE = 64ULL * 1024ULL * 1024ULL;
+	//! The amount of bits we reserve per inserted hash
+	static constexpr const idx_t BITS_PER_HASH = 16;
+
+private:
+	static inline uint64_t GetBlockMask(hash_t hash) {
+		return (1ULL << (hash & 63)) | (1ULL << ((hash >> 6) & 63)) | (1ULL << ((hash >> 12) & 63)) |
+		       (1ULL << ((hash >> 18) & 63));
+	}
+	inline idx_t GetBlockIndex(hash_t hash) const {
+		return (hash >> 32) & block_mask;
+	}
+
+private:
+	unsafe_unique_array<uint64_t> blocks;
+	idx_t block_mask;
+};
+
+//! The shared state of a DynamicFilter, filled in during execution (e.g. by the build side of a hash join)
+//! The filter can be replaced while it is being used (e.g. by a Top-N that tightens its boundary), so readers of
+//! "filter" must hold "lock"
+struct DynamicFilterData {
+public:
+	explicit DynamicFilterData(LogicalType key_type);
+
+	//! The type of the key the filter was computed on
+	const LogicalType key_type;
+	//! Protects "filter" against concurrent updates
+	mutex lock;
+	//! Whether or not the filter has been computed yet - before that, the filter lets everything pass
+	atomic<bool> initialized;
+	//! The (optional) filter on the min/max of the keys
+	unique_ptr<TableFilter> filter;
+	//! The (optional) bloom filter on the hashes of the keys
+	unique_ptr<HashBloomFilter> bloom_filter;
+
+	//! Statistics used to disable the bloom filter if it turns out to not be selective
+	atomic<idx_t> bloom_probe_count;
+	atomic<idx_t> bloom_pass_count;
+	atomic<bool> bloom_enabled;
+
+public:
+	//! Set the filter - must be called (at most) once after every Reset
+	void Initialize(unique_ptr<TableFilter> filter, unique_ptr<HashBloomFilter> bloom_filter);
+	//! Replace the filter - can be called any number of times while the filter is being used
+	void Update(unique_ptr<TableFilter> filter);
+	//! Clears the filter so it can be computed again (e.g. when re-executing a prepared statement)
+	void Reset();
+
+	//! Whether or not the bloom filter can be probed with values of the given type
+	bool CanProbeBloomFilter(const LogicalType &type) const;
+	//! Probe the bloom filter with the rows of "vector" in "sel" - returns the new count
+	idx_t ProbeBloomFilter(Vector &vector, SelectionVector &sel, idx_t approved_tuple_count);
+
+	//! The minimum amount of probed rows before deciding whether or not the bloom filter is selective
+	static constexpr const idx_t BLOOM_MINIMUM_PROBE_COUNT = 100000;
+	//! If more than this fraction of the probed rows pass the bloom filter, it is disabled
+	static constexpr const double BLOOM_MAXIMUM_PASS_RATIO = 0.9;
+};
+
+//! A table filter that is computed during query execution, e.g., the min/max and bloom filter of a hash join build
+class DynamicFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::DYNAMIC_FILTER;
+
+public:
+	explicit DynamicFilter(shared_ptr<DynamicFilterData> filter_data);
+
+	//! The shared, dynamically computed filter data
+	shared_ptr<DynamicFilterData> filter_data;
+
+public:
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	void Serialize(Serializer &serializer) const override;
+};
+
+} // namespace duckdb
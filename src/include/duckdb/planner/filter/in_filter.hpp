@@ -0,0 +1,53 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/in_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/types/value.hpp"
+
+namespace duckdb {
+class SelectionVector;
+struct UnifiedVectorFormat;
+class InFilterLookup;
+
+//! A filter that checks whether or not the value of a column is part of a set of constants, e.g., x IN (1, 7, 42)
+class InFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::IN_FILTER;
+
+public:
+	explicit InFilter(vector<Value> values);
+	~InFilter() override;
+
+	//! The set of values - sorted, without duplicates and without NULL values
+	vector<Value> values;
+
+public:
+	//! Filters the rows of "vdata" in "sel" - "sel" is updated to contain only the rows with a value in the set
+	idx_t Select(UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t approved_tuple_count) const;
+	//! Whether or not an IN filter can be created on a column of the given type
+	static bool SupportsType(const LogicalType &type);
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+
+	//! Sets with at most this many values are probed with a binary search, larger sets use a hash set
+	static constexpr const idx_t SORTED_LOOKUP_THRESHOLD = 32;
+	//! The maximum amount of values that are displayed by ToString
+	static constexpr const idx_t MAXIMUM_DISPLAYED_VALUES = 8;
+
+private:
+	//! The typed lookup structure used to probe the set
+	unique_ptr<InFilterLookup> lookup;
+};
+
+} // namespace duckdb
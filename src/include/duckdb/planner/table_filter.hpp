@@ -22,7 +22,9 @@ enum class TableFilterType : uint8_t {
 	IS_NOT_NULL = 2,
 	CONJUNCTION_OR = 3,
 	CONJUNCTION_AND = 4,
-	STRUCT_EXTRACT = 5
+	STRUCT_EXTRACT = 5,
+	DYNAMIC_FILTER = 6, // filter computed during execution (e.g. from the build side of a hash join)
+	IN_FILTER = 7       // set membership (e.g. IN (C1, C2, C3))
 };
 
 //! TableFilter represents a filter pushed down into the table scan.
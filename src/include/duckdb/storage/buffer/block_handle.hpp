@@ -24,6 +24,18 @@ class DatabaseInstance;
 
 enum class BlockState : uint8_t { BLOCK_UNLOADED = 0, BLOCK_LOADED = 1 };
 
+//! The eviction queues of the buffer pool - blocks are evicted from the queues in this order
+enum class EvictionQueueType : uint8_t {
+	//! Blocks that have not been pinned again since they were loaded, e.g., blocks read by a one-off scan
+	PROBATIONARY = 0,
+	//! Blocks that have been pinned again after they were unpinned, while they were loaded
+	FREQUENT = 1
+};
+
+static constexpr const idx_t EVICTION_QUEUE_TYPE_COUNT = 2;
+//! Every eviction queue type is sharded into this many queues to reduce contention
+static constexpr const idx_t EVICTION_QUEUE_SHARD_COUNT = 8;
+
 struct BufferPoolReservation {
 	MemoryTag tag;
 	idx_t size {0};
@@ -124,6 +136,12 @@ private:
 	unique_ptr<FileBuffer> buffer;
 	//! Internal eviction sequence number
 	atomic<idx_t> eviction_seq_num;
+	//! The index of the eviction queue that holds the latest eviction node of this block
+	atomic<uint8_t> eviction_queue_idx;
+	//! The amount of times the block was pinned again after all its readers had unpinned it while it stayed loaded,
+	//! reset when the block is unloaded. Concurrent pins of the same block, e.g., of the segments that share a
+	//! partial block, do not count.
+	atomic<idx_t> resident_pins;
 	//! LRU timestamp (for age-based eviction)
 	atomic<int64_t> lru_timestamp_msec;
 	//! Whether or not the buffer can be destroyed (only used for temporary buffers)
@@ -79,24 +79,18 @@ protected:
 	template <typename FN>
 	void IterateUnloadableBlocks(FN fn);
 
-	//! Tries to dequeue an element from the eviction queue, but only after acquiring the purge queue lock.
-	bool TryDequeueWithLock(BufferEvictionNode &node);
-	//! Bulk purge dead nodes from the eviction queue. Then, enqueue those that are still alive.
-	void PurgeIteration(const idx_t purge_size);
-	//! Garbage collect dead nodes in the eviction queue.
+	//! Garbage collect dead nodes in the eviction queues.
 	void PurgeQueue();
 	//! Add a buffer handle to the eviction queue. Returns true, if the queue is
 	//! ready to be purged, and false otherwise.
 	bool AddToEvictionQueue(shared_ptr<BlockHandle> &handle);
+	//! Increment the dead node counter of the eviction queue that holds the latest node of the handle.
+	void IncrementDeadNodes(BlockHandle &handle);
 
-	//! Increment the dead node counter in the purge queue.
-	inline void IncrementDeadNodes() {
-		total_dead_nodes++;
-	}
-	//! Decrement the dead node counter in the purge queue.
-	inline void DecrementDeadNodes() {
-		total_dead_nodes--;
-	}
+	//! Returns the type of eviction queue a handle is added to when it is unpinned
+	static EvictionQueueType GetEvictionQueueType(const BlockHandle &handle);
+	//! Returns the index of the (sharded) eviction queue a handle is added to when it is unpinned
+	static idx_t GetEvictionQueueIndex(const BlockHandle &handle);
 
 protected:
 	//! The lock for changing the memory limit
@@ -107,35 +101,18 @@ protected:
 	atomic<idx_t> maximum_memory;
 	//! Record timestamps of buffer manager unpin() events. Usable by custom eviction policies.
 	bool track_eviction_timestamps;
-	//! Eviction queue
-	unique_ptr<EvictionQueue> queue;
+	//! Eviction queues, EVICTION_QUEUE_SHARD_COUNT shards per EvictionQueueType
+	vector<unique_ptr<EvictionQueue>> queues;
 	//! Memory manager for concurrently used temporary memory, e.g., for physical operators
 	unique_ptr<TemporaryMemoryManager> temporary_memory_manager;
 	//! Memory usage per tag
 	atomic<idx_t> memory_usage_per_tag[MEMORY_TAG_COUNT];
-
-	//! We trigger a purge of the eviction queue every INSERT_INTERVAL insertions
-	constexpr static idx_t INSERT_INTERVAL = 4096;
-	//! We multiply the base purge size by this value.
-	constexpr static idx_t PURGE_SIZE_MULTIPLIER = 2;
-	//! We multiply the purge size by this value to determine early-outs. This is the minimum queue size.
-	//! We never purge below this point.
-	constexpr static idx_t EARLY_OUT_MULTIPLIER = 4;
-	//! We multiply the approximate alive nodes by this value to test whether our total dead nodes
-	//! exceed their allowed ratio. Must be greater than 1.
-	constexpr static idx_t ALIVE_NODE_MULTIPLIER = 4;
-
-	//! Total number of insertions into the eviction queue. This guides the schedule for calling PurgeQueue.
-	atomic<idx_t> evict_queue_insertions;
-	//! Total dead nodes in the eviction queue. There are two scenarios in which a node dies: (1) we destroy its block
-	//! handle, or (2) we insert a newer version into the eviction queue.
-	atomic<idx_t> total_dead_nodes;
-	//! Locked, if a queue purge is currently active or we're trying to forcefully evict a node.
-	//! Only lets a single thread enter the purge phase.
-	mutex purge_lock;
-
-	//! A pre-allocated vector of eviction nodes. We reuse this to keep the allocation overhead of purges small.
-	vector<BufferEvictionNode> purge_nodes;
+	//! The amount of pins of blocks that were already loaded, per tag
+	atomic<idx_t> buffer_hits_per_tag[MEMORY_TAG_COUNT];
+	//! The amount of pins that had to load the block (from the database file or the temporary directory), per tag
+	atomic<idx_t> buffer_loads_per_tag[MEMORY_TAG_COUNT];
+	//! The amount of blocks that were evicted, per tag
+	atomic<idx_t> buffer_evictions_per_tag[MEMORY_TAG_COUNT];
 };
 
 } // namespace duckdb
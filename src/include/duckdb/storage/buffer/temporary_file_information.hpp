@@ -9,11 +9,18 @@ struct MemoryInformation {
 	MemoryTag tag;
 	idx_t size;
 	idx_t evicted_data;
+	idx_t buffer_hits;
+	idx_t buffer_loads;
+	idx_t buffer_evictions;
 };
 
 struct TemporaryFileInformation {
 	string path;
+	//! The size of the file on disk
 	idx_t size;
+	//! The size of the buffers stored in the file, before and after compression
+	idx_t uncompressed_size;
+	idx_t compressed_size;
 };
 
 } // namespace duckdb
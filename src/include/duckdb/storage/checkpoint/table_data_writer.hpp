@@ -13,6 +13,7 @@
 namespace duckdb {
 class DuckTableEntry;
 class TableStatistics;
+struct CollectionCheckpointState;
 
 //! The table data writer is responsible for writing the data of a table to
 //! storage.
@@ -28,6 +29,10 @@ public:
 
 public:
 	void WriteTableData(Serializer &metadata_serializer);
+	//! Schedules the tasks that write the row groups of the table to disk, without waiting for them to finish
+	unique_ptr<CollectionCheckpointState> ScheduleTableData();
+	//! Waits for the scheduled row groups to be written, and writes the table metadata
+	void WriteTableData(CollectionCheckpointState &checkpoint_state, Serializer &metadata_serializer);
 
 	CompressionType GetColumnCompressionType(idx_t i);
 
@@ -91,6 +91,7 @@ public:
 //! CheckpointWriter is responsible for checkpointing the database
 class SingleFileRowGroupWriter;
 class SingleFileTableDataWriter;
+struct TableDataCheckpoint;
 
 class SingleFileCheckpointWriter final : public CheckpointWriter {
 	friend class SingleFileRowGroupWriter;
@@ -98,6 +99,7 @@ class SingleFileCheckpointWriter final : public CheckpointWriter {
 
 public:
 	SingleFileCheckpointWriter(AttachedDatabase &db, BlockManager &block_manager, CheckpointType checkpoint_type);
+	~SingleFileCheckpointWriter() override;
 
 	//! Checkpoint the current state of the WAL and flush it to the main storage. This should be called BEFORE any
 	//! connection is available because right now the checkpointing cannot be done online. (TODO)
@@ -115,6 +117,12 @@ public:
 public:
 	void WriteTable(TableCatalogEntry &table, Serializer &serializer) override;
 
+private:
+	//! Obtains the checkpoint of the given table - starting it if its row groups are not being written yet
+	unique_ptr<TableDataCheckpoint> StartTableCheckpoint(TableCatalogEntry &table);
+	//! Starts writing the row groups of the tables that follow the current table, if they are not in use
+	void ScheduleTableCheckpoints();
+
 private:
 	//! The metadata writer is responsible for writing schema information
 	unique_ptr<MetadataWriter> metadata_writer;
@@ -125,6 +133,14 @@ private:
 	PartialBlockManager partial_block_manager;
 	//! Checkpoint type
 	CheckpointType checkpoint_type;
+	//! The tables of the checkpoint, in the order in which they are written
+	vector<reference<TableCatalogEntry>> tables;
+	//! The checkpoints of the tables whose row groups are being written to disk ahead of their metadata
+	vector<unique_ptr<TableDataCheckpoint>> table_checkpoints;
+	//! The index of the next table that is written
+	idx_t next_table_idx = 0;
+	//! The index of the next table whose row groups can be scheduled
+	idx_t next_scheduled_idx = 0;
 };
 
 } // namespace duckdb
@@ -44,6 +44,7 @@ class TableScanState;
 struct TableDeleteState;
 struct ConstraintState;
 struct TableUpdateState;
+struct CollectionCheckpointState;
 enum class VerifyExistenceType : uint8_t;
 
 //! DataTable represents a physical table on disk
@@ -187,8 +188,12 @@ public:
 	unique_ptr<StorageLockKey> GetSharedCheckpointLock();
 	//! Obtains a lock during a checkpoint operation that prevents other threads from reading this table
 	unique_ptr<StorageLockKey> GetCheckpointLock();
+	//! Tries to obtain the checkpoint lock without waiting - returns nullptr if the table is in use
+	unique_ptr<StorageLockKey> TryGetCheckpointLock();
+	//! Schedules the tasks that write the row groups of the table to the specified table data writer
+	unique_ptr<CollectionCheckpointState> ScheduleCheckpoint(TableDataWriter &writer);
 	//! Checkpoint the table to the specified table data writer
-	void Checkpoint(TableDataWriter &writer, Serializer &serializer);
+	void Checkpoint(TableDataWriter &writer, CollectionCheckpointState &checkpoint_state, Serializer &serializer);
 	void CommitDropTable();
 	void CommitDropColumn(idx_t index);
 
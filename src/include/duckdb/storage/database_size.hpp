@@ -22,6 +22,19 @@ struct DatabaseSize {
 	idx_t wal_size = 0;
 };
 
+struct WALCommitStatistics {
+	//! The number of commits that were made durable by a sync of the WAL
+	idx_t commits = 0;
+	//! The number of syncs of the WAL
+	idx_t syncs = 0;
+	//! The largest number of commits made durable by a single sync
+	idx_t max_batch_size = 0;
+	//! The total time spent syncing the WAL (in microseconds)
+	idx_t total_sync_time = 0;
+	//! The longest time a single sync of the WAL took (in microseconds)
+	idx_t max_sync_time = 0;
+};
+
 struct MetadataBlockInfo {
 	block_id_t block_id;
 	idx_t total_blocks;
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/table_io_manager.hpp"
@@ -31,8 +32,9 @@ public:
 	virtual ~StorageCommitState() {
 	}
 
-	// Make the commit persistent
-	virtual void FlushCommit() = 0;
+	// Write the commit to the WAL. Returns the sequence number of the commit in the WAL, which has to be passed to
+	// WriteAheadLog::SyncCommit to make the commit durable, or 0 if nothing was written.
+	virtual idx_t FlushCommit() = 0;
 };
 
 struct CheckpointOptions {
@@ -91,6 +93,18 @@ public:
 	virtual vector<MetadataBlockInfo> GetMetadataInfo() = 0;
 	virtual shared_ptr<TableIOManager> GetTableIOManager(BoundCreateTableInfo *info) = 0;
 
+	//! Starts tracking the progress of a checkpoint that writes "total_rows" rows
+	void StartCheckpointProgress(idx_t total_rows);
+	//! Registers that "count" rows have been written to disk by the running checkpoint
+	void AddCheckpointProgress(idx_t count);
+	//! Returns the progress of the running checkpoint as a percentage
+	double GetCheckpointProgress() const;
+
+	//! Registers a sync of the WAL that made "batch_size" commits durable and took "sync_time" microseconds
+	void AddWALSync(idx_t batch_size, idx_t sync_time);
+	//! Returns the group commit statistics of the WAL
+	WALCommitStatistics GetWALCommitStatistics();
+
 protected:
 	virtual void LoadDatabase() = 0;
 
@@ -106,6 +120,13 @@ protected:
 	//! When loading a database, we do not yet set the wal-field. Therefore, GetWriteAheadLog must
 	//! return nullptr when loading a database
 	bool load_complete = false;
+	//! The amount of rows that are written by the running checkpoint
+	atomic<idx_t> checkpoint_total_rows;
+	//! The amount of rows that have been written to disk by the running checkpoint
+	atomic<idx_t> checkpoint_written_rows;
+	//! Protects the WAL commit statistics, which outlive the WAL that is reset after every checkpoint
+	mutex wal_statistics_lock;
+	WALCommitStatistics wal_statistics;
 
 public:
 	template <class TARGET>
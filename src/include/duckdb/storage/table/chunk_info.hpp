@@ -11,6 +11,7 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/vector_size.hpp"
 #include "duckdb/common/atomic.hpp"
+#include "duckdb/common/types/validity_mask.hpp"
 
 namespace duckdb {
 class RowGroup;
@@ -21,7 +22,8 @@ struct DeleteInfo;
 class Serializer;
 class Deserializer;
 
-enum class ChunkInfoType : uint8_t { CONSTANT_INFO, VECTOR_INFO, EMPTY_INFO };
+//! Note that BITMAP_INFO only exists in memory - it is written to disk as a VECTOR_INFO
+enum class ChunkInfoType : uint8_t { CONSTANT_INFO, VECTOR_INFO, EMPTY_INFO, BITMAP_INFO };
 
 class ChunkInfo {
 public:
@@ -136,6 +138,48 @@ public:
 
 	bool HasDeletes() const override;
 
+	//! Whether or not all inserts and deletes in this vector were committed before the given start time
+	bool IsCommitted(transaction_t lowest_active_start) const;
+
+	void Write(WriteStream &writer) const override;
+
+private:
+	template <class OP>
+	idx_t TemplatedGetSelVector(transaction_t start_time, transaction_t transaction_id, SelectionVector &sel_vector,
+	                            idx_t max_count) const;
+};
+
+//! The ChunkBitmapInfo holds the deletes of a vector in which all inserts and deletes are committed and visible to
+//! every transaction. Instead of transaction ids per row, only the set of deleted rows is kept - either as a sorted
+//! list of offsets (when few rows are deleted) or as a bitmap.
+class ChunkBitmapInfo : public ChunkInfo {
+public:
+	static constexpr const ChunkInfoType TYPE = ChunkInfoType::BITMAP_INFO;
+	//! Up to this many deleted rows are stored as a list of offsets, beyond that a bitmap is used
+	static constexpr const idx_t MAX_OFFSET_COUNT = STANDARD_VECTOR_SIZE / 16;
+
+public:
+	//! Creates a bitmap info from a mask in which the deleted rows are invalid
+	ChunkBitmapInfo(idx_t start, const ValidityMask &visible_mask);
+
+	//! The amount of deleted rows
+	idx_t deleted_count;
+	//! The sorted offsets of the deleted rows (if deleted_count <= MAX_OFFSET_COUNT)
+	vector<uint16_t> deleted_offsets;
+	//! The bitmap of the rows that are not deleted (if deleted_count > MAX_OFFSET_COUNT)
+	ValidityMask visible;
+
+public:
+	idx_t GetSelVector(TransactionData transaction, SelectionVector &sel_vector, idx_t max_count) override;
+	idx_t GetCommittedSelVector(transaction_t min_start_id, transaction_t min_transaction_id,
+	                            SelectionVector &sel_vector, idx_t max_count) override;
+	bool Fetch(TransactionData transaction, row_t row) override;
+	void CommitAppend(transaction_t commit_id, idx_t start, idx_t end) override;
+	idx_t GetCommittedDeletedCount(idx_t max_count) override;
+
+	bool HasDeletes() const override;
+	bool IsDeleted(idx_t row) const;
+
 	void Write(WriteStream &writer) const override;
 	static unique_ptr<ChunkInfo> Read(ReadStream &reader);
 
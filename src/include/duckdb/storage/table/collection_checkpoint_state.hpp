@@ -0,0 +1,49 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/table/collection_checkpoint_state.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/storage/checkpoint/row_group_writer.hpp"
+#include "duckdb/storage/table/row_group.hpp"
+#include "duckdb/storage/table/segment_lock.hpp"
+#include "duckdb/storage/table/segment_tree.hpp"
+
+namespace duckdb {
+class RowGroupCollection;
+class TableDataWriter;
+
+struct VacuumState {
+	bool can_vacuum_deletes = false;
+	idx_t row_start = 0;
+	idx_t next_vacuum_idx = 0;
+	vector<idx_t> row_group_counts;
+};
+
+//! The state of a checkpoint of a row group collection. The row groups are written to disk by tasks that run on the
+//! task scheduler - the state keeps the collection locked until the checkpoint is finalized.
+struct CollectionCheckpointState {
+	CollectionCheckpointState(RowGroupCollection &collection, TableDataWriter &writer,
+	                          vector<SegmentNode<RowGroup>> segments, SegmentLock segment_lock);
+	~CollectionCheckpointState();
+
+	RowGroupCollection &collection;
+	TableDataWriter &writer;
+	//! The row groups of the collection - these are moved out of the segment tree during the checkpoint
+	vector<SegmentNode<RowGroup>> segments;
+	//! The lock on the segment tree of the collection
+	SegmentLock segment_lock;
+	vector<unique_ptr<RowGroupWriter>> writers;
+	vector<RowGroupWriteData> write_data;
+	VacuumState vacuum_state;
+
+	//! Executes the tasks that write the row groups
+	TaskExecutor executor;
+};
+
+} // namespace duckdb
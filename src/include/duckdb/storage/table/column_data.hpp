@@ -85,6 +85,8 @@ public:
 	const LogicalType &RootType() const;
 	//! Whether or not the column has any updates
 	bool HasUpdates() const;
+	//! Whether or not any of the "count" rows starting at "row_index" have updates
+	bool HasUpdates(idx_t row_index, idx_t count) const;
 	//! Whether or not we can scan an entire vector
 	virtual ScanVectorType GetVectorScanType(ColumnScanState &state, idx_t scan_count);
 
@@ -192,6 +194,8 @@ protected:
 	mutable mutex update_lock;
 	//! The updates for this column segment
 	unique_ptr<UpdateSegment> updates;
+	//! Whether the column has updates - scans check this before taking the update lock
+	atomic<bool> has_updates {false};
 	//! The lock for the stats
 	mutable mutex stats_lock;
 	//! The stats of the root segment
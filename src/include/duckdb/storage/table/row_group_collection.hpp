@@ -88,7 +88,10 @@ public:
 	void UpdateColumn(TransactionData transaction, Vector &row_ids, const vector<column_t> &column_path,
 	                  DataChunk &updates);
 
-	void Checkpoint(TableDataWriter &writer, TableStatistics &global_stats);
+	//! Schedules the tasks that write the row groups of the collection to disk. The collection remains locked until
+	//! the returned state is passed to Checkpoint, which finalizes the row groups.
+	unique_ptr<CollectionCheckpointState> ScheduleCheckpoint(TableDataWriter &writer);
+	void Checkpoint(CollectionCheckpointState &checkpoint_state, TableStatistics &global_stats);
 
 	void InitializeVacuumState(CollectionCheckpointState &checkpoint_state, VacuumState &state,
 	                           vector<SegmentNode<RowGroup>> &segments);
@@ -41,7 +41,9 @@ public:
 	idx_t DeleteRows(idx_t vector_idx, transaction_t transaction_id, row_t rows[], idx_t count);
 	void CommitDelete(idx_t vector_idx, transaction_t commit_id, const DeleteInfo &info);
 
-	vector<MetaBlockPointer> Checkpoint(MetadataManager &manager);
+	//! Writes the deletes to disk. Vectors in which all changes were committed before lowest_active_start are
+	//! compacted into deletion bitmaps in the process.
+	vector<MetaBlockPointer> Checkpoint(MetadataManager &manager, transaction_t lowest_active_start);
 	static shared_ptr<RowVersionManager> Deserialize(MetaBlockPointer delete_pointer, MetadataManager &manager,
 	                                                 idx_t start);
 
@@ -55,6 +57,7 @@ private:
 private:
 	optional_ptr<ChunkInfo> GetChunkInfo(idx_t vector_idx);
 	ChunkVectorInfo &GetVectorInfo(idx_t vector_idx);
+	void CompactCommittedVersions(transaction_t lowest_active_start);
 };
 
 } // namespace duckdb
@@ -27,7 +27,7 @@ class TemporaryFileManager;
 
 struct BlockIndexManager {
 public:
-	explicit BlockIndexManager(TemporaryFileManager &manager);
+	BlockIndexManager(TemporaryFileManager &manager, idx_t block_size);
 	BlockIndexManager();
 
 public:
@@ -48,6 +48,26 @@ private:
 	set<idx_t> free_indexes;
 	set<idx_t> indexes_in_use;
 	optional_ptr<TemporaryFileManager> manager;
+	//! The size of the blocks on disk (if a manager is set)
+	idx_t block_size;
+};
+
+//===--------------------------------------------------------------------===//
+// TemporaryBufferSize
+//===--------------------------------------------------------------------===//
+
+//! The size of the slots that buffers are stored in within temporary files. Compressed buffers are stored in the
+//! smallest slot they fit in, every slot size has its own set of files
+enum class TemporaryBufferSize : uint64_t {
+	INVALID = 0,
+	S32K = 32768,
+	S64K = 65536,
+	S96K = 98304,
+	S128K = 131072,
+	S160K = 163840,
+	S192K = 196608,
+	S224K = 229376,
+	DEFAULT = DEFAULT_BLOCK_ALLOC_SIZE
 };
 
 //===--------------------------------------------------------------------===//
@@ -57,10 +77,15 @@ private:
 // FIXME: should be optional_idx
 struct TemporaryFileIndex {
 	explicit TemporaryFileIndex(idx_t file_index = DConstants::INVALID_INDEX,
-	                            idx_t block_index = DConstants::INVALID_INDEX);
+	                            idx_t block_index = DConstants::INVALID_INDEX,
+	                            TemporaryBufferSize size = TemporaryBufferSize::INVALID);
 
 	idx_t file_index;
 	idx_t block_index;
+	//! The slot size of the file that the buffer is stored in
+	TemporaryBufferSize size;
+	//! The number of bytes that the (compressed) buffer occupies within its slot
+	idx_t compressed_size;
 
 public:
 	bool IsValid() const;
@@ -74,8 +99,8 @@ class TemporaryFileHandle {
 	constexpr static idx_t MAX_ALLOWED_INDEX_BASE = 4000;
 
 public:
-	TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory, idx_t index,
-	                    TemporaryFileManager &manager);
+	TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory,
+	                    TemporaryBufferSize size, idx_t index, TemporaryFileManager &manager);
 
 public:
 	struct TemporaryFileLock {
@@ -87,10 +112,14 @@ public:
 	};
 
 public:
+	TemporaryBufferSize GetSize() const {
+		return size;
+	}
 	TemporaryFileIndex TryGetBlockIndex();
-	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index);
-	unique_ptr<FileBuffer> ReadTemporaryBuffer(idx_t block_index, unique_ptr<FileBuffer> reusable_buffer);
-	void EraseBlockIndex(block_id_t block_index);
+	//! Writes a buffer to the file - compressed buffers are written from the compressed data
+	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index, AllocatedData &compressed_buffer);
+	unique_ptr<FileBuffer> ReadTemporaryBuffer(TemporaryFileIndex index, unique_ptr<FileBuffer> reusable_buffer);
+	void EraseBlockIndex(TemporaryFileIndex index);
 	bool DeleteIfEmpty();
 	TemporaryFileInformation GetTemporaryFile();
 
@@ -103,10 +132,15 @@ private:
 	const idx_t max_allowed_index;
 	DatabaseInstance &db;
 	unique_ptr<FileHandle> handle;
+	//! The size of the slots in this file
+	const TemporaryBufferSize size;
 	idx_t file_index;
 	string path;
 	mutex file_lock;
 	BlockIndexManager index_manager;
+	//! The number of buffers stored in this file, and their total size after compression
+	idx_t buffer_count;
+	idx_t compressed_bytes;
 };
 
 //===--------------------------------------------------------------------===//
@@ -159,6 +193,8 @@ public:
 	void DecreaseSizeOnDisk(idx_t amount);
 
 private:
+	//! Compresses a buffer (if enabled), returns the slot size that the buffer is written to
+	TemporaryBufferSize CompressBuffer(FileBuffer &buffer, AllocatedData &compressed_buffer, idx_t &compressed_size);
 	void EraseUsedBlock(TemporaryManagerLock &lock, block_id_t id, TemporaryFileHandle *handle,
 	                    TemporaryFileIndex index);
 	TemporaryFileHandle *GetFileHandle(TemporaryManagerLock &, idx_t index);
@@ -12,14 +12,18 @@
 #include "duckdb/catalog/catalog_entry/scalar_macro_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/sequence_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/table_macro_catalog_entry.hpp"
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/enums/wal_type.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/serializer/buffered_file_writer.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/storage/block.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 struct AlterInfo;
@@ -115,7 +119,14 @@ public:
 	void Truncate(int64_t size);
 	//! Delete the WAL file on disk. The WAL should not be used after this point.
 	void Delete();
+	//! Writes a WAL_FLUSH entry and syncs the WAL to disk
 	void Flush();
+	//! Writes the WAL_FLUSH entry of a commit and hands the buffered entries to the file system without syncing them.
+	//! Returns the sequence number of the commit, which has to be passed to SyncCommit to make the commit durable.
+	idx_t WriteCommit();
+	//! Waits until the commit with the given sequence number is durable. Committers that arrive while the WAL is being
+	//! synced form a group: the next one to find the WAL idle syncs it once for all commits written so far.
+	void SyncCommit(idx_t commit_sequence);
 
 	void WriteCheckpoint(MetaBlockPointer meta_block);
 
@@ -123,6 +134,18 @@ protected:
 	AttachedDatabase &database;
 	unique_ptr<BufferedFileWriter> writer;
 	string wal_path;
+	//! The number of commits that have been written to the WAL file
+	atomic<idx_t> written_commits;
+	//! Protects the group commit state below
+	mutex sync_lock;
+	//! Signals the committers that are waiting for a sync
+	std::condition_variable sync_finished;
+	//! The number of commits that have been synced
+	idx_t synced_commits;
+	//! Whether a committer is currently syncing the WAL file
+	bool sync_in_progress;
+	//! The error of a failed sync - once a sync fails, none of the waiting commits can be made durable
+	string sync_error;
 };
 
 } // namespace duckdb
@@ -31,6 +31,8 @@ public:
 	transaction_t commit_id;
 	//! Highest active query when the transaction finished, used for cleaning up
 	transaction_t highest_active_query;
+	//! The sequence number of the commit in the WAL, if the commit still has to be synced to become durable
+	idx_t wal_commit_sequence;
 
 public:
 	static DuckTransaction &Get(ClientContext &context, AttachedDatabase &db);
@@ -44,6 +46,8 @@ public:
 	//! Commit the current transaction with the given commit identifier. Returns an error message if the transaction
 	//! commit failed, or an empty string if the commit was sucessful
 	ErrorData Commit(AttachedDatabase &db, transaction_t commit_id, bool checkpoint) noexcept;
+	//! Waits until the WAL entries written by Commit are synced to disk
+	void SyncCommit(AttachedDatabase &db);
 	//! Returns whether or not a commit of this transaction should trigger an automatic checkpoint
 	bool AutomaticCheckpoint(AttachedDatabase &db, const UndoBufferProperties &properties);
 
@@ -10,7 +10,11 @@
 
 #include "duckdb/transaction/transaction_manager.hpp"
 #include "duckdb/storage/storage_lock.hpp"
+#include "duckdb/common/deque.hpp"
 #include "duckdb/common/enums/checkpoint_type.hpp"
+#include "duckdb/common/thread.hpp"
+
+#include <condition_variable>
 
 namespace duckdb {
 class DuckTransaction;
@@ -18,6 +22,15 @@ class DuckTransaction;
 //! The Transaction Manager is responsible for creating and managing
 //! transactions
 class DuckTransactionManager : public TransactionManager {
+public:
+	//! The time (in milliseconds) after which the background checkpointer retries a checkpoint that was blocked by
+	//! active write transactions
+	static constexpr const idx_t BACKGROUND_CHECKPOINT_RETRY_MS = 100;
+	//! The number of bytes an updated value counts as towards the automatic checkpoint threshold - updates slow down
+	//! scans until a checkpoint folds them into rewritten column segments, so they trigger a checkpoint well before
+	//! their WAL entries would (with the default threshold, after roughly a row group of updated values)
+	static constexpr const idx_t UPDATE_FOLD_VALUE_SIZE = 128;
+
 public:
 	explicit DuckTransactionManager(AttachedDatabase &db);
 	~DuckTransactionManager() override;
@@ -52,6 +65,9 @@ public:
 	unique_ptr<StorageLockKey> SharedCheckpointLock();
 	unique_ptr<StorageLockKey> TryUpgradeCheckpointLock(StorageLockKey &lock);
 
+	//! Stops the background checkpointer (if any), waiting for a running checkpoint to finish
+	void StopBackgroundCheckpointer();
+
 protected:
 	struct CheckpointDecision {
 		explicit CheckpointDecision(string reason_p);
@@ -61,6 +77,10 @@ protected:
 		bool can_checkpoint;
 		string reason;
 		CheckpointType type;
+		//! Whether the automatic checkpoint is handed off to the background checkpointer
+		bool background = false;
+		//! Whether the background checkpointer should checkpoint to fold the updates of the transaction
+		bool fold_updates = false;
 	};
 
 private:
@@ -75,6 +95,13 @@ private:
 	CheckpointDecision CanCheckpoint(DuckTransaction &transaction, unique_ptr<StorageLockKey> &checkpoint_lock,
 	                                 const UndoBufferProperties &properties);
 
+	//! Requests an automatic checkpoint from the background checkpointer, starting it if required
+	void ScheduleBackgroundCheckpoint(bool fold_updates);
+	//! The main loop of the background checkpointer
+	void BackgroundCheckpointLoop();
+	//! Tries to perform a requested automatic checkpoint - returns false if the checkpoint lock could not be obtained
+	bool TryBackgroundCheckpoint(bool fold_updates);
+
 private:
 	//! The current start timestamp used by transactions
 	transaction_t current_start_timestamp;
@@ -86,6 +113,9 @@ private:
 	atomic<transaction_t> lowest_active_start;
 	//! The last commit timestamp
 	atomic<transaction_t> last_commit;
+	//! The commit ids of the committed transactions whose WAL entries are not synced yet, in commit order - their
+	//! changes are not visible to transactions that start before they are durable
+	deque<transaction_t> unsynced_commits;
 	//! Set of currently running transactions
 	vector<unique_ptr<DuckTransaction>> active_transactions;
 	//! Set of recently committed transactions
@@ -98,6 +128,21 @@ private:
 	StorageLock checkpoint_lock;
 	//! Lock necessary to start transactions only - used by FORCE CHECKPOINT to prevent new transactions from starting
 	mutex start_transaction_lock;
+	//! The background checkpointer thread
+	unique_ptr<thread> checkpoint_thread;
+	//! The lock protecting the state of the background checkpointer
+	mutex checkpoint_thread_lock;
+	//! Signals the background checkpointer that a checkpoint was requested or that it should stop
+	std::condition_variable checkpoint_requested;
+	//! Whether an automatic checkpoint was requested but not yet performed
+	bool checkpoint_pending = false;
+	//! Whether the requested checkpoint should fold updates - in which case it is performed regardless of the WAL size
+	bool checkpoint_fold_updates = false;
+	//! Whether the background checkpointer should stop
+	bool checkpoint_thread_stopped = false;
+	//! Whether the last checkpoint of the background checkpointer failed - the next automatic checkpoint is then
+	//! performed by the committing transaction, so that the error is reported to a client
+	atomic<bool> background_checkpoint_failed {false};
 
 protected:
 	virtual void OnCommitCheckpointDecision(const CheckpointDecision &decision, DuckTransaction &transaction) {
@@ -18,6 +18,8 @@ class WriteAheadLog;
 
 struct UndoBufferProperties {
 	idx_t estimated_size = 0;
+	//! The number of values that were updated
+	idx_t updated_values = 0;
 	bool has_updates = false;
 	bool has_deletes = false;
 	bool has_catalog_changes = false;
@@ -150,6 +150,11 @@ void AttachedDatabase::Close() {
 	}
 	is_closed = true;
 
+	if (transaction_manager && transaction_manager->IsDuckTransactionManager()) {
+		// stop the background checkpointer before the storage is checkpointed and closed
+		DuckTransactionManager::Get(*this).StopBackgroundCheckpointer();
+	}
+
 	if (!IsSystem() && !catalog->InMemory()) {
 		db.GetDatabaseManager().EraseDatabasePath(catalog->GetDBPath());
 	}
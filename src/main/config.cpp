@@ -57,7 +57,9 @@ bool DBConfigOptions::debug_print_bindings = false;
 static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(AccessModeSetting),
     DUCKDB_GLOBAL(AllowPersistentSecrets),
+    DUCKDB_GLOBAL(BackgroundCheckpointSetting),
     DUCKDB_GLOBAL(CheckpointThresholdSetting),
+    DUCKDB_GLOBAL(CommitDelaySetting),
     DUCKDB_GLOBAL(DebugCheckpointAbort),
     DUCKDB_GLOBAL(StorageCompatibilityVersion),
     DUCKDB_LOCAL(DebugForceExternal),
@@ -121,6 +123,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(SecretDirectorySetting),
     DUCKDB_GLOBAL(DefaultSecretStorage),
     DUCKDB_GLOBAL(TempDirectorySetting),
+    DUCKDB_GLOBAL(TempFileCompressionSetting),
     DUCKDB_GLOBAL(ThreadsSetting),
     DUCKDB_GLOBAL(UsernameSetting),
     DUCKDB_GLOBAL(ExportLargeBufferArrow),
@@ -78,6 +78,22 @@ Value AllowPersistentSecrets::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(config.secret_manager->PersistentSecretsEnabled());
 }
 
+//===--------------------------------------------------------------------===//
+// Background Checkpoint
+//===--------------------------------------------------------------------===//
+void BackgroundCheckpointSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.background_checkpoint = input.GetValue<bool>();
+}
+
+void BackgroundCheckpointSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.background_checkpoint = DBConfig().options.background_checkpoint;
+}
+
+Value BackgroundCheckpointSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.background_checkpoint);
+}
+
 //===--------------------------------------------------------------------===//
 // Checkpoint Threshold
 //===--------------------------------------------------------------------===//
@@ -95,6 +111,22 @@ Value CheckpointThresholdSetting::GetSetting(const ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.options.checkpoint_wal_size));
 }
 
+//===--------------------------------------------------------------------===//
+// Commit Delay
+//===--------------------------------------------------------------------===//
+void CommitDelaySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.commit_delay = input.GetValue<idx_t>();
+}
+
+void CommitDelaySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.commit_delay = DBConfig().options.commit_delay;
+}
+
+Value CommitDelaySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.commit_delay);
+}
+
 //===--------------------------------------------------------------------===//
 // Debug Checkpoint Abort
 //===--------------------------------------------------------------------===//
@@ -1417,6 +1449,22 @@ Value TempDirectorySetting::GetSetting(const ClientContext &context) {
 	return Value(buffer_manager.GetTemporaryDirectory());
 }
 
+//===--------------------------------------------------------------------===//
+// Temp File Compression
+//===--------------------------------------------------------------------===//
+void TempFileCompressionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.temp_file_compression = input.GetValue<bool>();
+}
+
+void TempFileCompressionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.temp_file_compression = DBConfig().options.temp_file_compression;
+}
+
+Value TempFileCompressionSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.temp_file_compression);
+}
+
 //===--------------------------------------------------------------------===//
 // Threads Setting
 //===--------------------------------------------------------------------===//
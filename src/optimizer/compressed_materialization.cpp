@@ -92,7 +92,7 @@ void CompressedMaterialization::Compress(unique_ptr<LogicalOperator> &op) {
 
 	switch (op->type) {
 	case LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY:
-		CompressAggregate(op);
+		CompressAggregate(PackAggregateGroups(op));
 		break;
 	case LogicalOperatorType::LOGICAL_DISTINCT:
 		CompressDistinct(op);
@@ -1,7 +1,16 @@
+#include "duckdb/common/bit_utils.hpp"
+#include "duckdb/function/scalar/compressed_materialization_functions.hpp"
+#include "duckdb/main/client_config.hpp"
+#include "duckdb/optimizer/column_binding_replacer.hpp"
 #include "duckdb/optimizer/compressed_materialization.hpp"
+#include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/planner/binder.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
 
 namespace duckdb {
 
@@ -111,6 +120,192 @@ void CompressedMaterialization::CompressAggregate(unique_ptr<LogicalOperator> &o
 	UpdateAggregateStats(op);
 }
 
+static LogicalType GetPackedType(const idx_t total_width) {
+	for (const auto &packed_type : CMIntegralPackFun::PackedTypes()) {
+		if (total_width <= GetTypeIdSize(packed_type.InternalType()) * 8) {
+			return packed_type;
+		}
+	}
+	throw InternalException("Packed key does not fit in any of the packed types");
+}
+
+unique_ptr<LogicalOperator> &CompressedMaterialization::PackAggregateGroups(unique_ptr<LogicalOperator> &op) {
+	auto &aggregate = op->Cast<LogicalAggregate>();
+	auto &groups = aggregate.groups;
+	auto &group_stats = aggregate.group_stats;
+	if (aggregate.grouping_sets.size() > 1 || !aggregate.grouping_functions.empty()) {
+		return op;
+	}
+	if (aggregate.grouping_sets.size() == 1 && aggregate.grouping_sets[0].size() != groups.size()) {
+		return op;
+	}
+	if (groups.size() < 2 || group_stats.size() != groups.size()) {
+		return op;
+	}
+
+	// Find the integral groups with a known range, each of these gets (range + 1) values: one is reserved for NULL
+	vector<bool> is_packed(groups.size(), false);
+	vector<uint8_t> widths(groups.size(), 0);
+	idx_t packed_count = 0;
+	idx_t total_width = 0;
+	for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+		const auto &type = groups[group_idx]->return_type;
+		const auto &stats = group_stats[group_idx];
+		if (!type.IsIntegral() || GetTypeIdSize(type.InternalType()) > sizeof(uint64_t)) {
+			continue;
+		}
+		if (!stats || stats->GetType() != type || !NumericStats::HasMinMax(*stats)) {
+			continue;
+		}
+		const auto min = NumericStats::Min(*stats).GetValue<hugeint_t>();
+		const auto max = NumericStats::Max(*stats).GetValue<hugeint_t>();
+		if (max < min || max - min >= Hugeint::Convert(NumericLimits<uint64_t>::Maximum())) {
+			continue;
+		}
+		const auto range = Hugeint::Cast<uint64_t>(max - min) + 1;
+		const auto width = NumericCast<uint8_t>(64 - CountZeros<uint64_t>::Leading(range));
+		if (total_width + width > GetTypeIdSize(PhysicalType::UINT128) * 8) {
+			continue;
+		}
+		is_packed[group_idx] = true;
+		widths[group_idx] = width;
+		packed_count++;
+		total_width += width;
+	}
+	if (packed_count < 2) {
+		return op; // Nothing to gain
+	}
+	if (total_width <= ClientConfig::GetConfig(context).perfect_ht_threshold) {
+		return op; // These are small enough for a perfect hash aggregate
+	}
+	const auto packed_type = GetPackedType(total_width);
+
+	// Create the packed group and remember how to unpack every key
+	const auto bindings_before = aggregate.GetColumnBindings();
+	const auto types_before = aggregate.types;
+	vector<unique_ptr<BaseStatistics>> stats_before(groups.size());
+	vector<uint8_t> shifts(groups.size(), 0);
+	vector<Value> mins(groups.size());
+	vector<LogicalType> argument_types;
+	vector<unique_ptr<Expression>> arguments;
+	uint8_t shift = 0;
+	for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+		if (group_stats[group_idx]) {
+			stats_before[group_idx] = group_stats[group_idx]->ToUnique();
+		}
+		if (!is_packed[group_idx]) {
+			continue;
+		}
+		shifts[group_idx] = shift;
+		mins[group_idx] = NumericStats::Min(*group_stats[group_idx]);
+		argument_types.push_back(groups[group_idx]->return_type);
+		argument_types.push_back(groups[group_idx]->return_type);
+		argument_types.push_back(LogicalType::UTINYINT);
+		arguments.push_back(std::move(groups[group_idx]));
+		arguments.push_back(make_uniq<BoundConstantExpression>(mins[group_idx]));
+		arguments.push_back(make_uniq<BoundConstantExpression>(Value::UTINYINT(shift)));
+		shift = NumericCast<uint8_t>(shift + widths[group_idx]);
+	}
+	auto pack_function = CMIntegralPackFun::GetFunction(argument_types, packed_type);
+	auto packed_expr = make_uniq<BoundFunctionExpression>(packed_type, pack_function, std::move(arguments), nullptr);
+
+	auto packed_stats = NumericStats::CreateEmpty(packed_type);
+	NumericStats::SetMin(packed_stats, Value::MinimumValue(packed_type));
+	NumericStats::SetMax(packed_stats, Value::MaximumValue(packed_type));
+	packed_stats.SetHasNoNull();
+
+	// The packed group goes first, followed by the groups we could not pack
+	vector<unique_ptr<Expression>> new_groups;
+	vector<unique_ptr<BaseStatistics>> new_group_stats;
+	vector<idx_t> new_group_idxs(groups.size(), DConstants::INVALID_INDEX);
+	new_groups.push_back(std::move(packed_expr));
+	new_group_stats.push_back(packed_stats.ToUnique());
+	for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+		if (is_packed[group_idx]) {
+			continue;
+		}
+		new_group_idxs[group_idx] = new_groups.size();
+		new_groups.push_back(std::move(groups[group_idx]));
+		new_group_stats.push_back(std::move(group_stats[group_idx]));
+	}
+	groups = std::move(new_groups);
+	group_stats = std::move(new_group_stats);
+	if (!aggregate.grouping_sets.empty()) {
+		GroupingSet grouping_set;
+		for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+			grouping_set.insert(group_idx);
+		}
+		aggregate.grouping_sets[0] = std::move(grouping_set);
+	}
+	op->ResolveOperatorTypes();
+	for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+		if (group_stats[group_idx]) {
+			statistics_map[ColumnBinding(aggregate.group_index, group_idx)] = group_stats[group_idx]->ToUnique();
+		}
+	}
+
+	// Unpack the keys in a projection on top of the aggregate
+	const ColumnBinding packed_binding(aggregate.group_index, 0);
+	vector<unique_ptr<Expression>> unpack_exprs;
+	vector<unique_ptr<BaseStatistics>> statistics;
+	for (idx_t col_idx = 0; col_idx < bindings_before.size(); col_idx++) {
+		const auto &type = types_before[col_idx];
+		if (col_idx >= stats_before.size()) {
+			// Aggregates are passed through
+			unpack_exprs.push_back(make_uniq<BoundColumnRefExpression>(type, bindings_before[col_idx]));
+			auto it = statistics_map.find(bindings_before[col_idx]);
+			if (it != statistics_map.end() && it->second) {
+				statistics.push_back(it->second->ToUnique());
+			} else {
+				statistics.push_back(nullptr);
+			}
+		} else if (is_packed[col_idx]) {
+			vector<unique_ptr<Expression>> unpack_arguments;
+			unpack_arguments.push_back(make_uniq<BoundColumnRefExpression>(packed_type, packed_binding));
+			unpack_arguments.push_back(make_uniq<BoundConstantExpression>(Value::UTINYINT(shifts[col_idx])));
+			unpack_arguments.push_back(make_uniq<BoundConstantExpression>(Value::UTINYINT(widths[col_idx])));
+			unpack_arguments.push_back(make_uniq<BoundConstantExpression>(mins[col_idx]));
+			auto unpack_function = CMIntegralUnpackFun::GetFunction(packed_type, type);
+			unpack_exprs.push_back(
+			    make_uniq<BoundFunctionExpression>(type, unpack_function, std::move(unpack_arguments), nullptr));
+			statistics.push_back(std::move(stats_before[col_idx]));
+		} else {
+			const ColumnBinding new_binding(aggregate.group_index, new_group_idxs[col_idx]);
+			unpack_exprs.push_back(make_uniq<BoundColumnRefExpression>(type, new_binding));
+			statistics.push_back(std::move(stats_before[col_idx]));
+		}
+	}
+
+	const auto table_index = optimizer.binder.GenerateTableIndex();
+	auto unpack_projection = make_uniq<LogicalProjection>(table_index, std::move(unpack_exprs));
+	unpack_projection->children.emplace_back(std::move(op));
+	op = std::move(unpack_projection);
+	op->ResolveOperatorTypes();
+
+	const auto new_bindings = op->GetColumnBindings();
+	for (idx_t col_idx = 0; col_idx < new_bindings.size(); col_idx++) {
+		if (statistics[col_idx]) {
+			statistics_map[new_bindings[col_idx]] = std::move(statistics[col_idx]);
+		}
+	}
+
+	if (RefersToSameObject(*op->children[0], *root)) {
+		root = op;
+		return op->children[0];
+	}
+
+	// Make the plan consistent again, skipping the unpack projection
+	ColumnBindingReplacer replacer;
+	for (idx_t col_idx = 0; col_idx < bindings_before.size(); col_idx++) {
+		replacer.replacement_bindings.emplace_back(bindings_before[col_idx], new_bindings[col_idx],
+		                                           op->types[col_idx]);
+	}
+	replacer.stop_operator = op.get();
+	replacer.VisitOperator(*root);
+
+	return op->children[0];
+}
+
 void CompressedMaterialization::UpdateAggregateStats(unique_ptr<LogicalOperator> &op) {
 	if (op->type != LogicalOperatorType::LOGICAL_PROJECTION) {
 		return;
@@ -12,6 +12,7 @@
 #include "duckdb/planner/expression/bound_operator_expression.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/optimizer/optimizer.hpp"
@@ -435,7 +436,7 @@ static unique_ptr<TableFilter> PushDownFilterIntoExpr(const Expression &expr, un
 	return inner_filter;
 }
 
-TableFilterSet FilterCombiner::GenerateTableScanFilters(vector<idx_t> &column_ids) {
+TableFilterSet FilterCombiner::GenerateTableScanFilters(vector<idx_t> &column_ids, bool in_filter_pushdown) {
 	TableFilterSet table_filters;
 	//! First, we figure the filters that have constant expressions that we can push down to the table scan
 	for (auto &constant_value : constant_values) {
@@ -568,46 +569,54 @@ TableFilterSet FilterCombiner::GenerateTableScanFilters(vector<idx_t> &column_id
 			}
 			auto &fst_const_value_expr = func.children[1]->Cast<BoundConstantExpression>();
 			auto &type = fst_const_value_expr.value.type();
-
-			//! Check if values are consecutive, if yes transform them to >= <= (only for integers)
-			// e.g. if we have x IN (1, 2, 3, 4, 5) we transform this into x >= 1 AND x <= 5
-			if (!type.IsIntegral()) {
+			if (type != column_ref.return_type) {
 				continue;
 			}
 
-			bool can_simplify_in_clause = true;
+			//! Check if values are consecutive, if yes transform them to >= <= (only for integers)
+			// e.g. if we have x IN (1, 2, 3, 4, 5) we transform this into x >= 1 AND x <= 5
+			bool can_simplify_in_clause = type.IsIntegral();
+			vector<Value> set_values;
 			for (idx_t i = 1; i < func.children.size(); i++) {
 				auto &const_value_expr = func.children[i]->Cast<BoundConstantExpression>();
 				if (const_value_expr.value.IsNull()) {
-					can_simplify_in_clause = false;
-					break;
+					// NULL never matches - it can be ignored in a filter
+					continue;
+				}
+				if (can_simplify_in_clause) {
+					in_values.push_back(const_value_expr.value.GetValue<hugeint_t>());
 				}
-				in_values.push_back(const_value_expr.value.GetValue<hugeint_t>());
+				set_values.push_back(const_value_expr.value);
 			}
-			if (!can_simplify_in_clause || in_values.empty()) {
+			if (set_values.empty()) {
 				continue;
 			}
-
-			sort(in_values.begin(), in_values.end());
-
-			for (idx_t in_val_idx = 1; in_val_idx < in_values.size(); in_val_idx++) {
-				if (in_values[in_val_idx] - in_values[in_val_idx - 1] > 1) {
-					can_simplify_in_clause = false;
-					break;
+			if (can_simplify_in_clause) {
+				sort(in_values.begin(), in_values.end());
+				for (idx_t in_val_idx = 1; in_val_idx < in_values.size(); in_val_idx++) {
+					if (in_values[in_val_idx] - in_values[in_val_idx - 1] > 1) {
+						can_simplify_in_clause = false;
+						break;
+					}
 				}
 			}
-			if (!can_simplify_in_clause) {
+			if (can_simplify_in_clause) {
+				auto lower_bound = make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO,
+				                                             Value::Numeric(type, in_values.front()));
+				auto upper_bound = make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO,
+				                                             Value::Numeric(type, in_values.back()));
+				table_filters.PushFilter(column_index, std::move(lower_bound));
+				table_filters.PushFilter(column_index, std::move(upper_bound));
+			} else if (in_filter_pushdown && InFilter::SupportsType(type)) {
+				//! Otherwise push the set of values into the scan, e.g. x IN (1, 7, 42)
+				table_filters.PushFilter(column_index, make_uniq<InFilter>(std::move(set_values)));
+			} else {
 				continue;
 			}
-			auto lower_bound = make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO,
-			                                             Value::Numeric(type, in_values.front()));
-			auto upper_bound = make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO,
-			                                             Value::Numeric(type, in_values.back()));
-			table_filters.PushFilter(column_index, std::move(lower_bound));
-			table_filters.PushFilter(column_index, std::move(upper_bound));
 			table_filters.PushFilter(column_index, make_uniq<IsNotNullFilter>());
 
 			remaining_filters.erase_at(rem_fil_idx);
+			rem_fil_idx--;
 		}
 	}
 
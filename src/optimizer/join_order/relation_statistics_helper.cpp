@@ -8,6 +8,7 @@
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 
 namespace duckdb {
 
@@ -371,6 +372,18 @@ idx_t RelationStatisticsHelper::InspectConjunctionAND(idx_t cardinality, idx_t c
                                                       ConjunctionAndFilter &filter, BaseStatistics &base_stats) {
 	auto cardinality_after_filters = cardinality;
 	for (auto &child_filter : filter.child_filters) {
+		if (child_filter->filter_type == TableFilterType::IN_FILTER) {
+			// every value in the set selects (cardinality / column_count) rows
+			auto &in_filter = child_filter->Cast<InFilter>();
+			auto column_count = base_stats.GetDistinctCount();
+			if (column_count > 0) {
+				auto set_count = MinValue<idx_t>(in_filter.values.size(), column_count);
+				auto set_cardinality = NumericCast<idx_t>(
+				    std::ceil(double(cardinality) * double(set_count) / double(column_count)));
+				cardinality_after_filters = MinValue(cardinality_after_filters, set_cardinality);
+			}
+			continue;
+		}
 		if (child_filter->filter_type != TableFilterType::CONSTANT_COMPARISON) {
 			continue;
 		}
@@ -0,0 +1,104 @@
+#include "duckdb/parallel/task_executor.hpp"
+
+namespace duckdb {
+
+TaskExecutor::TaskExecutor(TaskScheduler &scheduler)
+    : scheduler(scheduler), token(scheduler.CreateProducer()), completed_tasks(0), total_tasks(0) {
+}
+
+TaskExecutor::~TaskExecutor() {
+	// the tasks reference the executor - we cannot be destroyed before they have all finished
+	CancelTasks();
+}
+
+void TaskExecutor::PushError(ErrorData error) {
+	error_manager.PushError(std::move(error));
+}
+
+bool TaskExecutor::HasError() {
+	return error_manager.HasError();
+}
+
+void TaskExecutor::ThrowError() {
+	error_manager.ThrowException();
+}
+
+void TaskExecutor::ScheduleTask(unique_ptr<Task> task) {
+	{
+		lock_guard<mutex> guard(tasks_lock);
+		total_tasks++;
+	}
+	scheduler.ScheduleTask(*token, std::move(task));
+}
+
+void TaskExecutor::FinishTask() {
+	lock_guard<mutex> guard(tasks_lock);
+	completed_tasks++;
+	if (completed_tasks == total_tasks) {
+		tasks_finished.notify_all();
+	}
+}
+
+bool TaskExecutor::GetTask(shared_ptr<Task> &task) {
+	return scheduler.GetTaskFromProducer(*token, task);
+}
+
+void TaskExecutor::WaitForTasks() {
+	shared_ptr<Task> task;
+	while (GetTask(task)) {
+		auto result = task->Execute(TaskExecutionMode::PROCESS_ALL);
+		(void)result;
+		D_ASSERT(result != TaskExecutionResult::TASK_BLOCKED);
+		task.reset();
+	}
+	// all tasks have been picked up - wait for the ones that are still running on other threads
+	unique_lock<mutex> guard(tasks_lock);
+	tasks_finished.wait(guard, [&]() { return completed_tasks == total_tasks; });
+}
+
+void TaskExecutor::WorkOnTasks() {
+	WaitForTasks();
+	if (HasError()) {
+		ThrowError();
+	}
+}
+
+void TaskExecutor::CancelTasks() {
+	{
+		lock_guard<mutex> guard(tasks_lock);
+		if (completed_tasks == total_tasks) {
+			return;
+		}
+	}
+	// the tasks that have not started yet see the error and finish right away
+	if (!HasError()) {
+		PushError(ErrorData("Tasks were cancelled"));
+	}
+	WaitForTasks();
+}
+
+BaseExecutorTask::BaseExecutorTask(TaskExecutor &executor) : executor(executor) {
+}
+
+TaskExecutionResult BaseExecutorTask::Execute(TaskExecutionMode mode) {
+	(void)mode;
+	D_ASSERT(mode == TaskExecutionMode::PROCESS_ALL);
+	if (executor.HasError()) {
+		// another task has failed - skip this one
+		executor.FinishTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+	try {
+		ExecuteTask();
+		executor.FinishTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	} catch (std::exception &ex) {
+		executor.PushError(ErrorData(ex));
+	} catch (...) { // LCOV_EXCL_START
+		executor.PushError(ErrorData("Unknown exception in task!"));
+	} // LCOV_EXCL_STOP
+	executor.FinishTask();
+	return TaskExecutionResult::TASK_ERROR;
+}
+
+} // namespace duckdb
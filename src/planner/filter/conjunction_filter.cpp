@@ -66,11 +66,16 @@ FilterPropagateResult ConjunctionAndFilter::CheckStatistics(BaseStatistics &stat
 
 string ConjunctionAndFilter::ToString(const string &column_name) {
 	string result;
-	for (idx_t i = 0; i < child_filters.size(); i++) {
-		if (i > 0) {
+	for (auto &child_filter : child_filters) {
+		auto child_str = child_filter->ToString(column_name);
+		if (child_str.empty()) {
+			// dynamic filters that have not been computed (yet) have no string representation
+			continue;
+		}
+		if (!result.empty()) {
 			result += " AND ";
 		}
-		result += child_filters[i]->ToString(column_name);
+		result += child_str;
 	}
 	return result;
 }
@@ -0,0 +1,155 @@
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// HashBloomFilter
+//===--------------------------------------------------------------------===//
+HashBloomFilter::HashBloomFilter(idx_t expected_count) {
+	auto bits = NextPowerOfTwo(MaxValue<idx_t>(expected_count * BITS_PER_HASH, 64));
+	auto block_count = MinValue<idx_t>(bits / 64, MAXIMUM_SIZE / sizeof(uint64_t));
+	blocks = make_unsafe_uniq_array<uint64_t>(block_count);
+	std::fill_n(blocks.get(), block_count, 0);
+	block_mask = block_count - 1;
+}
+
+void HashBloomFilter::Insert(const hash_t *hashes, idx_t count) {
+	auto atomic_blocks = reinterpret_cast<atomic<uint64_t> *>(blocks.get());
+	for (idx_t i = 0; i < count; i++) {
+		atomic_blocks[GetBlockIndex(hashes[i])].fetch_or(GetBlockMask(hashes[i]), std::memory_order_relaxed);
+	}
+}
+
+idx_t HashBloomFilter::Probe(const hash_t *hashes, SelectionVector &sel, idx_t count) const {
+	SelectionVector result_sel(count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = sel.get_index(i);
+		auto hash = hashes[idx];
+		auto mask = GetBlockMask(hash);
+		if ((blocks[GetBlockIndex(hash)] & mask) == mask) {
+			result_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(result_sel);
+	return result_count;
+}
+
+//===--------------------------------------------------------------------===//
+// DynamicFilterData
+//===--------------------------------------------------------------------===//
+DynamicFilterData::DynamicFilterData(LogicalType key_type_p)
+    : key_type(std::move(key_type_p)), initialized(false), bloom_probe_count(0), bloom_pass_count(0),
+      bloom_enabled(false) {
+}
+
+void DynamicFilterData::Initialize(unique_ptr<TableFilter> filter_p, unique_ptr<HashBloomFilter> bloom_filter_p) {
+	D_ASSERT(!initialized);
+	lock_guard<mutex> guard(lock);
+	filter = std::move(filter_p);
+	bloom_filter = std::move(bloom_filter_p);
+	bloom_enabled = bloom_filter != nullptr;
+	initialized = true;
+}
+
+void DynamicFilterData::Update(unique_ptr<TableFilter> filter_p) {
+	D_ASSERT(!bloom_filter);
+	lock_guard<mutex> guard(lock);
+	filter = std::move(filter_p);
+	initialized = true;
+}
+
+void DynamicFilterData::Reset() {
+	lock_guard<mutex> guard(lock);
+	initialized = false;
+	bloom_enabled = false;
+	bloom_probe_count = 0;
+	bloom_pass_count = 0;
+	filter.reset();
+	bloom_filter.reset();
+}
+
+bool DynamicFilterData::CanProbeBloomFilter(const LogicalType &type) const {
+	// the hashes are only identical if the type is identical
+	return initialized && bloom_enabled && type == key_type;
+}
+
+idx_t DynamicFilterData::ProbeBloomFilter(Vector &vector, SelectionVector &sel, idx_t approved_tuple_count) {
+	D_ASSERT(CanProbeBloomFilter(vector.GetType()));
+	if (approved_tuple_count == 0) {
+		return 0;
+	}
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(vector, hashes, sel, approved_tuple_count);
+	idx_t result_count;
+	if (hashes.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+		// all rows have the same hash: either all or none of them pass
+		SelectionVector constant_sel(1);
+		constant_sel.set_index(0, 0);
+		auto hash_data = ConstantVector::GetData<hash_t>(hashes);
+		result_count = bloom_filter->Probe(hash_data, constant_sel, 1) == 0 ? 0 : approved_tuple_count;
+	} else {
+		result_count = bloom_filter->Probe(FlatVector::GetData<hash_t>(hashes), sel, approved_tuple_count);
+	}
+
+	// keep track of the selectivity - if (almost) everything passes the bloom filter is not worth probing
+	auto probe_count = bloom_probe_count.fetch_add(approved_tuple_count) + approved_tuple_count;
+	auto pass_count = bloom_pass_count.fetch_add(result_count) + result_count;
+	if (probe_count >= BLOOM_MINIMUM_PROBE_COUNT &&
+	    double(pass_count) > double(probe_count) * BLOOM_MAXIMUM_PASS_RATIO) {
+		bloom_enabled = false;
+	}
+	return result_count;
+}
+
+//===--------------------------------------------------------------------===//
+// DynamicFilter
+//===--------------------------------------------------------------------===//
+DynamicFilter::DynamicFilter(shared_ptr<DynamicFilterData> filter_data_p)
+    : TableFilter(TableFilterType::DYNAMIC_FILTER), filter_data(std::move(filter_data_p)) {
+}
+
+FilterPropagateResult DynamicFilter::CheckStatistics(BaseStatistics &stats) {
+	if (!filter_data->initialized || stats.GetType() != filter_data->key_type) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	lock_guard<mutex> guard(filter_data->lock);
+	if (!filter_data->filter) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	return filter_data->filter->CheckStatistics(stats);
+}
+
+string DynamicFilter::ToString(const string &column_name) {
+	if (!filter_data->initialized) {
+		return string();
+	}
+	string result;
+	{
+		lock_guard<mutex> guard(filter_data->lock);
+		if (filter_data->filter) {
+			result = filter_data->filter->ToString(column_name);
+		}
+	}
+	if (filter_data->bloom_filter) {
+		result += result.empty() ? "" : " AND ";
+		result += "BLOOM(" + column_name + ")";
+	}
+	return result;
+}
+
+bool DynamicFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<DynamicFilter>();
+	return other.filter_data.get() == filter_data.get();
+}
+
+void DynamicFilter::Serialize(Serializer &serializer) const {
+	throw InternalException("Dynamic filters are computed during execution and cannot be serialized");
+}
+
+} // namespace duckdb
@@ -0,0 +1,245 @@
+#include "duckdb/planner/filter/in_filter.hpp"
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/unordered_set.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// InFilterLookup
+//===--------------------------------------------------------------------===//
+class InFilterLookup {
+public:
+	virtual ~InFilterLookup() {
+	}
+
+	virtual idx_t Select(UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t approved_tuple_count) const = 0;
+};
+
+template <class T>
+struct InFilterHash {
+	hash_t operator()(const T &value) const {
+		return Hash<T>(value);
+	}
+};
+
+template <class T>
+struct InFilterEquality {
+	bool operator()(const T &a, const T &b) const {
+		return Equals::Operation<T>(a, b);
+	}
+};
+
+template <class T>
+class TemplatedInFilterLookup : public InFilterLookup {
+public:
+	explicit TemplatedInFilterLookup(const vector<Value> &values) {
+		sorted_values.reserve(values.size());
+		for (auto &value : values) {
+			sorted_values.push_back(value.GetValueUnsafe<T>());
+		}
+		std::sort(sorted_values.begin(), sorted_values.end(),
+		          [](const T &a, const T &b) { return LessThan::Operation<T>(a, b); });
+		if (sorted_values.size() > InFilter::SORTED_LOOKUP_THRESHOLD) {
+			hash_set.insert(sorted_values.begin(), sorted_values.end());
+		}
+	}
+
+	idx_t Select(UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t approved_tuple_count) const override {
+		if (hash_set.empty()) {
+			return TemplatedSelect<false>(vdata, sel, approved_tuple_count);
+		}
+		return TemplatedSelect<true>(vdata, sel, approved_tuple_count);
+	}
+
+private:
+	inline bool ContainsSorted(const T &value) const {
+		auto entry = std::lower_bound(sorted_values.begin(), sorted_values.end(), value,
+		                              [](const T &a, const T &b) { return LessThan::Operation<T>(a, b); });
+		return entry != sorted_values.end() && Equals::Operation<T>(*entry, value);
+	}
+
+	template <bool USE_HASH_SET>
+	idx_t TemplatedSelect(UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t approved_tuple_count) const {
+		auto data = UnifiedVectorFormat::GetData<T>(vdata);
+		auto &validity = vdata.validity;
+		SelectionVector result_sel(approved_tuple_count);
+		idx_t result_count = 0;
+		for (idx_t i = 0; i < approved_tuple_count; i++) {
+			auto idx = sel.get_index(i);
+			auto vector_idx = vdata.sel->get_index(idx);
+			if (!validity.RowIsValid(vector_idx)) {
+				continue;
+			}
+			auto &value = data[vector_idx];
+			bool found = USE_HASH_SET ? hash_set.find(value) != hash_set.end() : ContainsSorted(value);
+			if (found) {
+				result_sel.set_index(result_count++, idx);
+			}
+		}
+		sel.Initialize(result_sel);
+		return result_count;
+	}
+
+private:
+	//! The values of the set in sorted order
+	vector<T> sorted_values;
+	//! A hash set of the values - only used for larger sets
+	unordered_set<T, InFilterHash<T>, InFilterEquality<T>> hash_set;
+};
+
+static unique_ptr<InFilterLookup> CreateInFilterLookup(const LogicalType &type, const vector<Value> &values) {
+	switch (type.InternalType()) {
+	case PhysicalType::UINT8:
+		return make_uniq<TemplatedInFilterLookup<uint8_t>>(values);
+	case PhysicalType::UINT16:
+		return make_uniq<TemplatedInFilterLookup<uint16_t>>(values);
+	case PhysicalType::UINT32:
+		return make_uniq<TemplatedInFilterLookup<uint32_t>>(values);
+	case PhysicalType::UINT64:
+		return make_uniq<TemplatedInFilterLookup<uint64_t>>(values);
+	case PhysicalType::UINT128:
+		return make_uniq<TemplatedInFilterLookup<uhugeint_t>>(values);
+	case PhysicalType::INT8:
+		return make_uniq<TemplatedInFilterLookup<int8_t>>(values);
+	case PhysicalType::INT16:
+		return make_uniq<TemplatedInFilterLookup<int16_t>>(values);
+	case PhysicalType::INT32:
+		return make_uniq<TemplatedInFilterLookup<int32_t>>(values);
+	case PhysicalType::INT64:
+		return make_uniq<TemplatedInFilterLookup<int64_t>>(values);
+	case PhysicalType::INT128:
+		return make_uniq<TemplatedInFilterLookup<hugeint_t>>(values);
+	case PhysicalType::FLOAT:
+		return make_uniq<TemplatedInFilterLookup<float>>(values);
+	case PhysicalType::DOUBLE:
+		return make_uniq<TemplatedInFilterLookup<double>>(values);
+	case PhysicalType::VARCHAR:
+		// the string_t values point into the (immutable) values of the filter
+		return make_uniq<TemplatedInFilterLookup<string_t>>(values);
+	default:
+		throw InternalException("Unsupported type \"%s\" for IN filter", type.ToString());
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// InFilter
+//===--------------------------------------------------------------------===//
+InFilter::InFilter(vector<Value> values_p) : TableFilter(TableFilterType::IN_FILTER), values(std::move(values_p)) {
+	if (values.empty()) {
+		throw InternalException("InFilter requires at least one value");
+	}
+	for (auto &value : values) {
+		if (value.IsNull() || value.type() != values[0].type()) {
+			throw InternalException("InFilter values must be non-NULL and of the same type");
+		}
+	}
+	std::sort(values.begin(), values.end());
+	values.erase(std::unique(values.begin(), values.end()), values.end());
+	lookup = CreateInFilterLookup(values[0].type(), values);
+}
+
+InFilter::~InFilter() {
+}
+
+bool InFilter::SupportsType(const LogicalType &type) {
+	if (type.id() == LogicalTypeId::ENUM) {
+		return false;
+	}
+	switch (type.InternalType()) {
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+	case PhysicalType::VARCHAR:
+		return true;
+	default:
+		return false;
+	}
+}
+
+idx_t InFilter::Select(UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t approved_tuple_count) const {
+	if (approved_tuple_count == 0) {
+		return 0;
+	}
+	return lookup->Select(vdata, sel, approved_tuple_count);
+}
+
+FilterPropagateResult InFilter::CheckStatistics(BaseStatistics &stats) {
+	D_ASSERT(values[0].type().id() == stats.GetType().id());
+	switch (values[0].type().InternalType()) {
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE: {
+		if (!NumericStats::HasMinMax(stats)) {
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+		// find the smallest value that is >= min - if it is bigger than max there are no matches
+		auto min = NumericStats::Min(stats);
+		auto max = NumericStats::Max(stats);
+		auto entry = std::lower_bound(values.begin(), values.end(), min);
+		if (entry == values.end() || *entry > max) {
+			return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+		}
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	case PhysicalType::VARCHAR: {
+		// string statistics only contain a prefix - only check the range of the set
+		if (StringStats::CheckZonemap(stats, ExpressionType::COMPARE_GREATERTHANOREQUALTO,
+		                              StringValue::Get(values.front())) == FilterPropagateResult::FILTER_ALWAYS_FALSE ||
+		    StringStats::CheckZonemap(stats, ExpressionType::COMPARE_LESSTHANOREQUALTO,
+		                              StringValue::Get(values.back())) == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+		}
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	default:
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+}
+
+string InFilter::ToString(const string &column_name) {
+	string result = column_name + " IN (";
+	for (idx_t i = 0; i < values.size(); i++) {
+		if (i > 0) {
+			result += ", ";
+		}
+		if (i == MAXIMUM_DISPLAYED_VALUES) {
+			result += "... (" + to_string(values.size()) + " values)";
+			break;
+		}
+		result += values[i].ToSQLString();
+	}
+	return result + ")";
+}
+
+bool InFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<InFilter>();
+	return other.values == values;
+}
+
+} // namespace duckdb
@@ -10,7 +10,8 @@ namespace duckdb {
 
 BlockHandle::BlockHandle(BlockManager &block_manager, block_id_t block_id_p, MemoryTag tag)
     : block_manager(block_manager), readers(0), block_id(block_id_p), tag(tag), buffer(nullptr), eviction_seq_num(0),
-      can_destroy(false), memory_charge(tag, block_manager.buffer_manager.GetBufferPool()), unswizzled(nullptr) {
+      eviction_queue_idx(0), resident_pins(0), can_destroy(false),
+      memory_charge(tag, block_manager.buffer_manager.GetBufferPool()), unswizzled(nullptr) {
 	eviction_seq_num = 0;
 	state = BlockState::BLOCK_UNLOADED;
 	memory_usage = Storage::BLOCK_ALLOC_SIZE;
@@ -20,8 +21,8 @@ BlockHandle::BlockHandle(BlockManager &block_manager, block_id_t block_id_p, Mem
                          unique_ptr<FileBuffer> buffer_p, bool can_destroy_p, idx_t block_size,
                          BufferPoolReservation &&reservation)
     : block_manager(block_manager), readers(0), block_id(block_id_p), tag(tag), eviction_seq_num(0),
-      can_destroy(can_destroy_p), memory_charge(tag, block_manager.buffer_manager.GetBufferPool()),
-      unswizzled(nullptr) {
+      eviction_queue_idx(0), resident_pins(0), can_destroy(can_destroy_p),
+      memory_charge(tag, block_manager.buffer_manager.GetBufferPool()), unswizzled(nullptr) {
 	buffer = std::move(buffer_p);
 	state = BlockState::BLOCK_LOADED;
 	memory_usage = block_size;
@@ -34,7 +35,7 @@ BlockHandle::~BlockHandle() { // NOLINT: allow internal exceptions
 	if (buffer && buffer->type != FileBufferType::TINY_BUFFER) {
 		// we kill the latest version in the eviction queue
 		auto &buffer_manager = block_manager.buffer_manager;
-		buffer_manager.GetBufferPool().IncrementDeadNodes();
+		buffer_manager.GetBufferPool().IncrementDeadNodes(*this);
 	}
 
 	// no references remain to this block: erase
@@ -107,6 +108,7 @@ unique_ptr<FileBuffer> BlockHandle::UnloadAndTakeBlock() {
 	}
 	memory_charge.Resize(0);
 	state = BlockState::BLOCK_UNLOADED;
+	resident_pins = 0;
 	return std::move(buffer);
 }
 
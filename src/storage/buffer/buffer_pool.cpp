@@ -2,6 +2,7 @@
 
 #include "duckdb/common/chrono.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/types/hash.hpp"
 #include "duckdb/parallel/concurrentqueue.hpp"
 #include "duckdb/storage/temporary_memory_manager.hpp"
 
@@ -10,9 +11,69 @@ namespace duckdb {
 typedef duckdb_moodycamel::ConcurrentQueue<BufferEvictionNode> eviction_queue_t;
 
 struct EvictionQueue {
+public:
+	EvictionQueue() : evict_queue_insertions(0), total_dead_nodes(0) {
+	}
+
+public:
+	//! Add a node to the eviction queue. Returns true, if the queue is ready to be purged, and false otherwise.
+	bool AddToEvictionQueue(BufferEvictionNode &&node);
+	//! Tries to dequeue an element from the eviction queue, but only after acquiring the purge queue lock.
+	bool TryDequeueWithLock(BufferEvictionNode &node);
+	//! Garbage collect dead nodes in the eviction queue.
+	void Purge();
+
+	//! Increment the dead node counter in the purge queue.
+	inline void IncrementDeadNodes() {
+		total_dead_nodes++;
+	}
+	//! Decrement the dead node counter in the purge queue.
+	inline void DecrementDeadNodes() {
+		total_dead_nodes--;
+	}
+
+private:
+	//! Bulk purge dead nodes from the eviction queue. Then, enqueue those that are still alive.
+	void PurgeIteration(const idx_t purge_size);
+
+public:
+	//! The concurrent queue
 	eviction_queue_t q;
+
+private:
+	//! We trigger a purge of the eviction queue every INSERT_INTERVAL insertions
+	constexpr static idx_t INSERT_INTERVAL = 4096;
+	//! We multiply the base purge size by this value.
+	constexpr static idx_t PURGE_SIZE_MULTIPLIER = 2;
+	//! We multiply the purge size by this value to determine early-outs. This is the minimum queue size.
+	//! We never purge below this point.
+	constexpr static idx_t EARLY_OUT_MULTIPLIER = 4;
+	//! We multiply the approximate alive nodes by this value to test whether our total dead nodes
+	//! exceed their allowed ratio. Must be greater than 1.
+	constexpr static idx_t ALIVE_NODE_MULTIPLIER = 4;
+
+	//! Total number of insertions into the eviction queue. This guides the schedule for calling PurgeQueue.
+	atomic<idx_t> evict_queue_insertions;
+	//! Total dead nodes in the eviction queue. There are two scenarios in which a node dies: (1) we destroy its block
+	//! handle, or (2) we insert a newer version into an eviction queue.
+	atomic<idx_t> total_dead_nodes;
+	//! Locked, if a queue purge is currently active or we're trying to forcefully evict a node.
+	//! Only lets a single thread enter the purge phase.
+	mutex purge_lock;
+	//! A pre-allocated vector of eviction nodes. We reuse this to keep the allocation overhead of purges small.
+	vector<BufferEvictionNode> purge_nodes;
 };
 
+bool EvictionQueue::AddToEvictionQueue(BufferEvictionNode &&node) {
+	q.enqueue(std::move(node));
+	return ++evict_queue_insertions % INSERT_INTERVAL == 0;
+}
+
+bool EvictionQueue::TryDequeueWithLock(BufferEvictionNode &node) {
+	lock_guard<mutex> lock(purge_lock);
+	return q.try_dequeue(node);
+}
+
 BufferEvictionNode::BufferEvictionNode(weak_ptr<BlockHandle> handle_p, idx_t eviction_seq_num)
     : handle(std::move(handle_p)), handle_sequence_number(eviction_seq_num) {
 	D_ASSERT(!handle.expired());
@@ -42,10 +103,15 @@ shared_ptr<BlockHandle> BufferEvictionNode::TryGetBlockHandle() {
 
 BufferPool::BufferPool(idx_t maximum_memory, bool track_eviction_timestamps)
     : current_memory(0), maximum_memory(maximum_memory), track_eviction_timestamps(track_eviction_timestamps),
-      queue(make_uniq<EvictionQueue>()), temporary_memory_manager(make_uniq<TemporaryMemoryManager>()),
-      evict_queue_insertions(0), total_dead_nodes(0) {
+      temporary_memory_manager(make_uniq<TemporaryMemoryManager>()) {
+	for (idx_t i = 0; i < EVICTION_QUEUE_TYPE_COUNT * EVICTION_QUEUE_SHARD_COUNT; i++) {
+		queues.push_back(make_uniq<EvictionQueue>());
+	}
 	for (idx_t i = 0; i < MEMORY_TAG_COUNT; i++) {
 		memory_usage_per_tag[i] = 0;
+		buffer_hits_per_tag[i] = 0;
+		buffer_loads_per_tag[i] = 0;
+		buffer_evictions_per_tag[i] = 0;
 	}
 }
 BufferPool::~BufferPool() {
@@ -65,18 +131,30 @@ bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
 		        .count();
 	}
 
-	BufferEvictionNode evict_node(weak_ptr<BlockHandle>(handle), ts);
-	queue->q.enqueue(evict_node);
-
 	if (ts != 1) {
 		// we add a newer version, i.e., we kill exactly one previous version
-		IncrementDeadNodes();
+		IncrementDeadNodes(*handle);
 	}
 
-	if (++evict_queue_insertions % INSERT_INTERVAL == 0) {
-		return true;
-	}
-	return false;
+	// blocks that were pinned again after being unpinned are considered hot: they are evicted last
+	auto queue_idx = GetEvictionQueueIndex(*handle);
+	handle->eviction_queue_idx = UnsafeNumericCast<uint8_t>(queue_idx);
+	BufferEvictionNode evict_node(weak_ptr<BlockHandle>(handle), ts);
+	return queues[queue_idx]->AddToEvictionQueue(std::move(evict_node));
+}
+
+EvictionQueueType BufferPool::GetEvictionQueueType(const BlockHandle &handle) {
+	return handle.resident_pins == 0 ? EvictionQueueType::PROBATIONARY : EvictionQueueType::FREQUENT;
+}
+
+idx_t BufferPool::GetEvictionQueueIndex(const BlockHandle &handle) {
+	// the shard only depends on the block, so all nodes of a block within a queue type end up in the same shard
+	auto shard = Hash(handle.block_id) % EVICTION_QUEUE_SHARD_COUNT;
+	return static_cast<uint8_t>(GetEvictionQueueType(handle)) * EVICTION_QUEUE_SHARD_COUNT + shard;
+}
+
+void BufferPool::IncrementDeadNodes(BlockHandle &handle) {
+	queues[handle.eviction_queue_idx]->IncrementDeadNodes();
 }
 
 void BufferPool::UpdateUsedMemory(MemoryTag tag, int64_t size) {
@@ -116,6 +194,7 @@ BufferPool::EvictionResult BufferPool::EvictBlocks(MemoryTag tag, idx_t extra_me
 
 	IterateUnloadableBlocks([&](BufferEvictionNode &, const shared_ptr<BlockHandle> &handle) {
 		// hooray, we can unload the block
+		buffer_evictions_per_tag[uint8_t(handle->tag)]++;
 		if (buffer && handle->buffer->AllocSize() == extra_memory) {
 			// we can re-use the memory directly
 			*buffer = handle->UnloadAndTakeBlock();
@@ -153,6 +232,7 @@ idx_t BufferPool::PurgeAgedBlocks(uint32_t max_age_sec) {
 		// block is younger than the age threshold.
 		bool is_fresh = handle->lru_timestamp_msec >= limit && handle->lru_timestamp_msec <= now;
 		purged_bytes += handle->GetMemoryUsage();
+		buffer_evictions_per_tag[uint8_t(handle->tag)]++;
 		handle->Unload();
 		return is_fresh;
 	});
@@ -161,44 +241,49 @@ idx_t BufferPool::PurgeAgedBlocks(uint32_t max_age_sec) {
 
 template <typename FN>
 void BufferPool::IterateUnloadableBlocks(FN fn) {
-	for (;;) {
-		// get a block to unpin from the queue
-		BufferEvictionNode node;
-		if (!queue->q.try_dequeue(node)) {
-			// we could not dequeue any eviction node, so we try one more time,
-			// but more aggressively
-			if (!TryDequeueWithLock(node)) {
-				return;
+	// we evict from the queue types in order: blocks that were only used once are evicted before frequently used blocks
+	// within a queue type, we dequeue from the shards round-robin to approximate a single LRU order
+	for (idx_t type_idx = 0; type_idx < EVICTION_QUEUE_TYPE_COUNT; type_idx++) {
+		bool dequeued = true;
+		while (dequeued) {
+			dequeued = false;
+			for (idx_t shard = 0; shard < EVICTION_QUEUE_SHARD_COUNT; shard++) {
+				auto &queue = *queues[type_idx * EVICTION_QUEUE_SHARD_COUNT + shard];
+				// get a block to unpin from the queue
+				BufferEvictionNode node;
+				if (!queue.q.try_dequeue(node)) {
+					// we could not dequeue any eviction node, so we try one more time,
+					// but more aggressively
+					if (!queue.TryDequeueWithLock(node)) {
+						continue;
+					}
+				}
+				dequeued = true;
+
+				// get a reference to the underlying block pointer
+				auto handle = node.TryGetBlockHandle();
+				if (!handle) {
+					queue.DecrementDeadNodes();
+					continue;
+				}
+
+				// we might be able to free this block: grab the mutex and check if we can free it
+				lock_guard<mutex> lock(handle->lock);
+				if (!node.CanUnload(*handle)) {
+					// something changed in the mean-time, bail out
+					queue.DecrementDeadNodes();
+					continue;
+				}
+
+				if (!fn(node, handle)) {
+					return;
+				}
 			}
 		}
-
-		// get a reference to the underlying block pointer
-		auto handle = node.TryGetBlockHandle();
-		if (!handle) {
-			DecrementDeadNodes();
-			continue;
-		}
-
-		// we might be able to free this block: grab the mutex and check if we can free it
-		lock_guard<mutex> lock(handle->lock);
-		if (!node.CanUnload(*handle)) {
-			// something changed in the mean-time, bail out
-			DecrementDeadNodes();
-			continue;
-		}
-
-		if (!fn(node, handle)) {
-			break;
-		}
 	}
 }
 
-bool BufferPool::TryDequeueWithLock(BufferEvictionNode &node) {
-	lock_guard<mutex> lock(purge_lock);
-	return queue->q.try_dequeue(node);
-}
-
-void BufferPool::PurgeIteration(const idx_t purge_size) {
+void EvictionQueue::PurgeIteration(const idx_t purge_size) {
 	// if this purge is significantly smaller or bigger than the previous purge, then
 	// we need to resize the purge_nodes vector. Note that this barely happens, as we
 	// purge queue_insertions * PURGE_SIZE_MULTIPLIER nodes
@@ -208,7 +293,7 @@ void BufferPool::PurgeIteration(const idx_t purge_size) {
 	}
 
 	// bulk purge
-	idx_t actually_dequeued = queue->q.try_dequeue_bulk(purge_nodes.begin(), purge_size);
+	idx_t actually_dequeued = q.try_dequeue_bulk(purge_nodes.begin(), purge_size);
 
 	// retrieve all alive nodes that have been wrongly dequeued
 	idx_t alive_nodes = 0;
@@ -216,7 +301,7 @@ void BufferPool::PurgeIteration(const idx_t purge_size) {
 		auto &node = purge_nodes[i];
 		auto handle = node.TryGetBlockHandle();
 		if (handle) {
-			queue->q.enqueue(std::move(node));
+			q.enqueue(std::move(node));
 			alive_nodes++;
 		}
 	}
@@ -225,7 +310,12 @@ void BufferPool::PurgeIteration(const idx_t purge_size) {
 }
 
 void BufferPool::PurgeQueue() {
+	for (auto &queue : queues) {
+		queue->Purge();
+	}
+}
 
+void EvictionQueue::Purge() {
 	// only one thread purges the queue, all other threads early-out
 	if (!purge_lock.try_lock()) {
 		return;
@@ -236,7 +326,7 @@ void BufferPool::PurgeQueue() {
 	idx_t purge_size = INSERT_INTERVAL * PURGE_SIZE_MULTIPLIER;
 
 	// get an estimate of the queue size as-of now
-	idx_t approx_q_size = queue->q.size_approx();
+	idx_t approx_q_size = q.size_approx();
 
 	// early-out, if the queue is not big enough to justify purging
 	// - we want to keep the LRU characteristic alive
@@ -266,7 +356,7 @@ void BufferPool::PurgeQueue() {
 		PurgeIteration(purge_size);
 
 		// update relevant sizes and potentially early-out
-		approx_q_size = queue->q.size_approx();
+		approx_q_size = q.size_approx();
 
 		// early-out according to (2.1)
 		if (approx_q_size < purge_size * EARLY_OUT_MULTIPLIER) {
@@ -3,6 +3,7 @@
 #include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/common/serializer/binary_serializer.hpp"
+#include "duckdb/storage/table/collection_checkpoint_state.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
 #include "duckdb/storage/table/table_statistics.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
@@ -17,8 +18,17 @@ TableDataWriter::~TableDataWriter() {
 }
 
 void TableDataWriter::WriteTableData(Serializer &metadata_serializer) {
+	auto checkpoint_state = ScheduleTableData();
+	WriteTableData(*checkpoint_state, metadata_serializer);
+}
+
+unique_ptr<CollectionCheckpointState> TableDataWriter::ScheduleTableData() {
 	// start scanning the table and append the data to the uncompressed segments
-	table.GetStorage().Checkpoint(*this, metadata_serializer);
+	return table.GetStorage().ScheduleCheckpoint(*this);
+}
+
+void TableDataWriter::WriteTableData(CollectionCheckpointState &checkpoint_state, Serializer &metadata_serializer) {
+	table.GetStorage().Checkpoint(*this, checkpoint_state, metadata_serializer);
 }
 
 CompressionType TableDataWriter::GetColumnCompressionType(idx_t i) {
@@ -18,6 +18,7 @@
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/connection.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parsed_data/create_schema_info.hpp"
 #include "duckdb/parser/parsed_data/create_view_info.hpp"
 #include "duckdb/planner/binder.hpp"
@@ -27,6 +28,7 @@
 #include "duckdb/storage/checkpoint/table_data_reader.hpp"
 #include "duckdb/storage/checkpoint/table_data_writer.hpp"
 #include "duckdb/storage/metadata/metadata_reader.hpp"
+#include "duckdb/storage/table/collection_checkpoint_state.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
 #include "duckdb/transaction/transaction_manager.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
@@ -35,12 +37,24 @@ namespace duckdb {
 
 void ReorderTableEntries(catalog_entry_vector_t &tables);
 
+//! The checkpoint of the data of a single table
+struct TableDataCheckpoint {
+	//! The checkpoint lock of the table - this prevents other threads from reading the table while it is written
+	unique_ptr<StorageLockKey> lock;
+	unique_ptr<TableDataWriter> writer;
+	//! The state of the tasks that write the row groups of the table to disk
+	unique_ptr<CollectionCheckpointState> checkpoint_state;
+};
+
 SingleFileCheckpointWriter::SingleFileCheckpointWriter(AttachedDatabase &db, BlockManager &block_manager,
                                                        CheckpointType checkpoint_type)
     : CheckpointWriter(db), partial_block_manager(block_manager, PartialBlockType::FULL_CHECKPOINT),
       checkpoint_type(checkpoint_type) {
 }
 
+SingleFileCheckpointWriter::~SingleFileCheckpointWriter() {
+}
+
 BlockManager &SingleFileCheckpointWriter::GetBlockManager() {
 	auto &storage_manager = db.GetStorageManager().Cast<SingleFileStorageManager>();
 	return *storage_manager.block_manager;
@@ -170,6 +184,21 @@ void SingleFileCheckpointWriter::CreateCheckpoint() {
 	    }
 	 */
 	auto catalog_entries = GetCatalogEntries(schemas);
+
+	// the row groups of a table are written to disk by tasks on the task scheduler
+	// in order to write multiple tables in parallel, we start these tasks ahead of writing the table metadata
+	idx_t total_rows = 0;
+	for (auto &entry : catalog_entries) {
+		if (entry.get().type != CatalogType::TABLE_ENTRY) {
+			continue;
+		}
+		auto &table = entry.get().Cast<TableCatalogEntry>();
+		total_rows += table.GetStorage().GetTotalRows();
+		tables.push_back(table);
+	}
+	table_checkpoints.resize(tables.size());
+	storage_manager.StartCheckpointProgress(total_rows);
+
 	SerializationOptions serialization_options;
 
 	serialization_options.serialization_compatibility = config.options.serialization_compatibility;
@@ -499,15 +528,56 @@ void SingleFileCheckpointWriter::WriteTable(TableCatalogEntry &table, Serializer
 	serializer.WriteProperty(100, "table", &table);
 
 	// Write the table data
-	auto table_lock = table.GetStorage().GetCheckpointLock();
-	if (auto writer = GetTableDataWriter(table)) {
-		writer->WriteTableData(serializer);
-	}
+	auto table_checkpoint = StartTableCheckpoint(table);
+	// start writing the row groups of the next tables while we wait for the row groups of this table
+	ScheduleTableCheckpoints();
+	table_checkpoint->writer->WriteTableData(*table_checkpoint->checkpoint_state, serializer);
 	// flush any partial blocks BEFORE releasing the table lock
 	// flushing partial blocks updates where data lives and is not thread-safe
 	partial_block_manager.FlushPartialBlocks();
 }
 
+unique_ptr<TableDataCheckpoint> SingleFileCheckpointWriter::StartTableCheckpoint(TableCatalogEntry &table) {
+	if (next_table_idx >= tables.size() || !RefersToSameObject(tables[next_table_idx].get(), table)) {
+		throw InternalException("Table \"%s\" is not written in catalog order during checkpoint", table.name);
+	}
+	auto table_idx = next_table_idx++;
+	next_scheduled_idx = MaxValue<idx_t>(next_scheduled_idx, next_table_idx);
+	if (table_checkpoints[table_idx]) {
+		// the row groups of the table are already being written
+		return std::move(table_checkpoints[table_idx]);
+	}
+	// the tables that are scheduled ahead of time always directly follow the table that is being written
+	// if this table was not scheduled, we are not holding the lock of any other table - so we can wait for it
+	auto result = make_uniq<TableDataCheckpoint>();
+	result->lock = table.GetStorage().GetCheckpointLock();
+	result->writer = GetTableDataWriter(table);
+	result->checkpoint_state = result->writer->ScheduleTableData();
+	return result;
+}
+
+void SingleFileCheckpointWriter::ScheduleTableCheckpoints() {
+	// we write at most one table per thread at the same time
+	auto &scheduler = TaskScheduler::GetScheduler(db.GetDatabase());
+	auto max_tables = NumericCast<idx_t>(scheduler.NumberOfThreads());
+	D_ASSERT(next_table_idx > 0);
+	auto current_table_idx = next_table_idx - 1;
+	while (next_scheduled_idx < tables.size() && next_scheduled_idx < current_table_idx + max_tables) {
+		auto &table = tables[next_scheduled_idx].get();
+		// we never wait for the lock of a table here: waiting while holding the locks of other tables might deadlock
+		// if the table is in use, it is written once we get to it instead
+		auto lock = table.GetStorage().TryGetCheckpointLock();
+		if (!lock) {
+			break;
+		}
+		auto table_checkpoint = make_uniq<TableDataCheckpoint>();
+		table_checkpoint->lock = std::move(lock);
+		table_checkpoint->writer = GetTableDataWriter(table);
+		table_checkpoint->checkpoint_state = table_checkpoint->writer->ScheduleTableData();
+		table_checkpoints[next_scheduled_idx++] = std::move(table_checkpoint);
+	}
+}
+
 void CheckpointReader::ReadTable(CatalogTransaction transaction, Deserializer &deserializer) {
 	// deserialize the table meta data
 	auto info = deserializer.ReadProperty<unique_ptr<CreateInfo>>(100, "table");
@@ -0,0 +1,670 @@
+#include "duckdb/common/bitpacking.hpp"
+#include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/function/compression_function.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/segment/uncompressed.hpp"
+#include "duckdb/storage/table/column_data_checkpointer.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+// Patched frame-of-reference (PFOR) compression, optionally on the deltas between consecutive values.
+//
+// Values are compressed in groups of PFOR_DELTA_GROUP_SIZE values. Every group subtracts a frame of reference from its
+// values (or from the deltas between its values) and bitpacks the result. Unlike regular bitpacking, the bit width is
+// not determined by the largest value: values that do not fit in the chosen width ("exceptions") are stored separately
+// and patched in after unpacking, so a few outliers do not widen the whole group.
+//
+// | header | group 0 | group 1 | ... | group n | group offsets (uint32_t) |
+//
+// A group is laid out as follows:
+//
+// | group header | frame of reference | delta start (DELTA only) | bitpacked values | exception positions (uint16_t) |
+// | exception values |
+static constexpr const idx_t PFOR_DELTA_GROUP_SIZE = 2048;
+
+enum class PForDeltaMode : uint8_t { FOR = 1, DELTA = 2 };
+
+typedef struct {
+	PForDeltaMode mode;
+	bitpacking_width_t width;
+	uint16_t exception_count;
+} pfor_delta_group_header_t;
+
+template <class T>
+struct PForDeltaGroup {
+	using T_U = typename MakeUnsigned<T>::type;
+
+	static constexpr const idx_t EXCEPTION_SIZE = sizeof(uint16_t) + sizeof(T);
+
+	static idx_t GetSize(PForDeltaMode mode, idx_t count, bitpacking_width_t width, idx_t exception_count) {
+		auto size = sizeof(pfor_delta_group_header_t) + sizeof(T);
+		if (mode == PForDeltaMode::DELTA) {
+			size += sizeof(T);
+		}
+		return size + BitpackingPrimitives::GetRequiredSize(count, width) + exception_count * EXCEPTION_SIZE;
+	}
+
+	explicit PForDeltaGroup(data_ptr_t ptr) {
+		auto header = Load<pfor_delta_group_header_t>(ptr);
+		mode = header.mode;
+		width = header.width;
+		exception_count = header.exception_count;
+		ptr += sizeof(pfor_delta_group_header_t);
+		frame_of_reference = Load<T_U>(ptr);
+		ptr += sizeof(T);
+		delta_start = 0;
+		if (mode == PForDeltaMode::DELTA) {
+			delta_start = Load<T_U>(ptr);
+			ptr += sizeof(T);
+		}
+		packed_ptr = ptr;
+	}
+
+	PForDeltaMode mode;
+	bitpacking_width_t width;
+	idx_t exception_count;
+	T_U frame_of_reference;
+	T_U delta_start;
+	data_ptr_t packed_ptr;
+
+public:
+	data_ptr_t GetExceptionPositions(idx_t count) const {
+		return packed_ptr + BitpackingPrimitives::GetRequiredSize(count, width);
+	}
+	data_ptr_t GetExceptionValues(idx_t count) const {
+		return GetExceptionPositions(count) + exception_count * sizeof(uint16_t);
+	}
+
+	//! Decodes the first "decode_count" values of a group of "count" values. The target must have space for
+	//! decode_count values rounded up to the bitpacking algorithm group size.
+	void Decode(T_U *target, idx_t count, idx_t decode_count) const {
+		auto unpack_count = BitpackingPrimitives::RoundUpToAlgorithmGroupSize(decode_count);
+		BitpackingPrimitives::UnPackBuffer<T_U>(data_ptr_cast(target), packed_ptr, unpack_count, width, true);
+
+		// patch the exceptions, they are sorted by their position
+		auto positions = GetExceptionPositions(count);
+		auto values = GetExceptionValues(count);
+		for (idx_t i = 0; i < exception_count; i++) {
+			auto position = Load<uint16_t>(positions + i * sizeof(uint16_t));
+			if (position >= unpack_count) {
+				break;
+			}
+			target[position] = Load<T_U>(values + i * sizeof(T));
+		}
+
+		// add the frame of reference (intentionally wrapping)
+		for (idx_t i = 0; i < unpack_count; i++) {
+			target[i] += frame_of_reference;
+		}
+		if (mode == PForDeltaMode::DELTA) {
+			target[0] += delta_start;
+			for (idx_t i = 1; i < decode_count; i++) {
+				target[i] += target[i - 1];
+			}
+		}
+	}
+
+	//! Decodes a single value of a FOR group without decoding the values before it
+	T_U DecodeValue(idx_t count, idx_t index) const {
+		D_ASSERT(mode == PForDeltaMode::FOR);
+		// binary search the exceptions
+		auto positions = GetExceptionPositions(count);
+		idx_t lower = 0;
+		idx_t upper = exception_count;
+		while (lower < upper) {
+			auto middle = (lower + upper) / 2;
+			auto position = Load<uint16_t>(positions + middle * sizeof(uint16_t));
+			if (position == index) {
+				return Load<T_U>(GetExceptionValues(count) + middle * sizeof(T)) + frame_of_reference;
+			}
+			if (position < index) {
+				lower = middle + 1;
+			} else {
+				upper = middle;
+			}
+		}
+		// unpack the algorithm group that contains the value
+		T_U buffer[BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE];
+		auto offset_in_group = index % BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE;
+		auto group_start = index - offset_in_group;
+		BitpackingPrimitives::UnPackBlock<T_U>(data_ptr_cast(buffer), packed_ptr + (group_start * width) / 8, width,
+		                                       true);
+		return buffer[offset_in_group] + frame_of_reference;
+	}
+};
+
+//===--------------------------------------------------------------------===//
+// Encoder
+//===--------------------------------------------------------------------===//
+template <class T>
+struct PForDeltaEncoder {
+	using T_U = typename MakeUnsigned<T>::type;
+	using T_S = typename MakeSigned<T>::type;
+
+	PForDeltaEncoder() {
+		Reset();
+	}
+
+	T_U values[PFOR_DELTA_GROUP_SIZE];
+	bool validity[PFOR_DELTA_GROUP_SIZE];
+	idx_t count;
+
+	// Statistics of the current group
+	T minimum;
+	T maximum;
+	bool all_invalid;
+
+	// The plan for the current group, determined by Plan()
+	PForDeltaMode mode;
+	bitpacking_width_t width;
+	T_U frame_of_reference;
+	idx_t exception_count;
+
+	// Scratch buffers
+	T_U residuals[PFOR_DELTA_GROUP_SIZE];
+	T_U sort_buffer[PFOR_DELTA_GROUP_SIZE];
+
+public:
+	void Reset() {
+		count = 0;
+		minimum = NumericLimits<T>::Maximum();
+		maximum = NumericLimits<T>::Minimum();
+		all_invalid = true;
+	}
+
+	bool IsFull() const {
+		return count == PFOR_DELTA_GROUP_SIZE;
+	}
+
+	void Append(T value, bool is_valid) {
+		D_ASSERT(!IsFull());
+		validity[count] = is_valid;
+		if (is_valid) {
+			values[count] = static_cast<T_U>(value);
+			minimum = MinValue<T>(minimum, value);
+			maximum = MaxValue<T>(maximum, value);
+			all_invalid = false;
+		}
+		count++;
+	}
+
+	//! Determines how to encode the current group, and returns the size of the encoded group
+	idx_t Plan() {
+		D_ASSERT(count > 0);
+		FillInvalidValues();
+
+		// frame of reference on the values
+		T_U for_reference;
+		bitpacking_width_t for_width;
+		idx_t for_exceptions;
+		FindFrame<T>(values, count, for_reference, for_width, for_exceptions);
+		auto for_size = PForDeltaGroup<T>::GetSize(PForDeltaMode::FOR, count, for_width, for_exceptions);
+
+		mode = PForDeltaMode::FOR;
+		width = for_width;
+		frame_of_reference = for_reference;
+		exception_count = for_exceptions;
+		if (count < 2) {
+			return for_size;
+		}
+
+		// frame of reference on the deltas, the first value is encoded by the delta start
+		for (idx_t i = 1; i < count; i++) {
+			residuals[i] = values[i] - values[i - 1];
+		}
+		T_U delta_reference;
+		bitpacking_width_t delta_width;
+		idx_t delta_exceptions;
+		FindFrame<T_S>(residuals + 1, count - 1, delta_reference, delta_width, delta_exceptions);
+		auto delta_size = PForDeltaGroup<T>::GetSize(PForDeltaMode::DELTA, count, delta_width, delta_exceptions);
+		if (delta_size < for_size) {
+			mode = PForDeltaMode::DELTA;
+			width = delta_width;
+			frame_of_reference = delta_reference;
+			exception_count = delta_exceptions;
+			return delta_size;
+		}
+		return for_size;
+	}
+
+	//! Writes the current group according to the plan
+	void Write(data_ptr_t ptr) {
+		// compute the residuals
+		T_U delta_start = 0;
+		if (mode == PForDeltaMode::FOR) {
+			for (idx_t i = 0; i < count; i++) {
+				residuals[i] = values[i] - frame_of_reference;
+			}
+		} else {
+			for (idx_t i = count - 1; i > 0; i--) {
+				residuals[i] = (values[i] - values[i - 1]) - frame_of_reference;
+			}
+			// the first residual is zero: the first value is "delta start + frame of reference"
+			residuals[0] = 0;
+			delta_start = values[0] - frame_of_reference;
+		}
+
+		pfor_delta_group_header_t header;
+		header.mode = mode;
+		header.width = width;
+		header.exception_count = UnsafeNumericCast<uint16_t>(exception_count);
+		Store<pfor_delta_group_header_t>(header, ptr);
+		ptr += sizeof(pfor_delta_group_header_t);
+		Store<T_U>(frame_of_reference, ptr);
+		ptr += sizeof(T);
+		if (mode == PForDeltaMode::DELTA) {
+			Store<T_U>(delta_start, ptr);
+			ptr += sizeof(T);
+		}
+
+		// extract the exceptions - they are replaced by zero in the bitpacked values
+		auto exception_positions = ptr + BitpackingPrimitives::GetRequiredSize(count, width);
+		auto exception_values = exception_positions + exception_count * sizeof(uint16_t);
+		if (width < sizeof(T) * 8) {
+			T_U max_residual = (T_U(1) << width) - 1;
+			idx_t exception_idx = 0;
+			for (idx_t i = 0; i < count; i++) {
+				if (residuals[i] <= max_residual) {
+					continue;
+				}
+				D_ASSERT(exception_idx < exception_count);
+				Store<uint16_t>(UnsafeNumericCast<uint16_t>(i), exception_positions + exception_idx * sizeof(uint16_t));
+				Store<T_U>(residuals[i], exception_values + exception_idx * sizeof(T));
+				residuals[i] = 0;
+				exception_idx++;
+			}
+			D_ASSERT(exception_idx == exception_count);
+		}
+		BitpackingPrimitives::PackBuffer<T_U, false>(ptr, residuals, count, width);
+	}
+
+private:
+	void FillInvalidValues() {
+		// invalid values take the value of the previous valid value, so they never become exceptions
+		idx_t first_valid = 0;
+		while (first_valid < count && !validity[first_valid]) {
+			first_valid++;
+		}
+		T_U previous = first_valid < count ? values[first_valid] : 0;
+		for (idx_t i = 0; i < count; i++) {
+			if (validity[i]) {
+				previous = values[i];
+			} else {
+				values[i] = previous;
+			}
+		}
+	}
+
+	//! Finds the frame of reference and bit width that minimize the encoded size of the input. Values that do not fit
+	//! in [frame_of_reference, frame_of_reference + 2^width) become exceptions. T_ORDER determines how the values are
+	//! ordered, which only affects how well they are compressed.
+	template <class T_ORDER>
+	void FindFrame(const T_U *input, idx_t input_count, T_U &result_reference, bitpacking_width_t &result_width,
+	               idx_t &result_exceptions) {
+		memcpy(sort_buffer, input, input_count * sizeof(T_U));
+		auto sorted = reinterpret_cast<T_ORDER *>(sort_buffer);
+		std::sort(sorted, sorted + input_count);
+
+		// storing all values without exceptions is always possible
+		auto range = static_cast<T_U>(static_cast<T_U>(sorted[input_count - 1]) - static_cast<T_U>(sorted[0]));
+		auto max_width = BitpackingPrimitives::MinimumBitWidth<T_U, false>(range);
+		result_reference = static_cast<T_U>(sorted[0]);
+		result_width = max_width;
+		result_exceptions = 0;
+		auto best_size = BitpackingPrimitives::GetRequiredSize(input_count, max_width);
+
+		for (bitpacking_width_t candidate_width = 0; candidate_width < max_width; candidate_width++) {
+			if (BitpackingPrimitives::GetRequiredSize(input_count, candidate_width) >= best_size) {
+				// narrower widths are only worth it if they save more than the exceptions cost
+				break;
+			}
+			// find the window of 2^width values that contains the most values
+			T_U max_difference = (T_U(1) << candidate_width) - 1;
+			idx_t window_count = 0;
+			idx_t window_start = 0;
+			idx_t end = 0;
+			for (idx_t start = 0; start < input_count; start++) {
+				end = MaxValue(end, start);
+				while (end + 1 < input_count &&
+				       static_cast<T_U>(static_cast<T_U>(sorted[end + 1]) - static_cast<T_U>(sorted[start])) <=
+				           max_difference) {
+					end++;
+				}
+				if (end - start + 1 > window_count) {
+					window_count = end - start + 1;
+					window_start = start;
+				}
+			}
+			auto exceptions = input_count - window_count;
+			auto size = BitpackingPrimitives::GetRequiredSize(input_count, candidate_width) +
+			            exceptions * PForDeltaGroup<T>::EXCEPTION_SIZE;
+			if (exceptions < PFOR_DELTA_GROUP_SIZE && size < best_size) {
+				best_size = size;
+				result_reference = static_cast<T_U>(sorted[window_start]);
+				result_width = candidate_width;
+				result_exceptions = exceptions;
+			}
+		}
+	}
+};
+
+//===--------------------------------------------------------------------===//
+// Analyze
+//===--------------------------------------------------------------------===//
+template <class T>
+struct PForDeltaAnalyzeState : public AnalyzeState {
+	PForDeltaAnalyzeState() : total_size(BitpackingPrimitives::BITPACKING_HEADER_SIZE) {
+	}
+
+	PForDeltaEncoder<T> encoder;
+	idx_t total_size;
+
+public:
+	void FlushGroup() {
+		if (encoder.count == 0) {
+			return;
+		}
+		total_size += AlignValue(encoder.Plan()) + sizeof(uint32_t);
+		encoder.Reset();
+	}
+};
+
+template <class T>
+unique_ptr<AnalyzeState> PForDeltaInitAnalyze(ColumnData &col_data, PhysicalType type) {
+	return make_uniq<PForDeltaAnalyzeState<T>>();
+}
+
+template <class T>
+bool PForDeltaAnalyze(AnalyzeState &state_p, Vector &input, idx_t count) {
+	auto &state = state_p.Cast<PForDeltaAnalyzeState<T>>();
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		state.encoder.Append(data[idx], vdata.validity.RowIsValid(idx));
+		if (state.encoder.IsFull()) {
+			state.FlushGroup();
+		}
+	}
+	return true;
+}
+
+template <class T>
+idx_t PForDeltaFinalAnalyze(AnalyzeState &state_p) {
+	auto &state = state_p.Cast<PForDeltaAnalyzeState<T>>();
+	state.FlushGroup();
+	return state.total_size;
+}
+
+//===--------------------------------------------------------------------===//
+// Compress
+//===--------------------------------------------------------------------===//
+template <class T>
+struct PForDeltaCompressState : public CompressionState {
+public:
+	explicit PForDeltaCompressState(ColumnDataCheckpointer &checkpointer)
+	    : checkpointer(checkpointer),
+	      function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_PFOR_DELTA)) {
+		CreateEmptySegment(checkpointer.GetRowGroup().start);
+	}
+
+	ColumnDataCheckpointer &checkpointer;
+	CompressionFunction &function;
+	unique_ptr<ColumnSegment> current_segment;
+	BufferHandle handle;
+
+	//! The offset of the next group in the segment
+	idx_t data_offset;
+	//! The offsets of the groups in the current segment
+	vector<uint32_t> group_offsets;
+
+	PForDeltaEncoder<T> encoder;
+
+public:
+	void CreateEmptySegment(idx_t row_start) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+		current_segment = ColumnSegment::CreateTransientSegment(db, type, row_start);
+		current_segment->function = function;
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		handle = buffer_manager.Pin(current_segment->block);
+
+		data_offset = BitpackingPrimitives::BITPACKING_HEADER_SIZE;
+		group_offsets.clear();
+	}
+
+	bool CanStore(idx_t group_size) {
+		auto metadata_size = (group_offsets.size() + 1) * sizeof(uint32_t);
+		return AlignValue(data_offset + group_size) + metadata_size <= Storage::BLOCK_SIZE;
+	}
+
+	void Append(UnifiedVectorFormat &vdata, idx_t count) {
+		auto data = UnifiedVectorFormat::GetData<T>(vdata);
+		for (idx_t i = 0; i < count; i++) {
+			auto idx = vdata.sel->get_index(i);
+			encoder.Append(data[idx], vdata.validity.RowIsValid(idx));
+			if (encoder.IsFull()) {
+				FlushGroup();
+			}
+		}
+	}
+
+	void FlushGroup() {
+		if (encoder.count == 0) {
+			return;
+		}
+		auto group_size = encoder.Plan();
+		if (!CanStore(group_size)) {
+			auto row_start = current_segment->start + current_segment->count;
+			FlushSegment();
+			CreateEmptySegment(row_start);
+			if (!CanStore(group_size)) {
+				throw InternalException("PFOR compression failed due to insufficient space in empty block");
+			}
+		}
+		encoder.Write(handle.Ptr() + data_offset);
+		group_offsets.push_back(UnsafeNumericCast<uint32_t>(data_offset));
+		data_offset = AlignValue(data_offset + group_size);
+
+		current_segment->count += encoder.count;
+		if (!encoder.all_invalid) {
+			NumericStats::Update<T>(current_segment->stats.statistics, encoder.minimum);
+			NumericStats::Update<T>(current_segment->stats.statistics, encoder.maximum);
+		}
+		encoder.Reset();
+	}
+
+	void FlushSegment() {
+		auto &state = checkpointer.GetCheckpointState();
+		auto base_ptr = handle.Ptr();
+
+		// write the group offsets after the groups
+		auto metadata_offset = data_offset;
+		memcpy(base_ptr + metadata_offset, group_offsets.data(), group_offsets.size() * sizeof(uint32_t));
+		auto total_segment_size = metadata_offset + group_offsets.size() * sizeof(uint32_t);
+		Store<idx_t>(metadata_offset, base_ptr);
+		handle.Destroy();
+
+		state.FlushSegment(std::move(current_segment), total_segment_size);
+	}
+
+	void Finalize() {
+		FlushGroup();
+		FlushSegment();
+		current_segment.reset();
+	}
+};
+
+template <class T>
+unique_ptr<CompressionState> PForDeltaInitCompression(ColumnDataCheckpointer &checkpointer,
+                                                      unique_ptr<AnalyzeState> state) {
+	return make_uniq<PForDeltaCompressState<T>>(checkpointer);
+}
+
+template <class T>
+void PForDeltaCompress(CompressionState &state_p, Vector &scan_vector, idx_t count) {
+	auto &state = state_p.Cast<PForDeltaCompressState<T>>();
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	state.Append(vdata, count);
+}
+
+template <class T>
+void PForDeltaFinalizeCompress(CompressionState &state_p) {
+	auto &state = state_p.Cast<PForDeltaCompressState<T>>();
+	state.Finalize();
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+static data_ptr_t PForDeltaGetGroupPointer(data_ptr_t base_ptr, idx_t group_idx) {
+	auto metadata_offset = Load<idx_t>(base_ptr);
+	auto group_offset = Load<uint32_t>(base_ptr + metadata_offset + group_idx * sizeof(uint32_t));
+	return base_ptr + group_offset;
+}
+
+static idx_t PForDeltaGetGroupCount(ColumnSegment &segment, idx_t group_idx) {
+	return MinValue<idx_t>(PFOR_DELTA_GROUP_SIZE, segment.count - group_idx * PFOR_DELTA_GROUP_SIZE);
+}
+
+template <class T>
+struct PForDeltaScanState : public SegmentScanState {
+	using T_U = typename MakeUnsigned<T>::type;
+
+	explicit PForDeltaScanState(ColumnSegment &segment) : current_group(DConstants::INVALID_INDEX) {
+		auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+		handle = buffer_manager.Pin(segment.block);
+		base_ptr = handle.Ptr() + segment.GetBlockOffset();
+	}
+
+	BufferHandle handle;
+	data_ptr_t base_ptr;
+	//! The currently decoded group
+	idx_t current_group;
+	T_U decoded[PFOR_DELTA_GROUP_SIZE];
+
+public:
+	void LoadGroup(ColumnSegment &segment, idx_t group_idx) {
+		PForDeltaGroup<T> group(PForDeltaGetGroupPointer(base_ptr, group_idx));
+		auto count = PForDeltaGetGroupCount(segment, group_idx);
+		group.Decode(decoded, count, count);
+		current_group = group_idx;
+	}
+};
+
+template <class T>
+unique_ptr<SegmentScanState> PForDeltaInitScan(ColumnSegment &segment) {
+	return make_uniq<PForDeltaScanState<T>>(segment);
+}
+
+template <class T>
+void PForDeltaScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                          idx_t result_offset) {
+	auto &scan_state = state.scan_state->Cast<PForDeltaScanState<T>>();
+	auto start = segment.GetRelativeIndex(state.row_index);
+
+	auto result_data = FlatVector::GetData<T>(result);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+
+	idx_t scanned = 0;
+	while (scanned < scan_count) {
+		auto row = start + scanned;
+		auto group_idx = row / PFOR_DELTA_GROUP_SIZE;
+		if (group_idx != scan_state.current_group) {
+			scan_state.LoadGroup(segment, group_idx);
+		}
+		auto offset_in_group = row % PFOR_DELTA_GROUP_SIZE;
+		auto to_scan = MinValue<idx_t>(scan_count - scanned, PFOR_DELTA_GROUP_SIZE - offset_in_group);
+		memcpy(result_data + result_offset + scanned, scan_state.decoded + offset_in_group, to_scan * sizeof(T));
+		scanned += to_scan;
+	}
+}
+
+template <class T>
+void PForDeltaScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	PForDeltaScanPartial<T>(segment, state, scan_count, result, 0);
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+template <class T>
+void PForDeltaFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+                       idx_t result_idx) {
+	using T_U = typename MakeUnsigned<T>::type;
+
+	auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+	auto handle = buffer_manager.Pin(segment.block);
+	auto base_ptr = handle.Ptr() + segment.GetBlockOffset();
+
+	auto row = UnsafeNumericCast<idx_t>(row_id);
+	auto group_idx = row / PFOR_DELTA_GROUP_SIZE;
+	auto offset_in_group = row % PFOR_DELTA_GROUP_SIZE;
+	auto count = PForDeltaGetGroupCount(segment, group_idx);
+	PForDeltaGroup<T> group(PForDeltaGetGroupPointer(base_ptr, group_idx));
+
+	auto result_data = FlatVector::GetData<T>(result);
+	if (group.mode == PForDeltaMode::FOR) {
+		result_data[result_idx] = static_cast<T>(group.DecodeValue(count, offset_in_group));
+		return;
+	}
+	// deltas have to be decoded up to the row
+	T_U decoded[PFOR_DELTA_GROUP_SIZE];
+	group.Decode(decoded, count, offset_in_group + 1);
+	result_data[result_idx] = static_cast<T>(decoded[offset_in_group]);
+}
+
+//===--------------------------------------------------------------------===//
+// Get Function
+//===--------------------------------------------------------------------===//
+template <class T>
+CompressionFunction GetPForDeltaFunction(PhysicalType data_type) {
+	return CompressionFunction(CompressionType::COMPRESSION_PFOR_DELTA, data_type, PForDeltaInitAnalyze<T>,
+	                           PForDeltaAnalyze<T>, PForDeltaFinalAnalyze<T>, PForDeltaInitCompression<T>,
+	                           PForDeltaCompress<T>, PForDeltaFinalizeCompress<T>, PForDeltaInitScan<T>,
+	                           PForDeltaScan<T>, PForDeltaScanPartial<T>, PForDeltaFetchRow<T>,
+	                           UncompressedFunctions::EmptySkip);
+}
+
+CompressionFunction PForDeltaFun::GetFunction(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::INT16:
+		return GetPForDeltaFunction<int16_t>(type);
+	case PhysicalType::INT32:
+		return GetPForDeltaFunction<int32_t>(type);
+	case PhysicalType::INT64:
+		return GetPForDeltaFunction<int64_t>(type);
+	case PhysicalType::UINT16:
+		return GetPForDeltaFunction<uint16_t>(type);
+	case PhysicalType::UINT32:
+		return GetPForDeltaFunction<uint32_t>(type);
+	case PhysicalType::UINT64:
+		return GetPForDeltaFunction<uint64_t>(type);
+	default:
+		throw InternalException("Unsupported type for PFOR");
+	}
+}
+
+bool PForDeltaFun::TypeIsSupported(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+		return true;
+	default:
+		return false;
+	}
+}
+
+} // namespace duckdb
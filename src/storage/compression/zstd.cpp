@@ -0,0 +1,556 @@
+#include "duckdb/common/allocator.hpp"
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/storage/string_uncompressed.hpp"
+#include "duckdb/storage/table/column_data_checkpointer.hpp"
+#include "duckdb/common/random_engine.hpp"
+#include "zstd.h"
+
+namespace duckdb {
+
+// A ZSTD segment consists of a header, followed by a number of independently compressed vectors and the metadata of
+// these vectors. Every vector holds (at most) ZSTD_VECTOR_SIZE strings, which allows fetching a single row by only
+// decompressing the vector that it is in.
+//
+// | header | vector 0 | vector 1 | ... | vector n | metadata 0 | metadata 1 | ... | metadata n |
+//
+// A decompressed vector stores the string data of all strings, followed by the lengths of the strings:
+//
+// | string 0 | string 1 | ... | string n | length 0 (uint32_t) | ... | length n (uint32_t) |
+typedef struct {
+	uint32_t vector_count;
+	uint32_t metadata_offset;
+} zstd_compression_header_t;
+
+typedef struct {
+	//! The first row of the vector (relative to the start of the segment)
+	uint32_t row_start;
+	uint32_t compressed_offset;
+	uint32_t compressed_size;
+	uint32_t uncompressed_size;
+} zstd_vector_metadata_t;
+
+struct ZSTDStorage {
+	//! The (maximum) amount of strings in a vector
+	static constexpr idx_t ZSTD_VECTOR_SIZE = STANDARD_VECTOR_SIZE;
+	//! The maximum size of an uncompressed vector - this ensures a compressed vector always fits in an empty block
+	static constexpr idx_t MAX_UNCOMPRESSED_VECTOR_SIZE = Storage::BLOCK_SIZE / 2;
+	//! The maximum size of a single string
+	static constexpr idx_t MAX_STRING_SIZE = MAX_UNCOMPRESSED_VECTOR_SIZE - sizeof(uint32_t);
+	static constexpr int COMPRESSION_LEVEL = 3;
+	static constexpr double MINIMUM_COMPRESSION_RATIO = 1.5;
+	//! Short strings are better served by dictionary and FSST compression, which do not need to decompress a vector
+	//! to fetch a single string - ZSTD is only considered for longer strings (unless it is forced)
+	static constexpr idx_t MINIMUM_AVERAGE_STRING_SIZE = 32;
+	static constexpr double ANALYSIS_SAMPLE_SIZE = 0.25;
+
+	static unique_ptr<AnalyzeState> StringInitAnalyze(ColumnData &col_data, PhysicalType type);
+	static bool StringAnalyze(AnalyzeState &state_p, Vector &input, idx_t count);
+	static idx_t StringFinalAnalyze(AnalyzeState &state_p);
+
+	static unique_ptr<CompressionState> InitCompression(ColumnDataCheckpointer &checkpointer,
+	                                                    unique_ptr<AnalyzeState> analyze_state_p);
+	static void Compress(CompressionState &state_p, Vector &scan_vector, idx_t count);
+	static void FinalizeCompress(CompressionState &state_p);
+
+	static unique_ptr<SegmentScanState> StringInitScan(ColumnSegment &segment);
+	static void StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+	                              idx_t result_offset);
+	static void StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result);
+	static void StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+	                           idx_t result_idx);
+
+	static zstd_vector_metadata_t GetVectorMetadata(data_ptr_t base_ptr, idx_t vector_idx);
+	static idx_t FindVector(data_ptr_t base_ptr, idx_t row);
+	static idx_t GetVectorCount(ColumnSegment &segment, data_ptr_t base_ptr, idx_t vector_idx,
+	                            const zstd_vector_metadata_t &metadata);
+	//! Throws if the string lengths of a vector with vector_count strings do not fit in its uncompressed size
+	static void VerifyVectorCount(const zstd_vector_metadata_t &metadata, idx_t vector_count);
+	//! Decompresses a vector into the target buffer - the context can be omitted for one-off decompression
+	static void DecompressVector(duckdb_zstd::ZSTD_DCtx *context, data_ptr_t base_ptr,
+	                             const zstd_vector_metadata_t &metadata, data_ptr_t target);
+};
+
+//===--------------------------------------------------------------------===//
+// Analyze
+//===--------------------------------------------------------------------===//
+struct ZSTDAnalyzeState : public AnalyzeState {
+	ZSTDAnalyzeState()
+	    : count(0), string_count(0), total_string_size(0), sample_uncompressed_size(0), sample_compressed_size(0) {
+		context = duckdb_zstd::ZSTD_createCCtx();
+	}
+	~ZSTDAnalyzeState() override {
+		duckdb_zstd::ZSTD_freeCCtx(context);
+	}
+
+	duckdb_zstd::ZSTD_CCtx *context;
+	idx_t count;
+	idx_t string_count;
+	idx_t total_string_size;
+
+	idx_t sample_uncompressed_size;
+	idx_t sample_compressed_size;
+	//! Buffers used to compress the sampled vectors
+	vector<char> sample_buffer;
+	vector<char> compressed_buffer;
+
+	RandomEngine random_engine;
+};
+
+unique_ptr<AnalyzeState> ZSTDStorage::StringInitAnalyze(ColumnData &col_data, PhysicalType type) {
+	return make_uniq<ZSTDAnalyzeState>();
+}
+
+bool ZSTDStorage::StringAnalyze(AnalyzeState &state_p, Vector &input, idx_t count) {
+	auto &state = state_p.Cast<ZSTDAnalyzeState>();
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+
+	// always sample the first vector that contains strings, so we never end up with an empty sample
+	bool sample_selected =
+	    state.sample_uncompressed_size == 0 || state.random_engine.NextRandom() < ANALYSIS_SAMPLE_SIZE;
+	if (sample_selected) {
+		state.sample_buffer.clear();
+	}
+	state.count += count;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			continue;
+		}
+		// we need to check all strings for this, otherwise we run into trouble during compression
+		auto string_size = data[idx].GetSize();
+		if (string_size > MAX_STRING_SIZE) {
+			return false;
+		}
+		state.string_count++;
+		state.total_string_size += string_size;
+		if (sample_selected) {
+			auto string_data = data[idx].GetData();
+			state.sample_buffer.insert(state.sample_buffer.end(), string_data, string_data + string_size);
+		}
+	}
+	if (!sample_selected || state.sample_buffer.empty()) {
+		return true;
+	}
+	// compress the sampled strings to estimate the compression ratio
+	state.compressed_buffer.resize(duckdb_zstd::ZSTD_compressBound(state.sample_buffer.size()));
+	auto compressed_size =
+	    duckdb_zstd::ZSTD_compressCCtx(state.context, state.compressed_buffer.data(), state.compressed_buffer.size(),
+	                                   state.sample_buffer.data(), state.sample_buffer.size(), COMPRESSION_LEVEL);
+	if (duckdb_zstd::ZSTD_isError(compressed_size)) {
+		return false;
+	}
+	state.sample_uncompressed_size += state.sample_buffer.size();
+	state.sample_compressed_size += compressed_size;
+	return true;
+}
+
+idx_t ZSTDStorage::StringFinalAnalyze(AnalyzeState &state_p) {
+	auto &state = state_p.Cast<ZSTDAnalyzeState>();
+	if (state.sample_uncompressed_size == 0) {
+		// only NULL values or empty strings
+		return DConstants::INVALID_INDEX;
+	}
+	// the string lengths are stored (and compressed) alongside the strings
+	auto compression_ratio = double(state.sample_compressed_size) / double(state.sample_uncompressed_size);
+	auto estimated_string_size = double(state.total_string_size) * compression_ratio;
+	auto estimated_length_size = double(state.count * sizeof(uint32_t)) * compression_ratio;
+	auto vector_count = (state.count + ZSTD_VECTOR_SIZE - 1) / ZSTD_VECTOR_SIZE;
+	auto estimated_size = estimated_string_size + estimated_length_size +
+	                      double(vector_count * sizeof(zstd_vector_metadata_t) + sizeof(zstd_compression_header_t));
+
+	auto average_string_size = state.total_string_size / state.string_count;
+	if (average_string_size < MINIMUM_AVERAGE_STRING_SIZE) {
+		// never prefer ZSTD over storing the strings uncompressed
+		return (state.total_string_size + state.count * sizeof(uint32_t)) * 2;
+	}
+	return NumericCast<idx_t>(estimated_size * MINIMUM_COMPRESSION_RATIO);
+}
+
+//===--------------------------------------------------------------------===//
+// Compress
+//===--------------------------------------------------------------------===//
+class ZSTDCompressionState : public CompressionState {
+public:
+	explicit ZSTDCompressionState(ColumnDataCheckpointer &checkpointer)
+	    : checkpointer(checkpointer), function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_ZSTD)),
+	      vector_stats(StringStats::CreateEmpty(checkpointer.GetType())), string_size(0) {
+		auto &allocator = Allocator::Get(checkpointer.GetDatabase());
+		context = duckdb_zstd::ZSTD_createCCtx();
+		uncompressed_buffer = allocator.Allocate(ZSTDStorage::MAX_UNCOMPRESSED_VECTOR_SIZE);
+		compressed_buffer =
+		    allocator.Allocate(duckdb_zstd::ZSTD_compressBound(ZSTDStorage::MAX_UNCOMPRESSED_VECTOR_SIZE));
+		CreateEmptySegment(checkpointer.GetRowGroup().start);
+	}
+
+	~ZSTDCompressionState() override {
+		duckdb_zstd::ZSTD_freeCCtx(context);
+	}
+
+	void CreateEmptySegment(idx_t row_start) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+		current_segment = ColumnSegment::CreateTransientSegment(db, type, row_start);
+		current_segment->function = function;
+
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		current_handle = buffer_manager.Pin(current_segment->block);
+		current_offset = sizeof(zstd_compression_header_t);
+		vector_metadata.clear();
+	}
+
+	//! Whether a string of the given size (and its length entry) still fits in the current vector
+	bool FitsInVector(idx_t size) const {
+		if (string_lengths.size() >= ZSTDStorage::ZSTD_VECTOR_SIZE) {
+			return false;
+		}
+		auto lengths_size = (string_lengths.size() + 1) * sizeof(uint32_t);
+		return string_size + lengths_size + size <= ZSTDStorage::MAX_UNCOMPRESSED_VECTOR_SIZE;
+	}
+
+	void AddString(const string_t &str) {
+		auto size = str.GetSize();
+		if (!FitsInVector(size)) {
+			FlushVector();
+		}
+		memcpy(uncompressed_buffer.get() + string_size, str.GetData(), size);
+		string_size += size;
+		string_lengths.push_back(UnsafeNumericCast<uint32_t>(size));
+		StringStats::Update(vector_stats, str);
+	}
+
+	void AddNull() {
+		// a NULL does not add string data, but it does add a length entry
+		if (!FitsInVector(0)) {
+			FlushVector();
+		}
+		string_lengths.push_back(0);
+	}
+
+	bool HasEnoughSpace(idx_t compressed_size) {
+		auto metadata_size = (vector_metadata.size() + 1) * sizeof(zstd_vector_metadata_t);
+		return current_offset + compressed_size + metadata_size <= Storage::BLOCK_SIZE;
+	}
+
+	void FlushVector() {
+		if (string_lengths.empty()) {
+			return;
+		}
+		// the lengths of the strings are stored after the string data
+		auto lengths_size = string_lengths.size() * sizeof(uint32_t);
+		memcpy(uncompressed_buffer.get() + string_size, string_lengths.data(), lengths_size);
+		auto uncompressed_size = string_size + lengths_size;
+		if (uncompressed_size > ZSTDStorage::MAX_UNCOMPRESSED_VECTOR_SIZE) {
+			throw InternalException("ZSTD string compression: vector exceeds the maximum uncompressed size");
+		}
+
+		auto compressed_size = duckdb_zstd::ZSTD_compressCCtx(
+		    context, compressed_buffer.get(), compressed_buffer.GetSize(), uncompressed_buffer.get(),
+		    uncompressed_size, ZSTDStorage::COMPRESSION_LEVEL);
+		if (duckdb_zstd::ZSTD_isError(compressed_size)) {
+			throw InternalException("ZSTD string compression failed: %s",
+			                        duckdb_zstd::ZSTD_getErrorName(compressed_size));
+		}
+		if (!HasEnoughSpace(compressed_size)) {
+			FlushSegment();
+			if (!HasEnoughSpace(compressed_size)) {
+				throw InternalException("ZSTD string compression failed due to insufficient space in empty block");
+			}
+		}
+		memcpy(current_handle.Ptr() + current_offset, compressed_buffer.get(), compressed_size);
+
+		zstd_vector_metadata_t metadata;
+		metadata.row_start = UnsafeNumericCast<uint32_t>(current_segment->count.load());
+		metadata.compressed_offset = UnsafeNumericCast<uint32_t>(current_offset);
+		metadata.compressed_size = UnsafeNumericCast<uint32_t>(compressed_size);
+		metadata.uncompressed_size = UnsafeNumericCast<uint32_t>(uncompressed_size);
+		vector_metadata.push_back(metadata);
+
+		current_offset += compressed_size;
+		current_segment->count += string_lengths.size();
+		// the statistics of the vector only become part of the segment once we know which segment it is written to
+		current_segment->stats.statistics.Merge(vector_stats);
+		vector_stats = StringStats::CreateEmpty(checkpointer.GetType());
+
+		string_lengths.clear();
+		string_size = 0;
+	}
+
+	void FlushSegment(bool final = false) {
+		auto next_start = current_segment->start + current_segment->count;
+
+		// write the metadata of the vectors after the compressed vectors
+		auto base_ptr = current_handle.Ptr();
+		auto metadata_offset = current_offset;
+		for (auto &metadata : vector_metadata) {
+			memcpy(base_ptr + current_offset, &metadata, sizeof(zstd_vector_metadata_t));
+			current_offset += sizeof(zstd_vector_metadata_t);
+		}
+		auto header_ptr = reinterpret_cast<zstd_compression_header_t *>(base_ptr);
+		Store<uint32_t>(UnsafeNumericCast<uint32_t>(vector_metadata.size()), data_ptr_cast(&header_ptr->vector_count));
+		Store<uint32_t>(UnsafeNumericCast<uint32_t>(metadata_offset), data_ptr_cast(&header_ptr->metadata_offset));
+
+		auto segment_size = current_offset;
+		current_handle.Destroy();
+		auto &state = checkpointer.GetCheckpointState();
+		state.FlushSegment(std::move(current_segment), segment_size);
+
+		if (!final) {
+			CreateEmptySegment(next_start);
+		}
+	}
+
+	void Finalize() {
+		FlushVector();
+		FlushSegment(true);
+	}
+
+	ColumnDataCheckpointer &checkpointer;
+	CompressionFunction &function;
+	duckdb_zstd::ZSTD_CCtx *context;
+
+	// State regarding the current segment
+	unique_ptr<ColumnSegment> current_segment;
+	BufferHandle current_handle;
+	idx_t current_offset;
+	vector<zstd_vector_metadata_t> vector_metadata;
+
+	// State regarding the current vector
+	BaseStatistics vector_stats;
+	vector<uint32_t> string_lengths;
+	idx_t string_size;
+	AllocatedData uncompressed_buffer;
+	AllocatedData compressed_buffer;
+};
+
+unique_ptr<CompressionState> ZSTDStorage::InitCompression(ColumnDataCheckpointer &checkpointer,
+                                                          unique_ptr<AnalyzeState> analyze_state_p) {
+	return make_uniq<ZSTDCompressionState>(checkpointer);
+}
+
+void ZSTDStorage::Compress(CompressionState &state_p, Vector &scan_vector, idx_t count) {
+	auto &state = state_p.Cast<ZSTDCompressionState>();
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			state.AddNull();
+		} else {
+			state.AddString(data[idx]);
+		}
+	}
+}
+
+void ZSTDStorage::FinalizeCompress(CompressionState &state_p) {
+	auto &state = state_p.Cast<ZSTDCompressionState>();
+	state.Finalize();
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+struct ZSTDScanState : public StringScanState {
+	explicit ZSTDScanState(Allocator &allocator)
+	    : vector_idx(DConstants::INVALID_INDEX), vector_row_start(0), vector_count(0) {
+		context = duckdb_zstd::ZSTD_createDCtx();
+		decompressed_buffer = allocator.Allocate(ZSTDStorage::MAX_UNCOMPRESSED_VECTOR_SIZE);
+	}
+	~ZSTDScanState() override {
+		duckdb_zstd::ZSTD_freeDCtx(context);
+	}
+
+	duckdb_zstd::ZSTD_DCtx *context;
+	//! The currently decompressed vector
+	idx_t vector_idx;
+	idx_t vector_row_start;
+	idx_t vector_count;
+	AllocatedData decompressed_buffer;
+	//! The offsets of the strings of the current vector in the decompressed buffer
+	vector<uint32_t> string_offsets;
+
+	void LoadVector(ColumnSegment &segment, data_ptr_t base_ptr, idx_t new_vector_idx) {
+		auto metadata = ZSTDStorage::GetVectorMetadata(base_ptr, new_vector_idx);
+		ZSTDStorage::DecompressVector(context, base_ptr, metadata, decompressed_buffer.get());
+
+		vector_idx = new_vector_idx;
+		vector_row_start = metadata.row_start;
+		vector_count = ZSTDStorage::GetVectorCount(segment, base_ptr, new_vector_idx, metadata);
+		ZSTDStorage::VerifyVectorCount(metadata, vector_count);
+
+		// compute the offsets of the strings from their lengths
+		auto lengths_ptr = decompressed_buffer.get() + metadata.uncompressed_size - vector_count * sizeof(uint32_t);
+		string_offsets.resize(vector_count + 1);
+		string_offsets[0] = 0;
+		for (idx_t i = 0; i < vector_count; i++) {
+			string_offsets[i + 1] = string_offsets[i] + Load<uint32_t>(lengths_ptr + i * sizeof(uint32_t));
+		}
+	}
+};
+
+unique_ptr<SegmentScanState> ZSTDStorage::StringInitScan(ColumnSegment &segment) {
+	auto state = make_uniq<ZSTDScanState>(Allocator::Get(segment.db));
+	auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+	state->handle = buffer_manager.Pin(segment.block);
+	return std::move(state);
+}
+
+void ZSTDStorage::StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                                    idx_t result_offset) {
+	auto &scan_state = state.scan_state->Cast<ZSTDScanState>();
+	auto start = segment.GetRelativeIndex(state.row_index);
+	auto base_ptr = scan_state.handle.Ptr() + segment.GetBlockOffset();
+	auto result_data = FlatVector::GetData<string_t>(result);
+
+	idx_t scanned = 0;
+	while (scanned < scan_count) {
+		auto row = start + scanned;
+		if (scan_state.vector_idx == DConstants::INVALID_INDEX || row < scan_state.vector_row_start ||
+		    row >= scan_state.vector_row_start + scan_state.vector_count) {
+			scan_state.LoadVector(segment, base_ptr, FindVector(base_ptr, row));
+		}
+		// copy the strings of the current vector
+		auto vector_offset = row - scan_state.vector_row_start;
+		auto to_scan = MinValue<idx_t>(scan_count - scanned, scan_state.vector_count - vector_offset);
+		auto string_data = char_ptr_cast(scan_state.decompressed_buffer.get());
+		for (idx_t i = 0; i < to_scan; i++) {
+			auto string_start = scan_state.string_offsets[vector_offset + i];
+			auto string_size = scan_state.string_offsets[vector_offset + i + 1] - string_start;
+			auto &target = result_data[result_offset + scanned + i];
+			if (string_size == 0) {
+				target = string_t(nullptr, 0);
+			} else {
+				target = StringVector::AddStringOrBlob(result, string_data + string_start, string_size);
+			}
+		}
+		scanned += to_scan;
+	}
+}
+
+void ZSTDStorage::StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	StringScanPartial(segment, state, scan_count, result, 0);
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+void ZSTDStorage::StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+                                 idx_t result_idx) {
+	auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+	auto handle = buffer_manager.Pin(segment.block);
+	auto base_ptr = handle.Ptr() + segment.GetBlockOffset();
+
+	// only decompress the vector that contains the row
+	auto row = UnsafeNumericCast<idx_t>(row_id);
+	auto vector_idx = FindVector(base_ptr, row);
+	auto metadata = GetVectorMetadata(base_ptr, vector_idx);
+	auto vector_count = GetVectorCount(segment, base_ptr, vector_idx, metadata);
+	VerifyVectorCount(metadata, vector_count);
+	auto decompressed_buffer = Allocator::Get(segment.db).Allocate(metadata.uncompressed_size);
+
+	DecompressVector(nullptr, base_ptr, metadata, decompressed_buffer.get());
+
+	auto lengths_ptr = decompressed_buffer.get() + metadata.uncompressed_size - vector_count * sizeof(uint32_t);
+	auto vector_offset = row - metadata.row_start;
+	idx_t string_start = 0;
+	for (idx_t i = 0; i < vector_offset; i++) {
+		string_start += Load<uint32_t>(lengths_ptr + i * sizeof(uint32_t));
+	}
+	auto string_size = Load<uint32_t>(lengths_ptr + vector_offset * sizeof(uint32_t));
+
+	auto result_data = FlatVector::GetData<string_t>(result);
+	if (string_size == 0) {
+		result_data[result_idx] = string_t(nullptr, 0);
+	} else {
+		result_data[result_idx] = StringVector::AddStringOrBlob(
+		    result, char_ptr_cast(decompressed_buffer.get() + string_start), string_size);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Get Function
+//===--------------------------------------------------------------------===//
+CompressionFunction ZSTDFun::GetFunction(PhysicalType data_type) {
+	D_ASSERT(data_type == PhysicalType::VARCHAR);
+	return CompressionFunction(CompressionType::COMPRESSION_ZSTD, data_type, ZSTDStorage::StringInitAnalyze,
+	                           ZSTDStorage::StringAnalyze, ZSTDStorage::StringFinalAnalyze,
+	                           ZSTDStorage::InitCompression, ZSTDStorage::Compress, ZSTDStorage::FinalizeCompress,
+	                           ZSTDStorage::StringInitScan, ZSTDStorage::StringScan, ZSTDStorage::StringScanPartial,
+	                           ZSTDStorage::StringFetchRow, UncompressedFunctions::EmptySkip);
+}
+
+bool ZSTDFun::TypeIsSupported(PhysicalType type) {
+	return type == PhysicalType::VARCHAR;
+}
+
+//===--------------------------------------------------------------------===//
+// Helper Functions
+//===--------------------------------------------------------------------===//
+zstd_vector_metadata_t ZSTDStorage::GetVectorMetadata(data_ptr_t base_ptr, idx_t vector_idx) {
+	auto header_ptr = reinterpret_cast<zstd_compression_header_t *>(base_ptr);
+	auto metadata_offset = Load<uint32_t>(data_ptr_cast(&header_ptr->metadata_offset));
+	auto metadata =
+	    Load<zstd_vector_metadata_t>(base_ptr + metadata_offset + vector_idx * sizeof(zstd_vector_metadata_t));
+	// the vectors are decompressed into buffers of MAX_UNCOMPRESSED_VECTOR_SIZE bytes
+	if (metadata.uncompressed_size > MAX_UNCOMPRESSED_VECTOR_SIZE) {
+		throw IOException("Corrupt ZSTD compressed string segment: vector of %llu bytes exceeds the maximum of %llu",
+		                  idx_t(metadata.uncompressed_size), MAX_UNCOMPRESSED_VECTOR_SIZE);
+	}
+	return metadata;
+}
+
+idx_t ZSTDStorage::FindVector(data_ptr_t base_ptr, idx_t row) {
+	auto header_ptr = reinterpret_cast<zstd_compression_header_t *>(base_ptr);
+	auto vector_count = Load<uint32_t>(data_ptr_cast(&header_ptr->vector_count));
+	if (vector_count == 0) {
+		throw IOException("Corrupt ZSTD compressed string segment: segment has no vectors");
+	}
+	// binary search for the last vector that starts at or before the row
+	idx_t lower = 0;
+	idx_t upper = vector_count - 1;
+	while (lower < upper) {
+		auto middle = (lower + upper + 1) / 2;
+		if (GetVectorMetadata(base_ptr, middle).row_start <= row) {
+			lower = middle;
+		} else {
+			upper = middle - 1;
+		}
+	}
+	return lower;
+}
+
+idx_t ZSTDStorage::GetVectorCount(ColumnSegment &segment, data_ptr_t base_ptr, idx_t vector_idx,
+                                  const zstd_vector_metadata_t &metadata) {
+	auto header_ptr = reinterpret_cast<zstd_compression_header_t *>(base_ptr);
+	auto vector_count = Load<uint32_t>(data_ptr_cast(&header_ptr->vector_count));
+	if (vector_idx + 1 < vector_count) {
+		return GetVectorMetadata(base_ptr, vector_idx + 1).row_start - metadata.row_start;
+	}
+	return segment.count - metadata.row_start;
+}
+
+void ZSTDStorage::VerifyVectorCount(const zstd_vector_metadata_t &metadata, idx_t vector_count) {
+	if (vector_count * sizeof(uint32_t) > metadata.uncompressed_size) {
+		throw IOException("Corrupt ZSTD compressed string segment: vector is too small for its string lengths");
+	}
+}
+
+void ZSTDStorage::DecompressVector(duckdb_zstd::ZSTD_DCtx *context, data_ptr_t base_ptr,
+                                   const zstd_vector_metadata_t &metadata, data_ptr_t target) {
+	auto source = base_ptr + metadata.compressed_offset;
+	size_t decompressed_size;
+	if (context) {
+		decompressed_size = duckdb_zstd::ZSTD_decompressDCtx(context, target, metadata.uncompressed_size, source,
+		                                                     metadata.compressed_size);
+	} else {
+		decompressed_size =
+		    duckdb_zstd::ZSTD_decompress(target, metadata.uncompressed_size, source, metadata.compressed_size);
+	}
+	if (duckdb_zstd::ZSTD_isError(decompressed_size) || decompressed_size != metadata.uncompressed_size) {
+		throw IOException("Failed to decompress ZSTD compressed string segment");
+	}
+}
+
+} // namespace duckdb
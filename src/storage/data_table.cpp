@@ -23,6 +23,7 @@
 #include "duckdb/common/types/conflict_manager.hpp"
 #include "duckdb/common/types/constraint_conflict_info.hpp"
 #include "duckdb/storage/table/append_state.hpp"
+#include "duckdb/storage/table/collection_checkpoint_state.hpp"
 #include "duckdb/storage/table/delete_state.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
 #include "duckdb/storage/table/update_state.hpp"
@@ -1391,11 +1392,20 @@ unique_ptr<StorageLockKey> DataTable::GetCheckpointLock() {
 	return info->checkpoint_lock.GetExclusiveLock();
 }
 
-void DataTable::Checkpoint(TableDataWriter &writer, Serializer &serializer) {
+unique_ptr<StorageLockKey> DataTable::TryGetCheckpointLock() {
+	return info->checkpoint_lock.TryGetExclusiveLock();
+}
+
+unique_ptr<CollectionCheckpointState> DataTable::ScheduleCheckpoint(TableDataWriter &writer) {
+	return row_groups->ScheduleCheckpoint(writer);
+}
+
+void DataTable::Checkpoint(TableDataWriter &writer, CollectionCheckpointState &checkpoint_state,
+                           Serializer &serializer) {
 	// checkpoint each individual row group
 	TableStatistics global_stats;
 	row_groups->CopyStats(global_stats);
-	row_groups->Checkpoint(writer, global_stats);
+	row_groups->Checkpoint(checkpoint_state, global_stats);
 
 	// The row group payload data has been written. Now write:
 	//   column stats
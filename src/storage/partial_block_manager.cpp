@@ -177,6 +177,8 @@ void PartialBlockManager::ClearBlocks() {
 }
 
 void PartialBlockManager::FlushPartialBlocks() {
+	// segments of other tables might be written concurrently while we are flushing
+	auto guard = GetLock();
 	for (auto &e : partially_filled_blocks) {
 		e.second->Flush(e.first);
 	}
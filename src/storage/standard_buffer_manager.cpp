@@ -197,8 +197,13 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 		// check if the block is already loaded
 		if (handle->state == BlockState::BLOCK_LOADED) {
 			// the block is loaded, increment the reader count and set the BufferHandle
+			// re-pinning a block that nobody has pinned counts as another access to it
+			if (handle->readers == 0) {
+				handle->resident_pins++;
+			}
 			handle->readers++;
 			buf = handle->Load(handle);
+			buffer_pool.buffer_hits_per_tag[uint8_t(handle->tag)]++;
 		}
 		required_memory = handle->memory_usage;
 	}
@@ -217,14 +222,19 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 		// check if the block is already loaded
 		if (handle->state == BlockState::BLOCK_LOADED) {
 			// the block is loaded, increment the reader count and return a pointer to the handle
+			if (handle->readers == 0) {
+				handle->resident_pins++;
+			}
 			handle->readers++;
 			reservation.Resize(0);
 			buf = handle->Load(handle);
+			buffer_pool.buffer_hits_per_tag[uint8_t(handle->tag)]++;
 		} else {
 			// now we can actually load the current block
 			D_ASSERT(handle->readers == 0);
 			handle->readers = 1;
 			buf = handle->Load(handle, std::move(reusable_buffer));
+			buffer_pool.buffer_loads_per_tag[uint8_t(handle->tag)]++;
 			handle->memory_charge = std::move(reservation);
 			// in the case of a variable sized block, the buffer may be smaller than a full block.
 			int64_t delta =
@@ -303,6 +313,9 @@ vector<MemoryInformation> StandardBufferManager::GetMemoryUsageInfo() const {
 		info.tag = MemoryTag(k);
 		info.size = buffer_pool.memory_usage_per_tag[k].load();
 		info.evicted_data = evicted_data_per_tag[k].load();
+		info.buffer_hits = buffer_pool.buffer_hits_per_tag[k].load();
+		info.buffer_loads = buffer_pool.buffer_loads_per_tag[k].load();
+		info.buffer_evictions = buffer_pool.buffer_evictions_per_tag[k].load();
 		result.push_back(info);
 	}
 	return result;
@@ -429,6 +442,8 @@ vector<TemporaryFileInformation> StandardBufferManager::GetTemporaryFiles() {
 		info.path = name;
 		auto handle = fs.OpenFile(name, FileFlags::FILE_FLAGS_READ);
 		info.size = NumericCast<idx_t>(fs.GetFileSize(*handle));
+		info.uncompressed_size = info.size;
+		info.compressed_size = info.size;
 		handle.reset();
 		result.push_back(info);
 	});
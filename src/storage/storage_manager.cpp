@@ -19,7 +19,7 @@
 namespace duckdb {
 
 StorageManager::StorageManager(AttachedDatabase &db, string path_p, bool read_only)
-    : db(db), path(std::move(path_p)), read_only(read_only) {
+    : db(db), path(std::move(path_p)), read_only(read_only), checkpoint_total_rows(0), checkpoint_written_rows(0) {
 	if (path.empty()) {
 		path = IN_MEMORY_PATH;
 	} else {
@@ -111,6 +111,39 @@ bool StorageManager::InMemory() {
 	return path == IN_MEMORY_PATH;
 }
 
+void StorageManager::StartCheckpointProgress(idx_t total_rows) {
+	checkpoint_written_rows = 0;
+	checkpoint_total_rows = total_rows;
+}
+
+void StorageManager::AddCheckpointProgress(idx_t count) {
+	checkpoint_written_rows += count;
+}
+
+double StorageManager::GetCheckpointProgress() const {
+	idx_t total_rows = checkpoint_total_rows;
+	if (total_rows == 0) {
+		return 0;
+	}
+	// vacuuming might write fewer rows than the table originally had - clamp to 100%
+	double written_rows = static_cast<double>(MinValue<idx_t>(checkpoint_written_rows, total_rows));
+	return written_rows * 100.0 / static_cast<double>(total_rows);
+}
+
+void StorageManager::AddWALSync(idx_t batch_size, idx_t sync_time) {
+	lock_guard<mutex> guard(wal_statistics_lock);
+	wal_statistics.commits += batch_size;
+	wal_statistics.syncs++;
+	wal_statistics.max_batch_size = MaxValue(wal_statistics.max_batch_size, batch_size);
+	wal_statistics.total_sync_time += sync_time;
+	wal_statistics.max_sync_time = MaxValue(wal_statistics.max_sync_time, sync_time);
+}
+
+WALCommitStatistics StorageManager::GetWALCommitStatistics() {
+	lock_guard<mutex> guard(wal_statistics_lock);
+	return wal_statistics;
+}
+
 void StorageManager::Initialize() {
 	bool in_memory = InMemory();
 	if (in_memory && read_only) {
@@ -233,8 +266,8 @@ public:
 		}
 	}
 
-	// Make the commit persistent
-	void FlushCommit() override;
+	// Write the commit to the WAL
+	idx_t FlushCommit() override;
 };
 
 SingleFileStorageCommitState::SingleFileStorageCommitState(StorageManager &storage_manager, bool checkpoint)
@@ -256,20 +289,23 @@ SingleFileStorageCommitState::SingleFileStorageCommitState(StorageManager &stora
 	}
 }
 
-// Make the commit persistent
-void SingleFileStorageCommitState::FlushCommit() {
+// Write the commit to the WAL
+idx_t SingleFileStorageCommitState::FlushCommit() {
+	idx_t commit_sequence = 0;
 	if (log) {
-		// flush the WAL if any changes were made
+		// write the commit to the WAL if any changes were made
+		// the WAL is synced by the caller once the transaction lock is released, so concurrent commits share a sync
 		if (log->GetTotalWritten() > initial_written) {
 			(void)checkpoint;
 			D_ASSERT(!checkpoint);
 			D_ASSERT(!log->skip_writing);
-			log->Flush();
+			commit_sequence = log->WriteCommit();
 		}
 		log->skip_writing = false;
 	}
 	// Null so that the destructor will not truncate the log.
 	log = nullptr;
+	return commit_sequence;
 }
 
 unique_ptr<StorageCommitState> SingleFileStorageManager::GenStorageCommitState(Transaction &transaction,
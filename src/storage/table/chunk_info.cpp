@@ -1,4 +1,5 @@
 #include "duckdb/storage/table/chunk_info.hpp"
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/transaction/transaction.hpp"
 #include "duckdb/common/exception/transaction_exception.hpp"
 #include "duckdb/common/serializer/serializer.hpp"
@@ -44,7 +45,8 @@ unique_ptr<ChunkInfo> ChunkInfo::Read(ReadStream &reader) {
 	case ChunkInfoType::CONSTANT_INFO:
 		return ChunkConstantInfo::Read(reader);
 	case ChunkInfoType::VECTOR_INFO:
-		return ChunkVectorInfo::Read(reader);
+		// committed deletes are always loaded as a bitmap
+		return ChunkBitmapInfo::Read(reader);
 	default:
 		throw SerializationException("Could not deserialize Chunk Info Type: unrecognized type");
 	}
@@ -277,18 +279,175 @@ void ChunkVectorInfo::Write(WriteStream &writer) const {
 	mask.Write(writer, STANDARD_VECTOR_SIZE);
 }
 
-unique_ptr<ChunkInfo> ChunkVectorInfo::Read(ReadStream &reader) {
+bool ChunkVectorInfo::IsCommitted(transaction_t lowest_active_start) const {
+	if (same_inserted_id) {
+		if (insert_id >= lowest_active_start) {
+			return false;
+		}
+	} else {
+		for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
+			if (inserted[i] >= lowest_active_start) {
+				return false;
+			}
+		}
+	}
+	if (!any_deleted) {
+		return true;
+	}
+	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
+		if (deleted[i] != NOT_DELETED_ID && deleted[i] >= lowest_active_start) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//===--------------------------------------------------------------------===//
+// Bitmap info
+//===--------------------------------------------------------------------===//
+ChunkBitmapInfo::ChunkBitmapInfo(idx_t start, const ValidityMask &visible_mask)
+    : ChunkInfo(start, ChunkInfoType::BITMAP_INFO) {
+	deleted_count = STANDARD_VECTOR_SIZE - visible_mask.CountValid(STANDARD_VECTOR_SIZE);
+	if (deleted_count > MAX_OFFSET_COUNT) {
+		visible.Copy(visible_mask, STANDARD_VECTOR_SIZE);
+		return;
+	}
+	// few rows are deleted: store their offsets instead of the full bitmap
+	deleted_offsets.reserve(deleted_count);
+	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
+		if (!visible_mask.RowIsValid(i)) {
+			deleted_offsets.push_back(UnsafeNumericCast<uint16_t>(i));
+		}
+	}
+}
+
+template <class OP>
+idx_t ChunkBitmapInfo::TemplatedGetSelVector(transaction_t start_time, transaction_t transaction_id,
+                                             SelectionVector &sel_vector, idx_t max_count) const {
+	// all tuples in a bitmap info were inserted and deleted by transactions that are visible to everyone
+	if (!OP::UseInsertedVersion(start_time, transaction_id, 0)) {
+		return 0;
+	}
+	if (OP::UseDeletedVersion(start_time, transaction_id, 0)) {
+		return max_count;
+	}
+	idx_t count = 0;
+	if (deleted_count <= MAX_OFFSET_COUNT) {
+		idx_t row_idx = 0;
+		for (auto offset : deleted_offsets) {
+			if (offset >= max_count) {
+				break;
+			}
+			for (; row_idx < offset; row_idx++) {
+				sel_vector.set_index(count++, row_idx);
+			}
+			row_idx = offset + 1;
+		}
+		for (; row_idx < max_count; row_idx++) {
+			sel_vector.set_index(count++, row_idx);
+		}
+		return count;
+	}
+	// go over the bitmap one entry at a time, skipping entries in which nothing or everything is deleted
+	idx_t base_idx = 0;
+	auto entry_count = ValidityMask::EntryCount(max_count);
+	for (idx_t entry_idx = 0; entry_idx < entry_count; entry_idx++) {
+		auto validity_entry = visible.GetValidityEntry(entry_idx);
+		idx_t next = MinValue<idx_t>(base_idx + ValidityMask::BITS_PER_VALUE, max_count);
+		if (ValidityMask::AllValid(validity_entry)) {
+			for (; base_idx < next; base_idx++) {
+				sel_vector.set_index(count++, base_idx);
+			}
+		} else if (ValidityMask::NoneValid(validity_entry)) {
+			base_idx = next;
+		} else {
+			idx_t entry_start = base_idx;
+			for (; base_idx < next; base_idx++) {
+				if (ValidityMask::RowIsValid(validity_entry, base_idx - entry_start)) {
+					sel_vector.set_index(count++, base_idx);
+				}
+			}
+		}
+	}
+	return count;
+}
+
+idx_t ChunkBitmapInfo::GetSelVector(TransactionData transaction, SelectionVector &sel_vector, idx_t max_count) {
+	return TemplatedGetSelVector<TransactionVersionOperator>(transaction.start_time, transaction.transaction_id,
+	                                                         sel_vector, max_count);
+}
+
+idx_t ChunkBitmapInfo::GetCommittedSelVector(transaction_t min_start_id, transaction_t min_transaction_id,
+                                             SelectionVector &sel_vector, idx_t max_count) {
+	return TemplatedGetSelVector<CommittedVersionOperator>(min_start_id, min_transaction_id, sel_vector, max_count);
+}
+
+bool ChunkBitmapInfo::IsDeleted(idx_t row) const {
+	if (deleted_count <= MAX_OFFSET_COUNT) {
+		return std::binary_search(deleted_offsets.begin(), deleted_offsets.end(), row);
+	}
+	return !visible.RowIsValid(row);
+}
+
+bool ChunkBitmapInfo::Fetch(TransactionData transaction, row_t row) {
+	return UseVersion(transaction, 0) && !IsDeleted(UnsafeNumericCast<idx_t>(row));
+}
+
+void ChunkBitmapInfo::CommitAppend(transaction_t commit_id, idx_t start, idx_t end) {
+	throw InternalException("ChunkBitmapInfo::CommitAppend - cannot append to a bitmap info");
+}
+
+bool ChunkBitmapInfo::HasDeletes() const {
+	return deleted_count > 0;
+}
+
+idx_t ChunkBitmapInfo::GetCommittedDeletedCount(idx_t max_count) {
+	if (deleted_count <= MAX_OFFSET_COUNT) {
+		auto end = std::lower_bound(deleted_offsets.begin(), deleted_offsets.end(), max_count);
+		return NumericCast<idx_t>(end - deleted_offsets.begin());
+	}
+	return max_count - visible.CountValid(max_count);
+}
+
+void ChunkBitmapInfo::Write(WriteStream &writer) const {
+	D_ASSERT(HasDeletes());
+	if (deleted_count == STANDARD_VECTOR_SIZE) {
+		// everything is deleted: write a constant vector
+		writer.Write<ChunkInfoType>(ChunkInfoType::CONSTANT_INFO);
+		writer.Write<idx_t>(start);
+		return;
+	}
+	// the bitmap info is written in the same format as a vector info - in which the valid rows are the deleted rows
+	writer.Write<ChunkInfoType>(ChunkInfoType::VECTOR_INFO);
+	writer.Write<idx_t>(start);
+	ValidityMask mask(STANDARD_VECTOR_SIZE);
+	mask.Initialize(STANDARD_VECTOR_SIZE);
+	if (deleted_count <= MAX_OFFSET_COUNT) {
+		mask.SetAllInvalid(STANDARD_VECTOR_SIZE);
+		for (auto offset : deleted_offsets) {
+			mask.SetValid(offset);
+		}
+	} else {
+		auto entry_count = ValidityMask::EntryCount(STANDARD_VECTOR_SIZE);
+		for (idx_t entry_idx = 0; entry_idx < entry_count; entry_idx++) {
+			mask.GetData()[entry_idx] = ~visible.GetValidityEntry(entry_idx);
+		}
+	}
+	mask.Write(writer, STANDARD_VECTOR_SIZE);
+}
+
+unique_ptr<ChunkInfo> ChunkBitmapInfo::Read(ReadStream &reader) {
 	auto start = reader.Read<idx_t>();
-	auto result = make_uniq<ChunkVectorInfo>(start);
-	result->any_deleted = true;
 	ValidityMask mask;
 	mask.Read(reader, STANDARD_VECTOR_SIZE);
-	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
-		if (mask.RowIsValid(i)) {
-			result->deleted[i] = 0;
-		}
+	// on disk the valid rows are the deleted rows: flip the mask
+	ValidityMask visible_mask(STANDARD_VECTOR_SIZE);
+	visible_mask.Initialize(STANDARD_VECTOR_SIZE);
+	auto entry_count = ValidityMask::EntryCount(STANDARD_VECTOR_SIZE);
+	for (idx_t entry_idx = 0; entry_idx < entry_count; entry_idx++) {
+		visible_mask.GetData()[entry_idx] = ~mask.GetValidityEntry(entry_idx);
 	}
-	return std::move(result);
+	return make_uniq<ChunkBitmapInfo>(start, visible_mask);
 }
 
 } // namespace duckdb
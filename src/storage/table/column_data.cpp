@@ -58,13 +58,26 @@ const LogicalType &ColumnData::RootType() const {
 }
 
 bool ColumnData::HasUpdates() const {
+	return has_updates;
+}
+
+bool ColumnData::HasUpdates(idx_t row_index, idx_t count) const {
+	if (!has_updates || count == 0) {
+		// most columns have no updates - avoid taking the update lock for every scanned vector
+		return false;
+	}
 	lock_guard<mutex> update_guard(update_lock);
-	return updates.get();
+	if (!updates) {
+		return false;
+	}
+	auto start_row = row_index - start;
+	return updates->HasUpdates(start_row, start_row + count - 1);
 }
 
 void ColumnData::ClearUpdates() {
 	lock_guard<mutex> update_guard(update_lock);
 	updates.reset();
+	has_updates = false;
 }
 
 idx_t ColumnData::GetMaxEntry() {
@@ -92,7 +105,7 @@ void ColumnData::InitializeScanWithOffset(ColumnScanState &state, idx_t row_idx)
 }
 
 ScanVectorType ColumnData::GetVectorScanType(ColumnScanState &state, idx_t scan_count) {
-	if (HasUpdates()) {
+	if (HasUpdates(state.row_index, scan_count)) {
 		// if we have updates we need to merge in the updates
 		// always need to scan flat vectors
 		return ScanVectorType::SCAN_FLAT_VECTOR;
@@ -176,6 +189,10 @@ void ColumnData::FetchUpdates(TransactionData transaction, idx_t vector_index, V
 	if (!allow_updates && updates->HasUncommittedUpdates(vector_index)) {
 		throw TransactionException("Cannot create index with outstanding updates");
 	}
+	if (!updates->HasUpdates(vector_index)) {
+		// the vector has no updates: it does not need to be flattened
+		return;
+	}
 	result.Flatten(scan_count);
 	if (scan_committed) {
 		updates->FetchCommitted(vector_index, result);
@@ -197,6 +214,7 @@ void ColumnData::UpdateInternal(TransactionData transaction, idx_t column_index,
 	lock_guard<mutex> update_guard(update_lock);
 	if (!updates) {
 		updates = make_uniq<UpdateSegment>(*this);
+		has_updates = true;
 	}
 	updates->Update(transaction, column_index, update_vector, row_ids, update_count, base_vector);
 }
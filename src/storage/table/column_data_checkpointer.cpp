@@ -95,6 +95,18 @@ CompressionType ForceCompression(vector<optional_ptr<CompressionFunction>> &comp
 	return found ? compression_type : CompressionType::COMPRESSION_AUTO;
 }
 
+//! Whether the compression method can be selected automatically - methods that older versions of DuckDB cannot read
+//! are only selected if the storage compatibility version allows it, or if they are forced
+static bool CompressionTypeIsAvailable(CompressionType compression_type, const DBConfig &config) {
+	switch (compression_type) {
+	case CompressionType::COMPRESSION_PFOR_DELTA:
+	case CompressionType::COMPRESSION_ZSTD:
+		return config.options.serialization_compatibility.Compare(2);
+	default:
+		return true;
+	}
+}
+
 unique_ptr<AnalyzeState> ColumnDataCheckpointer::DetectBestCompressionMethod(idx_t &compression_idx) {
 	D_ASSERT(!compression_functions.empty());
 	auto &config = DBConfig::GetConfig(GetDatabase());
@@ -108,6 +120,13 @@ unique_ptr<AnalyzeState> ColumnDataCheckpointer::DetectBestCompressionMethod(idx
 	    config.options.force_compression != CompressionType::COMPRESSION_AUTO) {
 		forced_method = ForceCompression(compression_functions, config.options.force_compression);
 	}
+	if (forced_method == CompressionType::COMPRESSION_AUTO) {
+		for (auto &compression_function : compression_functions) {
+			if (compression_function && !CompressionTypeIsAvailable(compression_function->type, config)) {
+				compression_function = nullptr;
+			}
+		}
+	}
 	// set up the analyze states for each compression method
 	vector<unique_ptr<AnalyzeState>> analyze_states;
 	analyze_states.reserve(compression_functions.size());
@@ -7,6 +7,8 @@
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
@@ -488,6 +490,11 @@ idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &vector, Unifi
 		}
 		return approved_tuple_count;
 	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		approved_tuple_count = in_filter.Select(vdata, sel, approved_tuple_count);
+		return approved_tuple_count;
+	}
 	case TableFilterType::IS_NULL:
 		return TemplatedNullSelection<true>(vdata, sel, approved_tuple_count);
 	case TableFilterType::IS_NOT_NULL:
@@ -501,6 +508,23 @@ idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &vector, Unifi
 		return FilterSelection(sel, *child_vec, child_data, *struct_filter.child_filter, scan_count,
 		                       approved_tuple_count);
 	}
+	case TableFilterType::DYNAMIC_FILTER: {
+		auto &filter_data = *filter.Cast<DynamicFilter>().filter_data;
+		if (!filter_data.initialized) {
+			// the filter has not been computed (yet): everything passes
+			return approved_tuple_count;
+		}
+		{
+			lock_guard<mutex> guard(filter_data.lock);
+			if (filter_data.filter) {
+				FilterSelection(sel, vector, vdata, *filter_data.filter, scan_count, approved_tuple_count);
+			}
+		}
+		if (filter_data.CanProbeBloomFilter(vector.GetType())) {
+			approved_tuple_count = filter_data.ProbeBloomFilter(vector, sel, approved_tuple_count);
+		}
+		return approved_tuple_count;
+	}
 	default:
 		throw InternalException("FIXME: unsupported type for filter selection");
 	}
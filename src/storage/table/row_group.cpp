@@ -397,6 +397,8 @@ static idx_t GetFilterScanCount(ColumnScanState &state, TableFilter &filter) {
 	case TableFilterType::IS_NULL:
 	case TableFilterType::IS_NOT_NULL:
 	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::DYNAMIC_FILTER:
+	case TableFilterType::IN_FILTER:
 		return state.current->start + state.current->count;
 	default: {
 		throw NotImplementedException("Unimplemented filter type for zonemap");
@@ -909,7 +911,8 @@ vector<MetaBlockPointer> RowGroup::CheckpointDeletes(MetadataManager &manager) {
 		// no version information: write nothing
 		return vector<MetaBlockPointer>();
 	}
-	return version_info->Checkpoint(manager);
+	auto &transaction_manager = DuckTransactionManager::Get(GetCollection().GetAttached());
+	return version_info->Checkpoint(manager, transaction_manager.LowestActiveStart());
 }
 
 void RowGroup::Serialize(RowGroupPointer &pointer, Serializer &serializer) {
@@ -14,6 +14,8 @@
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/execution/task_error_manager.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
+#include "duckdb/storage/table/collection_checkpoint_state.hpp"
+#include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/execution/index/bound_index.hpp"
 
 namespace duckdb {
@@ -606,107 +608,25 @@ void RowGroupCollection::UpdateColumn(TransactionData transaction, Vector &row_i
 //===--------------------------------------------------------------------===//
 // Checkpoint State
 //===--------------------------------------------------------------------===//
-struct CollectionCheckpointState {
-	CollectionCheckpointState(RowGroupCollection &collection, TableDataWriter &writer,
-	                          vector<SegmentNode<RowGroup>> &segments, TableStatistics &global_stats)
-	    : collection(collection), writer(writer), scheduler(writer.GetScheduler()), segments(segments),
-	      global_stats(global_stats), token(scheduler.CreateProducer()), completed_tasks(0), total_tasks(0) {
-		writers.resize(segments.size());
-		write_data.resize(segments.size());
-	}
-
-	RowGroupCollection &collection;
-	TableDataWriter &writer;
-	TaskScheduler &scheduler;
-	vector<SegmentNode<RowGroup>> &segments;
-	vector<unique_ptr<RowGroupWriter>> writers;
-	vector<RowGroupWriteData> write_data;
-	TableStatistics &global_stats;
-	mutex write_lock;
-
-public:
-	void PushError(ErrorData error) {
-		error_manager.PushError(std::move(error));
-	}
-	bool HasError() {
-		return error_manager.HasError();
-	}
-	void ThrowError() {
-		error_manager.ThrowException();
-	}
-
-	void ScheduleTask(unique_ptr<Task> task) {
-		++total_tasks;
-		scheduler.ScheduleTask(*token, std::move(task));
-	}
-	void FinishTask() {
-		++completed_tasks;
-	}
-	bool TasksFinished() {
-		if (completed_tasks == total_tasks) {
-			return true;
-		}
-		if (HasError()) {
-			return true;
-		}
-		return false;
-	}
-	void CancelTasks() {
-		// This should only be called after an error has occurred, no other mechanism to cancel checkpoint tasks exists
-		// currently
-		D_ASSERT(error_manager.HasError());
-		// Give every pending task the chance to cancel
-		WorkOnTasks();
-		// Wait for all active tasks to realize they have been canceled
-		while (completed_tasks != total_tasks) {
-		}
-	}
-
-	void WorkOnTasks() {
-		shared_ptr<Task> task_from_producer;
-		while (scheduler.GetTaskFromProducer(*token, task_from_producer)) {
-			auto res = task_from_producer->Execute(TaskExecutionMode::PROCESS_ALL);
-			(void)res;
-			D_ASSERT(res != TaskExecutionResult::TASK_BLOCKED);
-			task_from_producer.reset();
-		}
-	}
-
-	bool GetTask(shared_ptr<Task> &task) {
-		return scheduler.GetTaskFromProducer(*token, task);
-	}
+CollectionCheckpointState::CollectionCheckpointState(RowGroupCollection &collection, TableDataWriter &writer,
+                                                     vector<SegmentNode<RowGroup>> segments_p,
+                                                     SegmentLock segment_lock_p)
+    : collection(collection), writer(writer), segments(std::move(segments_p)), segment_lock(std::move(segment_lock_p)),
+      executor(writer.GetScheduler()) {
+	writers.resize(segments.size());
+	write_data.resize(segments.size());
+}
 
-private:
-	TaskErrorManager error_manager;
-	unique_ptr<ProducerToken> token;
-	atomic<idx_t> completed_tasks;
-	atomic<idx_t> total_tasks;
-};
+CollectionCheckpointState::~CollectionCheckpointState() {
+	// the checkpoint might have been abandoned before all tasks were finished - cancel the remaining tasks
+	// the tasks reference this state, so we cannot return before they have all finished
+	executor.CancelTasks();
+}
 
-class BaseCheckpointTask : public Task {
+class BaseCheckpointTask : public BaseExecutorTask {
 public:
-	explicit BaseCheckpointTask(CollectionCheckpointState &checkpoint_state) : checkpoint_state(checkpoint_state) {
-	}
-
-	virtual void ExecuteTask() = 0;
-	TaskExecutionResult Execute(TaskExecutionMode mode) override {
-		(void)mode;
-		D_ASSERT(mode == TaskExecutionMode::PROCESS_ALL);
-		if (checkpoint_state.HasError()) {
-			checkpoint_state.FinishTask();
-			return TaskExecutionResult::TASK_FINISHED;
-		}
-		try {
-			ExecuteTask();
-			checkpoint_state.FinishTask();
-			return TaskExecutionResult::TASK_FINISHED;
-		} catch (std::exception &ex) {
-			checkpoint_state.PushError(ErrorData(ex));
-		} catch (...) { // LCOV_EXCL_START
-			checkpoint_state.PushError(ErrorData("Unknown exception during Checkpoint!"));
-		} // LCOV_EXCL_STOP
-		checkpoint_state.FinishTask();
-		return TaskExecutionResult::TASK_ERROR;
+	explicit BaseCheckpointTask(CollectionCheckpointState &checkpoint_state)
+	    : BaseExecutorTask(checkpoint_state.executor), checkpoint_state(checkpoint_state) {
 	}
 
 protected:
@@ -724,6 +644,7 @@ public:
 		auto &row_group = *entry.node;
 		checkpoint_state.writers[index] = checkpoint_state.writer.GetRowGroupWriter(*entry.node);
 		checkpoint_state.write_data[index] = row_group.WriteToDisk(*checkpoint_state.writers[index]);
+		StorageManager::Get(checkpoint_state.collection.GetAttached()).AddCheckpointProgress(row_group.count);
 	}
 
 private:
@@ -733,13 +654,6 @@ private:
 //===--------------------------------------------------------------------===//
 // Vacuum
 //===--------------------------------------------------------------------===//
-struct VacuumState {
-	bool can_vacuum_deletes = false;
-	idx_t row_start = 0;
-	idx_t next_vacuum_idx = 0;
-	vector<idx_t> row_group_counts;
-};
-
 class VacuumTask : public BaseCheckpointTask {
 public:
 	VacuumTask(CollectionCheckpointState &checkpoint_state, VacuumState &vacuum_state, idx_t segment_idx,
@@ -933,7 +847,7 @@ bool RowGroupCollection::ScheduleVacuumTasks(CollectionCheckpointState &checkpoi
 	// schedule the vacuum task
 	auto vacuum_task = make_uniq<VacuumTask>(checkpoint_state, state, segment_idx, merge_count, target_count,
 	                                         merge_rows, state.row_start);
-	checkpoint_state.ScheduleTask(std::move(vacuum_task));
+	checkpoint_state.executor.ScheduleTask(std::move(vacuum_task));
 	// skip vacuuming by the row groups we have merged
 	state.next_vacuum_idx = next_idx;
 	state.row_start += merge_rows;
@@ -945,20 +859,20 @@ bool RowGroupCollection::ScheduleVacuumTasks(CollectionCheckpointState &checkpoi
 //===--------------------------------------------------------------------===//
 void RowGroupCollection::ScheduleCheckpointTask(CollectionCheckpointState &checkpoint_state, idx_t segment_idx) {
 	auto checkpoint_task = make_uniq<CheckpointTask>(checkpoint_state, segment_idx);
-	checkpoint_state.ScheduleTask(std::move(checkpoint_task));
+	checkpoint_state.executor.ScheduleTask(std::move(checkpoint_task));
 }
 
-void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &global_stats) {
+unique_ptr<CollectionCheckpointState> RowGroupCollection::ScheduleCheckpoint(TableDataWriter &writer) {
 	auto segments = row_groups->MoveSegments();
 	auto l = row_groups->Lock();
 
-	CollectionCheckpointState checkpoint_state(*this, writer, segments, global_stats);
-
-	VacuumState vacuum_state;
-	InitializeVacuumState(checkpoint_state, vacuum_state, segments);
+	auto result = make_uniq<CollectionCheckpointState>(*this, writer, std::move(segments), std::move(l));
+	auto &checkpoint_state = *result;
+	auto &vacuum_state = checkpoint_state.vacuum_state;
+	InitializeVacuumState(checkpoint_state, vacuum_state, checkpoint_state.segments);
 	// schedule tasks
-	for (idx_t segment_idx = 0; segment_idx < segments.size(); segment_idx++) {
-		auto &entry = segments[segment_idx];
+	for (idx_t segment_idx = 0; segment_idx < checkpoint_state.segments.size(); segment_idx++) {
+		auto &entry = checkpoint_state.segments[segment_idx];
 		auto vacuum_tasks = ScheduleVacuumTasks(checkpoint_state, vacuum_state, segment_idx);
 		if (vacuum_tasks) {
 			// vacuum tasks were scheduled - don't schedule a checkpoint task yet
@@ -973,20 +887,16 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 		ScheduleCheckpointTask(checkpoint_state, segment_idx);
 		vacuum_state.row_start += entry.node->count;
 	}
-	// all tasks have been scheduled - execute tasks until we are done
-	do {
-		shared_ptr<Task> task;
-		while (checkpoint_state.GetTask(task)) {
-			task->Execute(TaskExecutionMode::PROCESS_ALL);
-			task.reset();
-		}
-	} while (!checkpoint_state.TasksFinished());
-	// check if we ran into any errors while checkpointing
-	if (checkpoint_state.HasError()) {
-		// throw the error
-		checkpoint_state.CancelTasks();
-		checkpoint_state.ThrowError();
-	}
+	return result;
+}
+
+void RowGroupCollection::Checkpoint(CollectionCheckpointState &checkpoint_state, TableStatistics &global_stats) {
+	D_ASSERT(RefersToSameObject(checkpoint_state.collection, *this));
+	auto &writer = checkpoint_state.writer;
+	auto &segments = checkpoint_state.segments;
+	auto &l = checkpoint_state.segment_lock;
+	// all tasks have been scheduled - execute tasks until we are done, this throws if we ran into any errors
+	checkpoint_state.executor.WorkOnTasks();
 
 	// no errors - finalize the row groups
 	idx_t new_total_rows = 0;
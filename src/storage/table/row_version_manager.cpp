@@ -97,9 +97,9 @@ void RowVersionManager::AppendVersionInfo(TransactionData transaction, idx_t cou
 				auto insert_info = make_uniq<ChunkVectorInfo>(start + vector_idx * STANDARD_VECTOR_SIZE);
 				new_info = insert_info.get();
 				vector_info[vector_idx] = std::move(insert_info);
-			} else if (vector_info[vector_idx]->type == ChunkInfoType::VECTOR_INFO) {
+			} else if (vector_info[vector_idx]->type != ChunkInfoType::CONSTANT_INFO) {
 				// use existing vector
-				new_info = &vector_info[vector_idx]->Cast<ChunkVectorInfo>();
+				new_info = &GetVectorInfo(vector_idx);
 			} else {
 				throw InternalException("Error in RowVersionManager::AppendVersionInfo - expected either a "
 				                        "ChunkVectorInfo or no version info");
@@ -148,6 +148,17 @@ ChunkVectorInfo &RowVersionManager::GetVectorInfo(idx_t vector_idx) {
 			new_info->inserted[i] = constant.insert_id;
 		}
 		vector_info[vector_idx] = std::move(new_info);
+	} else if (vector_info[vector_idx]->type == ChunkInfoType::BITMAP_INFO) {
+		auto &bitmap = vector_info[vector_idx]->Cast<ChunkBitmapInfo>();
+		// info exists but it's a bitmap info: expand it into a vector info again
+		auto new_info = make_uniq<ChunkVectorInfo>(start + vector_idx * STANDARD_VECTOR_SIZE);
+		new_info->any_deleted = bitmap.HasDeletes();
+		for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
+			if (bitmap.IsDeleted(i)) {
+				new_info->deleted[i] = 0;
+			}
+		}
+		vector_info[vector_idx] = std::move(new_info);
 	}
 	D_ASSERT(vector_info[vector_idx]->type == ChunkInfoType::VECTOR_INFO);
 	return vector_info[vector_idx]->Cast<ChunkVectorInfo>();
@@ -165,7 +176,38 @@ void RowVersionManager::CommitDelete(idx_t vector_idx, transaction_t commit_id,
 	GetVectorInfo(vector_idx).CommitDelete(commit_id, info);
 }
 
-vector<MetaBlockPointer> RowVersionManager::Checkpoint(MetadataManager &manager) {
+void RowVersionManager::CompactCommittedVersions(transaction_t lowest_active_start) {
+	// transaction ids of uncommitted changes are never visible to everyone
+	auto visible_to_all = MinValue<transaction_t>(lowest_active_start, TRANSACTION_ID_START);
+	lock_guard<mutex> lock(version_lock);
+	for (idx_t vector_idx = 0; vector_idx < Storage::ROW_GROUP_VECTOR_COUNT; vector_idx++) {
+		auto &info = vector_info[vector_idx];
+		if (!info || info->type != ChunkInfoType::VECTOR_INFO) {
+			continue;
+		}
+		auto &vector = info->Cast<ChunkVectorInfo>();
+		if (!vector.IsCommitted(visible_to_all)) {
+			// there are transactions that might still see a different version of this vector
+			continue;
+		}
+		if (!vector.any_deleted) {
+			// all rows are inserted and visible - we don't need any version info
+			info.reset();
+			continue;
+		}
+		ValidityMask visible_mask(STANDARD_VECTOR_SIZE);
+		visible_mask.Initialize(STANDARD_VECTOR_SIZE);
+		for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
+			if (vector.deleted[i] != NOT_DELETED_ID) {
+				visible_mask.SetInvalid(i);
+			}
+		}
+		auto vector_start = vector.start;
+		info = make_uniq<ChunkBitmapInfo>(vector_start, visible_mask);
+	}
+}
+
+vector<MetaBlockPointer> RowVersionManager::Checkpoint(MetadataManager &manager, transaction_t lowest_active_start) {
 	if (!has_changes && !storage_pointers.empty()) {
 		// the row version manager already exists on disk and no changes were made
 		// we can write the current pointer as-is
@@ -174,6 +216,8 @@ vector<MetaBlockPointer> RowVersionManager::Checkpoint(MetadataManager &manager)
 		// return the root pointer
 		return storage_pointers;
 	}
+	// replace the versions that every transaction agrees on with compact deletion bitmaps
+	CompactCommittedVersions(lowest_active_start);
 	// first count how many ChunkInfo's we need to deserialize
 	vector<pair<idx_t, reference<ChunkInfo>>> to_serialize;
 	for (idx_t vector_idx = 0; vector_idx < Storage::ROW_GROUP_VECTOR_COUNT; vector_idx++) {
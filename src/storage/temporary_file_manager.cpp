@@ -1,6 +1,9 @@
 #include "duckdb/storage/temporary_file_manager.hpp"
+#include "duckdb/common/enum_util.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/storage/buffer/temporary_file_information.hpp"
 #include "duckdb/storage/standard_buffer_manager.hpp"
+#include "zstd.h"
 
 namespace duckdb {
 
@@ -8,10 +11,11 @@ namespace duckdb {
 // BlockIndexManager
 //===--------------------------------------------------------------------===//
 
-BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager) : max_index(0), manager(&manager) {
+BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager, idx_t block_size)
+    : max_index(0), manager(&manager), block_size(block_size) {
 }
 
-BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr) {
+BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr), block_size(0) {
 }
 
 idx_t BlockIndexManager::GetNewBlockIndex() {
@@ -58,7 +62,6 @@ bool BlockIndexManager::HasFreeBlocks() {
 }
 
 void BlockIndexManager::SetMaxIndex(idx_t new_index) {
-	static constexpr idx_t TEMPFILE_BLOCK_SIZE = Storage::BLOCK_ALLOC_SIZE;
 	if (!manager) {
 		max_index = new_index;
 	} else {
@@ -66,11 +69,11 @@ void BlockIndexManager::SetMaxIndex(idx_t new_index) {
 		if (new_index < old) {
 			max_index = new_index;
 			auto difference = old - new_index;
-			auto size_on_disk = difference * TEMPFILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->DecreaseSizeOnDisk(size_on_disk);
 		} else if (new_index > old) {
 			auto difference = new_index - old;
-			auto size_on_disk = difference * TEMPFILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->IncreaseSizeOnDisk(size_on_disk);
 			// Increase can throw, so this is only updated after it was succesfully updated
 			max_index = new_index;
@@ -94,11 +97,18 @@ idx_t BlockIndexManager::GetNewBlockIndexInternal() {
 // TemporaryFileHandle
 //===--------------------------------------------------------------------===//
 
+static string GetTemporaryFileName(TemporaryBufferSize size, idx_t index) {
+	if (size == TemporaryBufferSize::DEFAULT) {
+		return "duckdb_temp_storage-" + to_string(index) + ".tmp";
+	}
+	return "duckdb_temp_storage_" + EnumUtil::ToString(size) + "-" + to_string(index) + ".tmp";
+}
+
 TemporaryFileHandle::TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory,
-                                         idx_t index, TemporaryFileManager &manager)
-    : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), db(db), file_index(index),
-      path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, "duckdb_temp_storage-" + to_string(index) + ".tmp")),
-      index_manager(manager) {
+                                         TemporaryBufferSize size, idx_t index, TemporaryFileManager &manager)
+    : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), db(db), size(size), file_index(index),
+      path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, GetTemporaryFileName(size, index))),
+      index_manager(manager, static_cast<idx_t>(size)), buffer_count(0), compressed_bytes(0) {
 }
 
 TemporaryFileHandle::TemporaryFileLock::TemporaryFileLock(mutex &mutex) : lock(mutex) {
@@ -114,26 +124,54 @@ TemporaryFileIndex TemporaryFileHandle::TryGetBlockIndex() {
 	CreateFileIfNotExists(lock);
 	// fetch a new block index to write to
 	auto block_index = index_manager.GetNewBlockIndex();
-	return TemporaryFileIndex(file_index, block_index);
+	return TemporaryFileIndex(file_index, block_index, size);
 }
 
-void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index) {
+void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index,
+                                             AllocatedData &compressed_buffer) {
 	D_ASSERT(buffer.size == Storage::BLOCK_SIZE);
-	buffer.Write(*handle, GetPositionInFile(index.block_index));
+	D_ASSERT(index.size == size);
+	if (size == TemporaryBufferSize::DEFAULT) {
+		buffer.Write(*handle, GetPositionInFile(index.block_index));
+	} else {
+		D_ASSERT(compressed_buffer.GetSize() >= static_cast<idx_t>(size));
+		handle->Write(compressed_buffer.get(), static_cast<idx_t>(size), GetPositionInFile(index.block_index));
+	}
+	TemporaryFileLock lock(file_lock);
+	buffer_count++;
+	compressed_bytes += index.compressed_size;
 }
 
-unique_ptr<FileBuffer> TemporaryFileHandle::ReadTemporaryBuffer(idx_t block_index,
+unique_ptr<FileBuffer> TemporaryFileHandle::ReadTemporaryBuffer(TemporaryFileIndex index,
                                                                 unique_ptr<FileBuffer> reusable_buffer) {
-	return StandardBufferManager::ReadTemporaryBufferInternal(BufferManager::GetBufferManager(db), *handle,
-	                                                          GetPositionInFile(block_index), Storage::BLOCK_SIZE,
-	                                                          std::move(reusable_buffer));
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	if (size == TemporaryBufferSize::DEFAULT) {
+		return StandardBufferManager::ReadTemporaryBufferInternal(buffer_manager, *handle,
+		                                                          GetPositionInFile(index.block_index),
+		                                                          Storage::BLOCK_SIZE, std::move(reusable_buffer));
+	}
+	// read the slot: the compressed size, followed by the compressed buffer
+	auto compressed_buffer = Allocator::Get(db).Allocate(static_cast<idx_t>(size));
+	handle->Read(compressed_buffer.get(), static_cast<idx_t>(size), GetPositionInFile(index.block_index));
+	auto compressed_size = Load<idx_t>(compressed_buffer.get());
+	D_ASSERT(sizeof(idx_t) + compressed_size == index.compressed_size);
+
+	auto buffer = buffer_manager.ConstructManagedBuffer(Storage::BLOCK_SIZE, std::move(reusable_buffer));
+	auto decompressed_size = duckdb_zstd::ZSTD_decompress(buffer->buffer, buffer->size,
+	                                                      compressed_buffer.get() + sizeof(idx_t), compressed_size);
+	if (duckdb_zstd::ZSTD_isError(decompressed_size) || decompressed_size != Storage::BLOCK_SIZE) {
+		throw IOException("Failed to decompress buffer from temporary file \"%s\"", path);
+	}
+	return buffer;
 }
 
-void TemporaryFileHandle::EraseBlockIndex(block_id_t block_index) {
+void TemporaryFileHandle::EraseBlockIndex(TemporaryFileIndex index) {
 	// remove the block (and potentially truncate the temp file)
 	TemporaryFileLock lock(file_lock);
 	D_ASSERT(handle);
-	RemoveTempBlockIndex(lock, NumericCast<idx_t>(block_index));
+	RemoveTempBlockIndex(lock, index.block_index);
+	buffer_count--;
+	compressed_bytes -= index.compressed_size;
 }
 
 bool TemporaryFileHandle::DeleteIfEmpty() {
@@ -154,6 +192,8 @@ TemporaryFileInformation TemporaryFileHandle::GetTemporaryFile() {
 	TemporaryFileInformation info;
 	info.path = path;
 	info.size = GetPositionInFile(index_manager.GetMaxIndex());
+	info.uncompressed_size = buffer_count * Storage::BLOCK_ALLOC_SIZE;
+	info.compressed_size = compressed_bytes;
 	return info;
 }
 
@@ -180,7 +220,7 @@ void TemporaryFileHandle::RemoveTempBlockIndex(TemporaryFileLock &, idx_t index)
 }
 
 idx_t TemporaryFileHandle::GetPositionInFile(idx_t index) {
-	return index * Storage::BLOCK_ALLOC_SIZE;
+	return index * static_cast<idx_t>(size);
 }
 
 //===--------------------------------------------------------------------===//
@@ -239,8 +279,8 @@ TemporaryFileManager &TemporaryDirectoryHandle::GetTempFile() {
 // TemporaryFileIndex
 //===--------------------------------------------------------------------===//
 
-TemporaryFileIndex::TemporaryFileIndex(idx_t file_index, idx_t block_index)
-    : file_index(file_index), block_index(block_index) {
+TemporaryFileIndex::TemporaryFileIndex(idx_t file_index, idx_t block_index, TemporaryBufferSize size)
+    : file_index(file_index), block_index(block_index), size(size), compressed_size(static_cast<idx_t>(size)) {
 }
 
 bool TemporaryFileIndex::IsValid() const {
@@ -276,16 +316,59 @@ TemporaryFileManager::~TemporaryFileManager() {
 TemporaryFileManager::TemporaryManagerLock::TemporaryManagerLock(mutex &mutex) : lock(mutex) {
 }
 
+//! The slot sizes that compressed buffers can be stored in, from small to large
+static constexpr const TemporaryBufferSize COMPRESSED_BUFFER_SIZES[] = {
+    TemporaryBufferSize::S32K,  TemporaryBufferSize::S64K,  TemporaryBufferSize::S96K, TemporaryBufferSize::S128K,
+    TemporaryBufferSize::S160K, TemporaryBufferSize::S192K, TemporaryBufferSize::S224K};
+//! The ZSTD compression level for temporary buffers - we prefer speed over compression ratio
+static constexpr const int TEMPORARY_BUFFER_COMPRESSION_LEVEL = -1;
+
+TemporaryBufferSize TemporaryFileManager::CompressBuffer(FileBuffer &buffer, AllocatedData &compressed_buffer,
+                                                         idx_t &compressed_size) {
+	compressed_size = Storage::BLOCK_ALLOC_SIZE;
+	if (!DBConfig::GetConfig(db).options.temp_file_compression) {
+		return TemporaryBufferSize::DEFAULT;
+	}
+	// compress into the largest slot that is smaller than a block, after the compressed size
+	// if the compressed buffer does not fit, compression does not pay off and we write the buffer uncompressed
+	const auto max_size = static_cast<idx_t>(TemporaryBufferSize::S224K);
+	compressed_buffer = Allocator::Get(db).Allocate(max_size);
+	auto result = duckdb_zstd::ZSTD_compress(compressed_buffer.get() + sizeof(idx_t), max_size - sizeof(idx_t),
+	                                         buffer.buffer, buffer.size, TEMPORARY_BUFFER_COMPRESSION_LEVEL);
+	if (duckdb_zstd::ZSTD_isError(result)) {
+		compressed_buffer.Reset();
+		return TemporaryBufferSize::DEFAULT;
+	}
+	Store<idx_t>(result, compressed_buffer.get());
+	compressed_size = sizeof(idx_t) + result;
+	// write the buffer to the smallest slot that it fits in
+	for (auto &size : COMPRESSED_BUFFER_SIZES) {
+		if (compressed_size <= static_cast<idx_t>(size)) {
+			return size;
+		}
+	}
+	throw InternalException("Compressed temporary buffer does not fit in any slot");
+}
+
 void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer) {
 	D_ASSERT(buffer.size == Storage::BLOCK_SIZE);
+	// compress the buffer outside of the lock
+	AllocatedData compressed_buffer;
+	idx_t compressed_size;
+	auto size = CompressBuffer(buffer, compressed_buffer, compressed_size);
+
 	TemporaryFileIndex index;
 	TemporaryFileHandle *handle = nullptr;
-
 	{
 		TemporaryManagerLock lock(manager_lock);
-		// first check if we can write to an open existing file
+		// first check if we can write to an open existing file with the right slot size
+		idx_t file_count = 0;
 		for (auto &entry : files) {
 			auto &temp_file = entry.second;
+			if (temp_file->GetSize() != size) {
+				continue;
+			}
+			file_count++;
 			index = temp_file->TryGetBlockIndex();
 			if (index.IsValid()) {
 				handle = entry.second.get();
@@ -295,18 +378,20 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 		if (!handle) {
 			// no existing handle to write to; we need to create & open a new file
 			auto new_file_index = index_manager.GetNewBlockIndex();
-			auto new_file = make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, *this);
+			auto new_file =
+			    make_uniq<TemporaryFileHandle>(file_count, db, temp_directory, size, new_file_index, *this);
 			handle = new_file.get();
 			files[new_file_index] = std::move(new_file);
 
 			index = handle->TryGetBlockIndex();
 		}
+		index.compressed_size = compressed_size;
 		D_ASSERT(used_blocks.find(block_id) == used_blocks.end());
 		used_blocks[block_id] = index;
 	}
 	D_ASSERT(handle);
 	D_ASSERT(index.IsValid());
-	handle->WriteTemporaryFile(buffer, index);
+	handle->WriteTemporaryFile(buffer, index, compressed_buffer);
 }
 
 bool TemporaryFileManager::HasTemporaryBuffer(block_id_t block_id) {
@@ -372,7 +457,7 @@ unique_ptr<FileBuffer> TemporaryFileManager::ReadTemporaryBuffer(block_id_t id,
 		index = GetTempBlockIndex(lock, id);
 		handle = GetFileHandle(lock, index.file_index);
 	}
-	auto buffer = handle->ReadTemporaryBuffer(index.block_index, std::move(reusable_buffer));
+	auto buffer = handle->ReadTemporaryBuffer(index, std::move(reusable_buffer));
 	{
 		// remove the block (and potentially erase the temp file)
 		TemporaryManagerLock lock(manager_lock);
@@ -404,7 +489,7 @@ void TemporaryFileManager::EraseUsedBlock(TemporaryManagerLock &lock, block_id_t
 		throw InternalException("EraseUsedBlock - Block %llu not found in used blocks", id);
 	}
 	used_blocks.erase(entry);
-	handle->EraseBlockIndex(NumericCast<block_id_t>(index.block_index));
+	handle->EraseBlockIndex(index);
 	if (handle->DeleteIfEmpty()) {
 		EraseFileHandle(lock, index.file_index);
 	}
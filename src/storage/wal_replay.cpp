@@ -28,6 +28,12 @@
 #include "duckdb/main/config.hpp"
 #include "duckdb/storage/table/delete_state.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
+#include "duckdb/common/reference_map.hpp"
+#include "duckdb/common/thread.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/storage/optimistic_data_writer.hpp"
+#include "duckdb/storage/table/row_group_collection.hpp"
+#include "duckdb/storage/table_io_manager.hpp"
 
 namespace duckdb {
 
@@ -44,27 +50,16 @@ public:
 	idx_t wal_version = 1;
 };
 
-class WriteAheadLogDeserializer {
-public:
-	WriteAheadLogDeserializer(ReplayState &state_p, BufferedFileReader &stream_p, bool deserialize_only = false)
-	    : state(state_p), db(state.db), context(state.context), catalog(state.catalog), data(nullptr),
-	      stream(nullptr, 0), deserializer(stream_p), deserialize_only(deserialize_only) {
-	}
-	WriteAheadLogDeserializer(ReplayState &state_p, unique_ptr<data_t[]> data_p, idx_t size,
-	                          bool deserialize_only = false)
-	    : state(state_p), db(state.db), context(state.context), catalog(state.catalog), data(std::move(data_p)),
-	      stream(data.get(), size), deserializer(stream), deserialize_only(deserialize_only) {
-	}
+//! A WAL entry that has been read from the file and checksummed, but not deserialized yet
+struct WALReplayEntry {
+	unique_ptr<data_t[]> data;
+	idx_t size = 0;
 
-	static WriteAheadLogDeserializer Open(ReplayState &state_p, BufferedFileReader &stream,
-	                                      bool deserialize_only = false) {
-		if (state_p.wal_version == 1) {
-			// old WAL versions do not have checksums
-			return WriteAheadLogDeserializer(state_p, stream, deserialize_only);
-		}
-		if (state_p.wal_version != 2) {
-			throw IOException("Failed to read WAL of version %llu - can only read version 1 and 2",
-			                  state_p.wal_version);
+public:
+	//! Reads the next entry of a WAL of version 2 or higher, where every entry is prefixed with its size and checksum
+	static WALReplayEntry Read(ReplayState &state, BufferedFileReader &stream) {
+		if (state.wal_version != 2) {
+			throw IOException("Failed to read WAL of version %llu - can only read version 1 and 2", state.wal_version);
 		}
 		// read the checksum and size
 		auto size = stream.Read<uint64_t>();
@@ -80,18 +75,63 @@ public:
 		}
 
 		// allocate a buffer and read data into the buffer
-		auto buffer = unique_ptr<data_t[]>(new data_t[size]);
-		stream.ReadData(buffer.get(), size);
+		WALReplayEntry entry;
+		entry.data = unique_ptr<data_t[]>(new data_t[size]);
+		entry.size = size;
+		stream.ReadData(entry.data.get(), size);
 
 		// compute and verify the checksum
-		auto computed_checksum = Checksum(buffer.get(), size);
+		auto computed_checksum = Checksum(entry.data.get(), size);
 		if (stored_checksum != computed_checksum) {
 			throw SerializationException(
 			    "Corrupt WAL file: entry at byte position %llu computed checksum %llu does not match "
 			    "stored checksum %llu",
 			    offset, computed_checksum, stored_checksum);
 		}
-		return WriteAheadLogDeserializer(state_p, std::move(buffer), size, deserialize_only);
+		return entry;
+	}
+
+	//! Reads the type of the entry without deserializing the rest of it
+	WALType GetType() const {
+		MemoryStream stream(data.get(), size);
+		BinaryDeserializer deserializer(stream);
+		deserializer.Begin();
+		return deserializer.ReadProperty<WALType>(100, "wal_type");
+	}
+
+	//! Deserializes the chunk of an INSERT_TUPLE entry
+	void DeserializeInsert(DataChunk &chunk) const {
+		MemoryStream stream(data.get(), size);
+		BinaryDeserializer deserializer(stream);
+		deserializer.Begin();
+		auto wal_type = deserializer.ReadProperty<WALType>(100, "wal_type");
+		D_ASSERT(wal_type == WALType::INSERT_TUPLE);
+		(void)wal_type;
+		deserializer.ReadObject(101, "chunk", [&](Deserializer &object) { chunk.Deserialize(object); });
+		deserializer.End();
+	}
+};
+
+class WriteAheadLogDeserializer {
+public:
+	WriteAheadLogDeserializer(ReplayState &state_p, BufferedFileReader &stream_p, bool deserialize_only = false)
+	    : state(state_p), db(state.db), context(state.context), catalog(state.catalog), data(nullptr),
+	      stream(nullptr, 0), deserializer(stream_p), deserialize_only(deserialize_only) {
+	}
+	WriteAheadLogDeserializer(ReplayState &state_p, unique_ptr<data_t[]> data_p, idx_t size,
+	                          bool deserialize_only = false)
+	    : state(state_p), db(state.db), context(state.context), catalog(state.catalog), data(std::move(data_p)),
+	      stream(data.get(), size), deserializer(stream), deserialize_only(deserialize_only) {
+	}
+
+	static WriteAheadLogDeserializer Open(ReplayState &state_p, BufferedFileReader &stream,
+	                                      bool deserialize_only = false) {
+		if (state_p.wal_version == 1) {
+			// old WAL versions do not have checksums
+			return WriteAheadLogDeserializer(state_p, stream, deserialize_only);
+		}
+		auto entry = WALReplayEntry::Read(state_p, stream);
+		return WriteAheadLogDeserializer(state_p, std::move(entry.data), entry.size, deserialize_only);
 	}
 
 	bool ReplayEntry() {
@@ -158,6 +198,262 @@ private:
 	bool deserialize_only;
 };
 
+//===--------------------------------------------------------------------===//
+// Parallel Insert Replay
+//===--------------------------------------------------------------------===//
+//! The buffered inserts into a single table
+struct WALTableInserts {
+	explicit WALTableInserts(TableCatalogEntry &table) : table(table) {
+	}
+
+	TableCatalogEntry &table;
+	//! The INSERT_TUPLE entries in WAL order
+	vector<WALReplayEntry> entries;
+	//! The number of entries that belong to completely read WAL transactions
+	idx_t complete_count = 0;
+	//! The deserialized chunks of the entries that are being replayed
+	vector<unique_ptr<DataChunk>> chunks;
+	//! The row group collections that are built from the chunks, each holding (at most) one row group
+	vector<unique_ptr<RowGroupCollection>> collections;
+	vector<optional_ptr<OptimisticDataWriter>> writers;
+};
+
+//! Buffers the inserts of the WAL and replays them in parallel: the entries are deserialized by tasks, after which the
+//! row groups of every table are built by tasks that each fill a single row group. The row groups are then merged into
+//! the transaction-local storage in WAL order.
+class WALInsertBatch {
+public:
+	//! The amount of buffered inserts after which they are replayed (even if the WAL transaction is incomplete)
+	static constexpr const idx_t MAXIMUM_BATCH_SIZE = 64ULL * 1024ULL * 1024ULL;
+	//! The amount of entries deserialized by a single task
+	static constexpr const idx_t DESERIALIZE_TASK_SIZE = 1024ULL * 1024ULL;
+
+public:
+	explicit WALInsertBatch(ReplayState &state)
+	    : state(state), scheduler(TaskScheduler::GetScheduler(state.context)), executor(scheduler) {
+	}
+
+	void AddInsert(TableCatalogEntry &table, WALReplayEntry entry) {
+		auto entry_table = table_map.find(table);
+		if (entry_table == table_map.end()) {
+			table_map[table] = tables.size();
+			tables.push_back(make_uniq<WALTableInserts>(table));
+			entry_table = table_map.find(table);
+		}
+		batch_size += entry.size;
+		tables[entry_table->second]->entries.push_back(std::move(entry));
+	}
+	//! Marks the buffered inserts as belonging to completely read WAL transactions
+	void MarkComplete() {
+		for (auto &table : tables) {
+			table->complete_count = table->entries.size();
+		}
+		complete_size = batch_size;
+	}
+	bool HasCompleteInserts() const {
+		return complete_size > 0;
+	}
+	idx_t BatchSize() const {
+		return batch_size;
+	}
+	//! Replays the buffered inserts - or only those of completely read WAL transactions - into the replay transaction
+	void Replay(bool complete_only);
+	bool HasError() {
+		return executor.HasError();
+	}
+
+private:
+	//! Executes the scheduled tasks (together with the task scheduler) until all of them are finished
+	void WorkOnTasks();
+
+private:
+	ReplayState &state;
+	TaskScheduler &scheduler;
+	vector<unique_ptr<WALTableInserts>> tables;
+	reference_map_t<TableCatalogEntry, idx_t> table_map;
+	//! The total size of the buffered entries
+	idx_t batch_size = 0;
+	//! The size of the buffered entries that belong to completely read WAL transactions
+	idx_t complete_size = 0;
+	//! Executes the deserialize and build tasks
+	TaskExecutor executor;
+};
+
+class WALDeserializeTask : public BaseExecutorTask {
+public:
+	WALDeserializeTask(TaskExecutor &executor, WALTableInserts &inserts, idx_t start, idx_t end)
+	    : BaseExecutorTask(executor), inserts(inserts), start(start), end(end) {
+	}
+
+	void ExecuteTask() override {
+		for (idx_t i = start; i < end; i++) {
+			inserts.chunks[i] = make_uniq<DataChunk>();
+			inserts.entries[i].DeserializeInsert(*inserts.chunks[i]);
+		}
+	}
+
+private:
+	WALTableInserts &inserts;
+	idx_t start;
+	idx_t end;
+};
+
+class WALBuildRowGroupTask : public BaseExecutorTask {
+public:
+	WALBuildRowGroupTask(TaskExecutor &executor, WALTableInserts &inserts, idx_t collection_idx)
+	    : BaseExecutorTask(executor), inserts(inserts), collection_idx(collection_idx) {
+	}
+
+	void ExecuteTask() override {
+		auto &collection = *inserts.collections[collection_idx];
+		auto &writer = *inserts.writers[collection_idx];
+		// find the chunks that contain the rows of our row group
+		idx_t row_start = collection_idx * Storage::ROW_GROUP_SIZE;
+		idx_t row_end = row_start + Storage::ROW_GROUP_SIZE;
+
+		TableAppendState append_state;
+		collection.InitializeAppend(append_state);
+		DataChunk slice;
+		slice.InitializeEmpty(collection.GetTypes());
+		idx_t chunk_start = 0;
+		for (auto &chunk_ptr : inserts.chunks) {
+			auto &chunk = *chunk_ptr;
+			idx_t chunk_end = chunk_start + chunk.size();
+			if (chunk_end > row_start && chunk_start < row_end) {
+				// the chunk overlaps with the row group - reference the part of the chunk that falls into it
+				// other tasks might reference the same chunk, so we cannot slice the chunk itself
+				auto offset = MaxValue<idx_t>(row_start, chunk_start) - chunk_start;
+				auto count = MinValue<idx_t>(row_end, chunk_end) - chunk_start - offset;
+				slice.Reference(chunk);
+				if (offset > 0 || count < chunk.size()) {
+					slice.Slice(offset, count);
+				}
+				collection.Append(slice, append_state);
+			}
+			chunk_start = chunk_end;
+			if (chunk_start >= row_end) {
+				break;
+			}
+		}
+		collection.FinalizeAppend(TransactionData(0, 0), append_state);
+		if (collection.GetTotalRows() == Storage::ROW_GROUP_SIZE) {
+			// the row group is complete: write it to disk already
+			writer.WriteLastRowGroup(collection);
+		}
+	}
+
+private:
+	WALTableInserts &inserts;
+	idx_t collection_idx;
+};
+
+void WALInsertBatch::WorkOnTasks() {
+#ifndef DUCKDB_NO_THREADS
+	// the scheduler threads are only launched after the database has been loaded, as they race on the catalog
+	// otherwise - when replaying the WAL at startup, we launch threads that only help with the tasks of this batch
+	vector<unique_ptr<thread>> helpers;
+	auto &config = DBConfig::GetConfig(state.context);
+	auto thread_count = NumericCast<idx_t>(scheduler.NumberOfThreads());
+	for (idx_t i = thread_count; i < config.options.maximum_threads; i++) {
+		helpers.push_back(make_uniq<thread>([&]() {
+			shared_ptr<Task> task;
+			while (executor.GetTask(task)) {
+				task->Execute(TaskExecutionMode::PROCESS_ALL);
+				task.reset();
+			}
+		}));
+	}
+	// the helpers stop once all tasks have been picked up - join them before we throw any error
+	ErrorData error;
+	try {
+		executor.WorkOnTasks();
+	} catch (std::exception &ex) {
+		error = ErrorData(ex);
+	}
+	for (auto &helper : helpers) {
+		helper->join();
+	}
+	if (error.HasError()) {
+		error.Throw();
+	}
+#else
+	executor.WorkOnTasks();
+#endif
+}
+
+void WALInsertBatch::Replay(bool complete_only) {
+	// deserialize the entries
+	for (auto &inserts : tables) {
+		auto entry_count = complete_only ? inserts->complete_count : inserts->entries.size();
+		inserts->chunks.resize(entry_count);
+		idx_t task_start = 0;
+		idx_t task_size = 0;
+		for (idx_t i = 0; i < entry_count; i++) {
+			task_size += inserts->entries[i].size;
+			if (task_size >= DESERIALIZE_TASK_SIZE || i + 1 == entry_count) {
+				executor.ScheduleTask(make_uniq<WALDeserializeTask>(executor, *inserts, task_start, i + 1));
+				task_start = i + 1;
+				task_size = 0;
+			}
+		}
+	}
+	WorkOnTasks();
+
+	// build the row groups of every table
+	for (auto &inserts : tables) {
+		idx_t row_count = 0;
+		for (auto &chunk : inserts->chunks) {
+			row_count += chunk->size();
+		}
+		auto &storage = inserts->table.GetStorage();
+		auto &block_manager = TableIOManager::Get(storage).GetBlockManagerForRowData();
+		// every task builds a single row group, so that all but the last row group are complete
+		auto row_group_count = (row_count + Storage::ROW_GROUP_SIZE - 1) / Storage::ROW_GROUP_SIZE;
+		for (idx_t i = 0; i < row_group_count; i++) {
+			auto collection = make_uniq<RowGroupCollection>(storage.GetDataTableInfo(), block_manager,
+			                                                storage.GetTypes(), NumericCast<idx_t>(MAX_ROW_ID));
+			collection->InitializeEmpty();
+			inserts->collections.push_back(std::move(collection));
+			inserts->writers.push_back(&storage.CreateOptimisticWriter(state.context));
+			executor.ScheduleTask(make_uniq<WALBuildRowGroupTask>(executor, *inserts, i));
+		}
+	}
+	WorkOnTasks();
+
+	// merge the row groups into the transaction-local storage in WAL order
+	for (auto &inserts : tables) {
+		auto &storage = inserts->table.GetStorage();
+		for (auto &collection : inserts->collections) {
+			storage.LocalMerge(state.context, *collection);
+		}
+		for (auto &writer : inserts->writers) {
+			storage.FinalizeOptimisticWriter(state.context, *writer);
+		}
+		inserts->collections.clear();
+		inserts->writers.clear();
+		inserts->chunks.clear();
+
+		// remove the replayed entries
+		auto replayed_count = complete_only ? inserts->complete_count : inserts->entries.size();
+		inserts->entries.erase(inserts->entries.begin(),
+		                       inserts->entries.begin() + NumericCast<int64_t>(replayed_count));
+		inserts->complete_count = 0;
+	}
+	batch_size -= complete_only ? complete_size : batch_size;
+	complete_size = 0;
+
+	// only keep track of the tables that still have buffered inserts
+	vector<unique_ptr<WALTableInserts>> remaining_tables;
+	table_map.clear();
+	for (auto &inserts : tables) {
+		if (!inserts->entries.empty()) {
+			table_map[inserts->table] = remaining_tables.size();
+			remaining_tables.push_back(std::move(inserts));
+		}
+	}
+	tables = std::move(remaining_tables);
+}
+
 //===--------------------------------------------------------------------===//
 // Replay
 //===--------------------------------------------------------------------===//
@@ -179,15 +475,26 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 	ReplayState checkpoint_state(database, *con.context);
 	try {
 		while (true) {
-			// read the current entry (deserialize only)
-			auto deserializer = WriteAheadLogDeserializer::Open(checkpoint_state, reader, true);
-			if (deserializer.ReplayEntry()) {
-				// check if the file is exhausted
-				if (reader.Finished()) {
-					// we finished reading the file: break
-					break;
+			bool flushed;
+			if (checkpoint_state.wal_version == 1) {
+				// read the current entry (deserialize only)
+				auto deserializer = WriteAheadLogDeserializer::Open(checkpoint_state, reader, true);
+				flushed = deserializer.ReplayEntry();
+			} else {
+				// only the checkpoint entries have to be deserialized
+				auto entry = WALReplayEntry::Read(checkpoint_state, reader);
+				auto entry_type = entry.GetType();
+				flushed = entry_type == WALType::WAL_FLUSH;
+				if (entry_type == WALType::CHECKPOINT) {
+					WriteAheadLogDeserializer deserializer(checkpoint_state, std::move(entry.data), entry.size, true);
+					deserializer.ReplayEntry();
 				}
 			}
+			// check if the file is exhausted
+			if (flushed && reader.Finished()) {
+				// we finished reading the file: break
+				break;
+			}
 		}
 	} catch (std::exception &ex) { // LCOV_EXCL_START
 		ErrorData error(ex);
@@ -212,34 +519,97 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 	// reset the reader - we are going to read the WAL from the beginning again
 	reader.Reset();
 
+	auto commit_transaction = [&]() {
+		con.Commit();
+		con.BeginTransaction();
+		MetaTransaction::Get(*con.context).ModifyDatabase(database);
+	};
+
 	// replay the WAL
+	// inserts are buffered and replayed in parallel, and consecutive WAL transactions that only insert data are
+	// replayed together in a single transaction. any other entry is replayed in order: it first replays the inserts
+	// that precede it, and commits the preceding WAL transactions if they are still buffered.
+	WALInsertBatch inserts(state);
+	// whether or not entries of the WAL transaction that is being read have been replayed already
+	bool partially_replayed = false;
 	// note that everything is wrapped inside a try/catch block here
 	// there can be errors in WAL replay because of a corrupt WAL file
 	try {
 		while (true) {
 			// read the current entry
-			auto deserializer = WriteAheadLogDeserializer::Open(state, reader);
-			if (deserializer.ReplayEntry()) {
-				con.Commit();
-				// check if the file is exhausted
-				if (reader.Finished()) {
-					// we finished reading the file: break
-					break;
+			bool flushed;
+			if (state.wal_version == 1) {
+				// the entries of old WAL versions are not framed - they are replayed one by one
+				auto deserializer = WriteAheadLogDeserializer::Open(state, reader);
+				flushed = deserializer.ReplayEntry();
+				partially_replayed = true;
+			} else {
+				auto entry = WALReplayEntry::Read(state, reader);
+				auto entry_type = entry.GetType();
+				flushed = entry_type == WALType::WAL_FLUSH;
+				if (entry_type == WALType::INSERT_TUPLE && state.current_table) {
+					inserts.AddInsert(*state.current_table, std::move(entry));
+					if (inserts.BatchSize() >= WALInsertBatch::MAXIMUM_BATCH_SIZE) {
+						// the WAL transaction does not fit into the batch: start replaying it
+						if (inserts.HasCompleteInserts()) {
+							inserts.Replay(true);
+							commit_transaction();
+						}
+						inserts.Replay(false);
+						partially_replayed = true;
+					}
+					continue;
 				}
-				con.BeginTransaction();
-				MetaTransaction::Get(*con.context).ModifyDatabase(database);
+				if (!flushed) {
+					if (entry_type != WALType::USE_TABLE) {
+						if (inserts.HasCompleteInserts()) {
+							inserts.Replay(true);
+							commit_transaction();
+						}
+						inserts.Replay(false);
+						partially_replayed = true;
+					}
+					WriteAheadLogDeserializer deserializer(state, std::move(entry.data), entry.size);
+					deserializer.ReplayEntry();
+				}
+			}
+			if (!flushed) {
+				continue;
+			}
+			// we have read a complete WAL transaction
+			if (reader.Finished()) {
+				// we finished reading the file: replay the remaining inserts and break
+				inserts.Replay(false);
+				con.Commit();
+				break;
+			}
+			if (partially_replayed || inserts.BatchSize() >= WALInsertBatch::MAXIMUM_BATCH_SIZE) {
+				inserts.Replay(false);
+				commit_transaction();
+				partially_replayed = false;
+			} else {
+				// keep on buffering the inserts of the next WAL transaction
+				inserts.MarkComplete();
 			}
 		}
 	} catch (std::exception &ex) { // LCOV_EXCL_START
-		// exception thrown in WAL replay: rollback
-		con.Query("ROLLBACK");
 		ErrorData error(ex);
 		// serialization failure means a truncated WAL
 		// these failures are ignored unless abort_on_wal_failure is true
 		// other failures always result in an error
-		if (config.options.abort_on_wal_failure || error.Type() != ExceptionType::SERIALIZATION) {
+		if (config.options.abort_on_wal_failure || error.Type() != ExceptionType::SERIALIZATION ||
+		    inserts.HasError()) {
+			// exception thrown in WAL replay: rollback
+			con.Query("ROLLBACK");
 			error.Throw("Failure while replaying WAL file \"" + wal_path + "\": ");
 		}
+		// the WAL is truncated: rollback the incomplete WAL transaction, but replay the buffered complete ones
+		if (!partially_replayed && inserts.HasCompleteInserts()) {
+			inserts.Replay(true);
+			con.Commit();
+		} else {
+			con.Query("ROLLBACK");
+		}
 	} catch (...) {
 		// exception thrown in WAL replay: rollback
 		con.Query("ROLLBACK");
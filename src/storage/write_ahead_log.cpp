@@ -15,13 +15,19 @@
 #include "duckdb/storage/table_io_manager.hpp"
 #include "duckdb/common/checksum.hpp"
 #include "duckdb/common/serializer/memory_stream.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/storage/storage_manager.hpp"
+
+#include <chrono>
+#include <thread>
 
 namespace duckdb {
 
 const uint64_t WAL_VERSION_NUMBER = 2;
 
 WriteAheadLog::WriteAheadLog(AttachedDatabase &database, const string &wal_path)
-    : skip_writing(false), database(database), wal_path(wal_path) {
+    : skip_writing(false), database(database), wal_path(wal_path), written_commits(0), synced_commits(0),
+      sync_in_progress(false) {
 }
 
 WriteAheadLog::~WriteAheadLog() {
@@ -414,4 +420,62 @@ void WriteAheadLog::Flush() {
 	writer->Sync();
 }
 
+idx_t WriteAheadLog::WriteCommit() {
+	D_ASSERT(writer);
+	D_ASSERT(!skip_writing);
+
+	// write an empty entry
+	WriteAheadLogSerializer serializer(*this, WALType::WAL_FLUSH);
+	serializer.End();
+
+	// hand the entries over to the file system - they are synced by SyncCommit after the transaction lock is released
+	writer->Flush();
+	return ++written_commits;
+}
+
+void WriteAheadLog::SyncCommit(idx_t commit_sequence) {
+	unique_lock<mutex> guard(sync_lock);
+	while (synced_commits < commit_sequence) {
+		if (!sync_error.empty()) {
+			// a failed sync might have dropped the written pages - syncing again does not make them durable
+			throw FatalException("Failed to sync the WAL: %s", sync_error);
+		}
+		if (sync_in_progress) {
+			// wait for the running sync - it might already include our commit
+			sync_finished.wait(guard);
+			continue;
+		}
+		// we lead the next group: sync the WAL for every commit that has been written so far
+		sync_in_progress = true;
+		guard.unlock();
+
+		auto commit_delay = DBConfig::Get(database).options.commit_delay;
+		if (commit_delay > 0) {
+			// give concurrent committers the chance to join the group
+			std::this_thread::sleep_for(std::chrono::microseconds(commit_delay));
+		}
+		// commits are handed over to the file system before they are counted, so the sync covers all of them
+		idx_t sync_target = written_commits;
+		auto sync_start = std::chrono::steady_clock::now();
+		ErrorData error;
+		try {
+			writer->handle->Sync();
+		} catch (std::exception &ex) {
+			error = ErrorData(ex);
+		}
+		auto sync_end = std::chrono::steady_clock::now();
+
+		guard.lock();
+		sync_in_progress = false;
+		if (error.HasError()) {
+			sync_error = error.RawMessage();
+		} else {
+			auto sync_time = std::chrono::duration_cast<std::chrono::microseconds>(sync_end - sync_start).count();
+			StorageManager::Get(database).AddWALSync(sync_target - synced_commits, NumericCast<idx_t>(sync_time));
+			synced_commits = sync_target;
+		}
+		sync_finished.notify_all();
+	}
+}
+
 } // namespace duckdb
@@ -30,7 +30,7 @@ TransactionData::TransactionData(transaction_t transaction_id_p, transaction_t s
 DuckTransaction::DuckTransaction(DuckTransactionManager &manager, ClientContext &context_p, transaction_t start_time,
                                  transaction_t transaction_id)
     : Transaction(manager, context_p), start_time(start_time), transaction_id(transaction_id), commit_id(0),
-      highest_active_query(0), transaction_manager(manager), undo_buffer(context_p),
+      highest_active_query(0), wal_commit_sequence(0), transaction_manager(manager), undo_buffer(context_p),
       storage(make_uniq<LocalStorage>(context_p, *this)) {
 }
 
@@ -169,7 +169,7 @@ ErrorData DuckTransaction::Commit(AttachedDatabase &db, transaction_t new_commit
 	// "checkpoint" parameter indicates if the caller will checkpoint. If checkpoint ==
 	//    true: Then this function will NOT write to the WAL or flush/persist.
 	//          This method only makes commit in memory, expecting caller to checkpoint/flush.
-	//    false: Then this function WILL write to the WAL and Flush/Persist it.
+	//    false: Then this function WILL write to the WAL. The caller persists it by calling SyncCommit.
 	this->commit_id = new_commit_id;
 	if (!ChangesMade()) {
 		// no need to flush anything if we made no changes
@@ -192,7 +192,7 @@ ErrorData DuckTransaction::Commit(AttachedDatabase &db, transaction_t new_commit
 		storage->Commit(commit_state, *this);
 		undo_buffer.Commit(iterator_state, log, commit_id);
 		if (storage_commit_state) {
-			storage_commit_state->FlushCommit();
+			wal_commit_sequence = storage_commit_state->FlushCommit();
 		}
 		return ErrorData();
 	} catch (std::exception &ex) {
@@ -201,6 +201,18 @@ ErrorData DuckTransaction::Commit(AttachedDatabase &db, transaction_t new_commit
 	}
 }
 
+void DuckTransaction::SyncCommit(AttachedDatabase &db) {
+	if (wal_commit_sequence == 0) {
+		// nothing was written to the WAL
+		return;
+	}
+	auto commit_sequence = wal_commit_sequence;
+	wal_commit_sequence = 0;
+	auto log = db.GetStorageManager().GetWAL();
+	D_ASSERT(log);
+	log->SyncCommit(commit_sequence);
+}
+
 void DuckTransaction::Rollback() noexcept {
 	storage->Rollback();
 	undo_buffer.Rollback();
@@ -1,6 +1,7 @@
 #include "duckdb/transaction/duck_transaction_manager.hpp"
 
 #include "duckdb/catalog/catalog_set.hpp"
+#include "duckdb/common/chrono.hpp"
 #include "duckdb/common/exception/transaction_exception.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/helper.hpp"
@@ -12,7 +13,9 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/connection_manager.hpp"
 #include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/valid_checker.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
 
 namespace duckdb {
@@ -30,6 +33,7 @@ DuckTransactionManager::DuckTransactionManager(AttachedDatabase &db) : Transacti
 }
 
 DuckTransactionManager::~DuckTransactionManager() {
+	StopBackgroundCheckpointer();
 }
 
 DuckTransactionManager &DuckTransactionManager::Get(AttachedDatabase &db) {
@@ -52,6 +56,10 @@ Transaction &DuckTransactionManager::StartTransaction(ClientContext &context) {
 	// obtain the start time and transaction ID of this transaction
 	transaction_t start_time = current_start_timestamp++;
 	transaction_t transaction_id = current_transaction_id++;
+	if (!unsynced_commits.empty()) {
+		// start before the oldest commit that is not durable yet, so that we cannot see its changes
+		start_time = unsynced_commits.front();
+	}
 	if (active_transactions.empty()) {
 		lowest_active_start = start_time;
 		lowest_active_id = transaction_id;
@@ -89,15 +97,30 @@ DuckTransactionManager::CanCheckpoint(DuckTransaction &transaction, unique_ptr<S
 	if (!storage_manager.IsLoaded()) {
 		return CheckpointDecision("cannot checkpoint while loading");
 	}
-	if (!transaction.AutomaticCheckpoint(db, undo_properties)) {
+	// large updates are folded into the column segments by checkpointing, even if the WAL is still small
+	// the checkpoint rewrites the segments of every updated column with the committed updates merged in
+	bool fold_updates = !db.IsReadOnly() && undo_properties.updated_values > 0 &&
+	                    storage_manager.AutomaticCheckpoint(undo_properties.updated_values * UPDATE_FOLD_VALUE_SIZE);
+	if (!fold_updates && !transaction.AutomaticCheckpoint(db, undo_properties)) {
 		return CheckpointDecision("no reason to automatically checkpoint");
 	}
+#ifndef DUCKDB_NO_THREADS
+	if (DBConfig::Get(db).options.background_checkpoint && !background_checkpoint_failed) {
+		// the checkpoint is performed by the background checkpointer - this transaction writes to the WAL as usual
+		CheckpointDecision decision("automatic checkpoint is performed in the background");
+		decision.background = true;
+		decision.fold_updates = fold_updates;
+		return decision;
+	}
+#endif
 	// try to lock the checkpoint lock
 	lock = transaction.TryGetCheckpointLock();
 	if (!lock) {
 		return CheckpointDecision("Failed to obtain checkpoint lock - another thread is writing/checkpointing or "
 		                          "another read transaction relies on data that is not yet committed");
 	}
+	// we checkpoint ourselves - any error is reported to our client, after which the background checkpointer resumes
+	background_checkpoint_failed = false;
 	auto checkpoint_type = CheckpointType::FULL_CHECKPOINT;
 	if (undo_properties.has_updates || undo_properties.has_deletes || undo_properties.has_dropped_entries) {
 		// if we have made updates/deletes/catalog changes in this transaction we might need to change our strategy
@@ -236,7 +259,37 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	// commit successful: remove the transaction id from the list of active transactions
 	// potentially resulting in garbage collection
 	bool store_transaction = undo_properties.has_updates || undo_properties.has_catalog_changes || error.HasError();
+	if (transaction.wal_commit_sequence != 0) {
+		// sync the WAL without holding the transaction lock, so that concurrent commits can share a single sync
+		// the transaction is still active and holds on to its checkpoint lock, so the WAL cannot be checkpointed
+		// transactions that start before the sync has finished cannot see the changes yet (see StartTransaction)
+		unsynced_commits.push_back(commit_id);
+		tlock.unlock();
+		ErrorData sync_error;
+		try {
+			transaction.SyncCommit(db);
+		} catch (std::exception &ex) {
+			sync_error = ErrorData(ex);
+		}
+		tlock.lock();
+		if (sync_error.HasError()) {
+			// the WAL could not be synced - the commit is not durable, which invalidates the database
+			ValidChecker::Invalidate(db.GetDatabase(), sync_error.RawMessage());
+			RemoveTransaction(transaction, store_transaction);
+			return sync_error;
+		}
+		// commits are written to the WAL in commit order - the sync made all preceding commits durable as well
+		while (!unsynced_commits.empty() && unsynced_commits.front() <= commit_id) {
+			unsynced_commits.pop_front();
+		}
+	}
 	RemoveTransaction(transaction, store_transaction);
+	if (checkpoint_decision.background) {
+		// wake up the background checkpointer - it can checkpoint as soon as no write transactions are active anymore
+		// if other transactions still need the old versions of its updates, this transaction keeps its shared lock until
+		// it is cleaned up - so updates are only folded into the column segments once nobody needs the old versions
+		ScheduleBackgroundCheckpoint(checkpoint_decision.fold_updates);
+	}
 	// now perform a checkpoint if (1) we are able to checkpoint, and (2) the WAL has reached sufficient size to
 	// checkpoint
 	if (checkpoint_decision.can_checkpoint) {
@@ -253,6 +306,98 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	return error;
 }
 
+void DuckTransactionManager::ScheduleBackgroundCheckpoint(bool fold_updates) {
+#ifndef DUCKDB_NO_THREADS
+	lock_guard<mutex> guard(checkpoint_thread_lock);
+	if (checkpoint_thread_stopped) {
+		return;
+	}
+	checkpoint_pending = true;
+	checkpoint_fold_updates = checkpoint_fold_updates || fold_updates;
+	if (!checkpoint_thread) {
+		checkpoint_thread = make_uniq<thread>([this]() { BackgroundCheckpointLoop(); });
+	}
+	checkpoint_requested.notify_one();
+#endif
+}
+
+void DuckTransactionManager::BackgroundCheckpointLoop() {
+	unique_lock<mutex> guard(checkpoint_thread_lock);
+	while (true) {
+		checkpoint_requested.wait(guard, [&]() { return checkpoint_pending || checkpoint_thread_stopped; });
+		if (checkpoint_thread_stopped) {
+			return;
+		}
+		auto fold_updates = checkpoint_fold_updates;
+		checkpoint_pending = false;
+		checkpoint_fold_updates = false;
+		guard.unlock();
+		bool finished;
+		try {
+			finished = TryBackgroundCheckpoint(fold_updates);
+		} catch (std::exception &ex) {
+			// there is no client to report the error to - if it invalidates the database we do that here
+			ErrorData error(ex);
+			if (error.Type() == ExceptionType::FATAL) {
+				ValidChecker::Invalidate(db.GetDatabase(), error.RawMessage());
+			}
+			// otherwise the next automatic checkpoint is performed by the committing transaction instead, which
+			// reports the error to its client if the checkpoint fails again
+			background_checkpoint_failed = true;
+			finished = true;
+		}
+		guard.lock();
+		if (!finished && !checkpoint_thread_stopped) {
+			// write transactions were active - retry after a while, or when the next commit requests a checkpoint
+			checkpoint_pending = true;
+			checkpoint_fold_updates = checkpoint_fold_updates || fold_updates;
+			checkpoint_requested.wait_for(guard, std::chrono::milliseconds(BACKGROUND_CHECKPOINT_RETRY_MS),
+			                              [&]() { return checkpoint_thread_stopped; });
+		}
+	}
+}
+
+bool DuckTransactionManager::TryBackgroundCheckpoint(bool fold_updates) {
+	auto &storage_manager = db.GetStorageManager();
+	if (ValidChecker::IsInvalidated(db.GetDatabase())) {
+		return true;
+	}
+	// we do not upgrade the lock of a transaction here: we can only checkpoint if no write transactions are active
+	// write transactions that start while we are checkpointing wait for the checkpoint to finish
+	auto lock = checkpoint_lock.TryGetExclusiveLock();
+	if (!lock) {
+		return false;
+	}
+	// folding updates requires a checkpoint as long as the updates have not been checkpointed yet
+	auto checkpoint_required =
+	    fold_updates ? storage_manager.GetWALSize() > 0 : storage_manager.AutomaticCheckpoint(0);
+	if (!checkpoint_required) {
+		// the WAL has been checkpointed in the meantime
+		return true;
+	}
+	CheckpointOptions options;
+	if (GetLastCommit() > LowestActiveStart()) {
+		// we cannot do a full checkpoint if any transaction needs to read old data
+		options.type = CheckpointType::CONCURRENT_CHECKPOINT;
+	}
+	storage_manager.CreateCheckpoint(options);
+	return true;
+}
+
+void DuckTransactionManager::StopBackgroundCheckpointer() {
+	unique_ptr<thread> background_thread;
+	{
+		lock_guard<mutex> guard(checkpoint_thread_lock);
+		checkpoint_thread_stopped = true;
+		background_thread = std::move(checkpoint_thread);
+	}
+	checkpoint_requested.notify_all();
+	if (background_thread) {
+		// wait for a running checkpoint to finish
+		background_thread->join();
+	}
+}
+
 void DuckTransactionManager::RollbackTransaction(Transaction &transaction_p) {
 	auto &transaction = transaction_p.Cast<DuckTransaction>();
 	// obtain the transaction lock during this function
@@ -10,6 +10,7 @@
 #include "duckdb/transaction/cleanup_state.hpp"
 #include "duckdb/transaction/commit_state.hpp"
 #include "duckdb/transaction/rollback_state.hpp"
+#include "duckdb/transaction/update_info.hpp"
 #include "duckdb/execution/index/bound_index.hpp"
 
 namespace duckdb {
@@ -119,9 +120,12 @@ UndoBufferProperties UndoBuffer::GetProperties() {
 	IteratorState iterator_state;
 	IterateEntries(iterator_state, [&](UndoFlags entry_type, data_ptr_t data) {
 		switch (entry_type) {
-		case UndoFlags::UPDATE_TUPLE:
+		case UndoFlags::UPDATE_TUPLE: {
+			auto info = reinterpret_cast<UpdateInfo *>(data);
 			properties.has_updates = true;
+			properties.updated_values += info->N;
 			break;
+		}
 		case UndoFlags::DELETE_TUPLE:
 			properties.has_deletes = true;
 			break;
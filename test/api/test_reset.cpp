@@ -46,7 +46,9 @@ void RequireValueEqual(ConfigurationOption *op, const Value &left, const Value &
 OptionValueSet &GetValueForOption(const string &name) {
 	static unordered_map<string, OptionValueSet> value_map = {
 	    {"threads", {Value::BIGINT(42), Value::BIGINT(42)}},
+	    {"background_checkpoint", {Value(true)}},
 	    {"checkpoint_threshold", {"4.0 GiB"}},
+	    {"commit_delay", {Value::UBIGINT(1000)}},
 	    {"debug_checkpoint_abort", {{"none", "before_truncate", "before_header", "after_free_list_write"}}},
 	    {"default_collation", {"nocase"}},
 	    {"default_order", {"desc"}},
@@ -106,6 +108,7 @@ OptionValueSet &GetValueForOption(const string &name) {
 	    {"enable_progress_bar_print", {false}},
 	    {"progress_bar_time", {0}},
 	    {"temp_directory", {"tmp"}},
+	    {"temp_file_compression", {true}},
 	    {"wal_autocheckpoint", {"4.0 GiB"}},
 	    {"worker_threads", {42}},
 	    {"enable_http_metadata_cache", {true}},